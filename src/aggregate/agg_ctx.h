@@ -10,6 +10,7 @@ struct AggCtx {
     AggError *err;
     SIValue result;
     int (*Step)(struct AggCtx *ctx, SIValue *argv, int argc);
+    int (*StepRepeat)(struct AggCtx *ctx, SIValue *argv, int argc, size_t times);
     int (*ReduceNext)(struct AggCtx *ctx);
 };
 typedef struct AggCtx AggCtx;
@@ -177,11 +177,17 @@ typedef struct {
 } __agg_countCtx;
 
 int __agg_countStep(AggCtx *ctx, SIValue *argv, int argc) {
-    __agg_avgCtx *ac = Agg_FuncCtx(ctx);
+    __agg_countCtx *ac = Agg_FuncCtx(ctx);
     ac->count++;
     return AGG_OK;
 }
 
+int __agg_countStepRepeat(AggCtx *ctx, SIValue *argv, int argc, size_t times) {
+    __agg_countCtx *ac = Agg_FuncCtx(ctx);
+    ac->count += times;
+    return AGG_OK;
+}
+
 int __agg_countReduceNext(AggCtx *ctx) {
     __agg_countCtx *ac = Agg_FuncCtx(ctx);
     Agg_SetResult(ctx, SI_DoubleVal(ac->count));
@@ -192,7 +198,9 @@ AggCtx* Agg_CountFunc() {
     __agg_countCtx *ac = malloc(sizeof(__agg_countCtx));
     ac->count = 0;
     
-    return Agg_Reduce(ac, __agg_countStep, __agg_countReduceNext);
+    AggCtx *ctx = Agg_Reduce(ac, __agg_countStep, __agg_countReduceNext);
+    Agg_SetStepRepeat(ctx, __agg_countStepRepeat);
+    return ctx;
 }
 
 //------------------------------------------------------------------------
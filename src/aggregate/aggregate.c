@@ -13,6 +13,7 @@ AggCtx *Agg_NewCtx(void *fctx) {
     ac->fctx = fctx;
     ac->result = SI_NullVal();
     ac->Step = NULL;
+    ac->StepRepeat = NULL;
     ac->ReduceNext = NULL;
     return ac;
 }
@@ -22,6 +23,7 @@ void AggCtx_Free(AggCtx *ctx) {
     free(ctx->err);
   }
   SIValue_Free(&ctx->result);
+  free(ctx->fctx);
   free(ctx);
 }
 
@@ -34,6 +36,22 @@ int Agg_Step(AggCtx *ctx, SIValue *argv, int argc) {
   return ctx->Step(ctx, argv, argc);
 }
 
+int Agg_StepRepeat(AggCtx *ctx, SIValue *argv, int argc, size_t times) {
+  if(ctx->StepRepeat) {
+    return ctx->StepRepeat(ctx, argv, argc, times);
+  }
+
+  int rc = AGG_OK;
+  for(size_t i = 0; i < times && rc != AGG_ERR; i++) {
+    rc = ctx->Step(ctx, argv, argc);
+  }
+  return rc;
+}
+
+void Agg_SetStepRepeat(AggCtx *ctx, StepRepeatFunc f) {
+  ctx->StepRepeat = f;
+}
+
 int Agg_Finalize(AggCtx *ctx) {
   return ctx->ReduceNext(ctx);
 }
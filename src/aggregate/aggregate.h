@@ -18,6 +18,7 @@
 
 typedef int (*StepFunc)(AggCtx *ctx, SIValue *argv, int argc);
 typedef int (*ReduceFunc)(AggCtx *ctx);
+typedef int (*StepRepeatFunc)(AggCtx *ctx, SIValue *argv, int argc, size_t times);
 
 AggCtx *Agg_Reduce(void *ctx, StepFunc f, ReduceFunc reduce);
 AggCtx *Agg_NewCtx(void *fctx);
@@ -27,6 +28,11 @@ void *Agg_FuncCtx(AggCtx *ctx);
 void Agg_SetResult(AggCtx *ctx, SIValue v);
 
 int Agg_Step(AggCtx *ctx, SIValue *argv, int argc);
+
+/* Steps times over the same arguments, at once if function
+ * registered a repeated step, e.g. count. */
+int Agg_StepRepeat(AggCtx *ctx, SIValue *argv, int argc, size_t times);
+void Agg_SetStepRepeat(AggCtx *ctx, StepRepeatFunc f);
 int Agg_Finalize(AggCtx *ctx);
 
 #endif
\ No newline at end of file
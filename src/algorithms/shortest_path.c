@@ -0,0 +1,261 @@
+#include <string.h>
+
+#include "shortest_path.h"
+#include "../util/heap.h"
+#include "../util/arena.h"
+#include "../util/triemap/triemap.h"
+
+/* Search side state for a visited node. */
+typedef struct {
+    Edge *edge;     /* Edge through which node was reached, NULL for the side's root. */
+    int depth;      /* Number of hops from the side's root. */
+} _Visit;
+
+/* One side of the bidirectional search. */
+typedef struct {
+    TrieMap *visited;   /* Maps node id to _Visit. */
+    Vector *frontier;   /* Nodes reached at current depth. */
+    int depth;          /* Depth of frontier. */
+    int forward;        /* Expands along outgoing edges if set, incoming otherwise. */
+} _SearchSide;
+
+_Visit *_SearchSide_Get(const _SearchSide *side, const Node *n) {
+    _Visit *v = TrieMap_Find(side->visited, (char*)&n->id, sizeof(n->id));
+    return (v == TRIEMAP_NOTFOUND) ? NULL : v;
+}
+
+void _SearchSide_Visit(_SearchSide *side, Arena *arena, Node *n, Edge *e) {
+    _Visit *v = Arena_Alloc(arena, sizeof(_Visit));
+    v->edge = e;
+    v->depth = side->depth;
+    TrieMap_Add(side->visited, (char*)&n->id, sizeof(n->id), v, NULL);
+    Vector_Push(side->frontier, n);
+}
+
+void _SearchSide_Init(_SearchSide *side, Arena *arena, Node *root, int forward) {
+    side->visited = NewTrieMap();
+    side->frontier = NewVector(Node*, 16);
+    side->depth = 0;
+    side->forward = forward;
+    _SearchSide_Visit(side, arena, root, NULL);
+}
+
+void _FreeArenaOwned(void *value) {
+    /* Owned by the search arena. */
+}
+
+void _SearchSide_Free(_SearchSide *side) {
+    TrieMap_Free(side->visited, _FreeArenaOwned);
+    Vector_Free(side->frontier);
+}
+
+/* Expands side's frontier by a single hop, looking for nodes
+ * visited by the other side. Returns the node through which the
+ * shortest path found at this depth passes, NULL if sides did not meet. */
+Node *_SearchSide_Expand(_SearchSide *side, const _SearchSide *other, Arena *arena,
+                         const char *relation) {
+    Node *meet = NULL;
+    int meetDepth = 0;
+    Vector *frontier = side->frontier;
+    side->frontier = NewVector(Node*, Vector_Size(frontier));
+    side->depth++;
+
+    for(int i = 0; i < Vector_Size(frontier); i++) {
+        Node *n;
+        Vector_Get(frontier, i, &n);
+        Vector *edges = (side->forward) ? n->outgoingEdges : n->incomingEdges;
+
+        for(int j = 0; j < Vector_Size(edges); j++) {
+            Edge *e;
+            Vector_Get(edges, j, &e);
+            if(relation && strcmp(e->relationship, relation) != 0) continue;
+
+            Node *neighbour = (side->forward) ? e->dest : e->src;
+            if(_SearchSide_Get(side, neighbour)) continue;
+            _SearchSide_Visit(side, arena, neighbour, e);
+
+            /* Other side might have reached neighbour at different depths,
+             * keep the one closest to its root. */
+            _Visit *v = _SearchSide_Get(other, neighbour);
+            if(v && (meet == NULL || v->depth < meetDepth)) {
+                meet = neighbour;
+                meetDepth = v->depth;
+            }
+        }
+    }
+
+    Vector_Free(frontier);
+    return meet;
+}
+
+/* Walks from n back to side's root, collecting edges. */
+int _SearchSide_Trace(const _SearchSide *side, Node *n, Edge **edges) {
+    int len = 0;
+    _Visit *v = _SearchSide_Get(side, n);
+    while(v->edge) {
+        edges[len++] = v->edge;
+        n = (side->forward) ? v->edge->src : v->edge->dest;
+        v = _SearchSide_Get(side, n);
+    }
+    return len;
+}
+
+int ShortestPath(Node *src, Node *dest, const char *relation, int maxHops, Edge ***path) {
+    *path = NULL;
+    if(src == dest) return 0;
+
+    Arena *arena = NewArena(ARENA_DEFAULT_BLOCK_SIZE);
+    _SearchSide fwd;
+    _SearchSide bwd;
+    _SearchSide_Init(&fwd, arena, src, 1);
+    _SearchSide_Init(&bwd, arena, dest, 0);
+
+    Node *meet = NULL;
+    while(Vector_Size(fwd.frontier) > 0 && Vector_Size(bwd.frontier) > 0) {
+        if(maxHops != SHORTEST_PATH_UNBOUNDED && fwd.depth + bwd.depth >= maxHops) break;
+
+        /* Grow the smaller frontier. */
+        if(Vector_Size(fwd.frontier) <= Vector_Size(bwd.frontier)) {
+            meet = _SearchSide_Expand(&fwd, &bwd, arena, relation);
+        } else {
+            meet = _SearchSide_Expand(&bwd, &fwd, arena, relation);
+        }
+        if(meet) break;
+    }
+
+    int len = -1;
+    if(meet) {
+        len = _SearchSide_Get(&fwd, meet)->depth + _SearchSide_Get(&bwd, meet)->depth;
+        Edge **edges = malloc(sizeof(Edge*) * len);
+
+        /* Source side is traced backwards, reverse it. */
+        int fwdLen = _SearchSide_Trace(&fwd, meet, edges);
+        for(int i = 0; i < fwdLen / 2; i++) {
+            Edge *tmp = edges[i];
+            edges[i] = edges[fwdLen - 1 - i];
+            edges[fwdLen - 1 - i] = tmp;
+        }
+        _SearchSide_Trace(&bwd, meet, edges + fwdLen);
+        *path = edges;
+    }
+
+    _SearchSide_Free(&fwd);
+    _SearchSide_Free(&bwd);
+    Arena_Free(arena);
+    return len;
+}
+
+/* Dijkstra's state for a reached node. */
+typedef struct {
+    Node *node;
+    Edge *edge;             /* Edge through which node was reached at cost, NULL for src. */
+    double cost;            /* Least known cost from src. */
+    unsigned int heapIdx;   /* Position within the queue. */
+    int settled;            /* Set once cost is final. */
+} _Reach;
+
+/* Cheaper reaches have higher priority. */
+int _Reach_Compare(const void *a, const void *b, const void *udata) {
+    double costA = ((const _Reach*)a)->cost;
+    double costB = ((const _Reach*)b)->cost;
+    return (costA < costB) - (costA > costB);
+}
+
+void _Reach_SetIdx(void *reach, unsigned int idx) {
+    ((_Reach*)reach)->heapIdx = idx;
+}
+
+/* Reads edge's weight, returns 0 if edge has no valid weight. */
+int _Edge_Weight(const Edge *e, const char *weightProp, double *weight) {
+    SIValue *v = Edge_Get_Property(e, weightProp);
+    if(v == PROPERTY_NOTFOUND) return 0;
+
+    if(v->type == T_STRING) {
+        /* Properties set by GRAPH.ADDEDGE are kept as strings. */
+        char *end;
+        *weight = strtod(v->stringval.str, &end);
+        if(end == v->stringval.str || *end != '\0') return 0;
+    } else if(!SIValue_ToDouble(v, weight)) {
+        return 0;
+    }
+
+    return *weight >= 0;
+}
+
+int WeightedShortestPath(Node *src, Node *dest, const char *relation, const char *weightProp,
+                         double maxCost, double *cost, Edge ***path) {
+    *path = NULL;
+    *cost = 0;
+
+    Arena *arena = NewArena(ARENA_DEFAULT_BLOCK_SIZE);
+    TrieMap *reached = NewTrieMap();
+    heap_t *queue = heap_new(_Reach_Compare, NULL);
+    heap_set_index_cb(queue, _Reach_SetIdx);
+
+    _Reach *r = Arena_Calloc(arena, sizeof(_Reach));
+    r->node = src;
+    TrieMap_Add(reached, (char*)&src->id, sizeof(src->id), r, NULL);
+    heap_offer(&queue, r);
+
+    _Reach *target = NULL;
+    while((r = heap_poll(queue)) != NULL) {
+        r->settled = 1;
+        if(r->node == dest) {
+            target = r;
+            break;
+        }
+
+        Vector *edges = r->node->outgoingEdges;
+        for(int i = 0; i < Vector_Size(edges); i++) {
+            Edge *e;
+            double weight;
+            Vector_Get(edges, i, &e);
+            if(relation && strcmp(e->relationship, relation) != 0) continue;
+            if(!_Edge_Weight(e, weightProp, &weight)) continue;
+
+            double c = r->cost + weight;
+            if(maxCost != SHORTEST_PATH_UNBOUNDED && c > maxCost) continue;
+
+            _Reach *next = TrieMap_Find(reached, (char*)&e->dest->id, sizeof(e->dest->id));
+            if(next == TRIEMAP_NOTFOUND) {
+                next = Arena_Calloc(arena, sizeof(_Reach));
+                next->node = e->dest;
+                next->edge = e;
+                next->cost = c;
+                TrieMap_Add(reached, (char*)&e->dest->id, sizeof(e->dest->id), next, NULL);
+                heap_offer(&queue, next);
+            } else if(!next->settled && c < next->cost) {
+                /* Decrease key. */
+                next->edge = e;
+                next->cost = c;
+                heap_update_idx(queue, next->heapIdx);
+            }
+        }
+    }
+
+    int len = -1;
+    if(target) {
+        *cost = target->cost;
+
+        /* Walk back to src, then fill path from its end. */
+        len = 0;
+        for(r = target; r->edge; len++) {
+            r = TrieMap_Find(reached, (char*)&r->edge->src->id, sizeof(r->edge->src->id));
+        }
+
+        if(len > 0) {
+            Edge **edges = malloc(sizeof(Edge*) * len);
+            int i = len;
+            for(r = target; r->edge;) {
+                edges[--i] = r->edge;
+                r = TrieMap_Find(reached, (char*)&r->edge->src->id, sizeof(r->edge->src->id));
+            }
+            *path = edges;
+        }
+    }
+
+    heap_free(queue);
+    TrieMap_Free(reached, _FreeArenaOwned);
+    Arena_Free(arena);
+    return len;
+}
@@ -0,0 +1,31 @@
+#ifndef __SHORTEST_PATH_H__
+#define __SHORTEST_PATH_H__
+
+#include "../graph/node.h"
+#include "../graph/edge.h"
+
+#define SHORTEST_PATH_UNBOUNDED -1
+
+/* Finds a path with the least number of hops leading from src to dest,
+ * following edges of type relation (any type if NULL),
+ * no longer than maxHops (SHORTEST_PATH_UNBOUNDED for no limit).
+ * Runs a bidirectional BFS, src side expands along outgoing edges,
+ * dest side along incoming edges, the smaller frontier grows first.
+ * Returns path length, -1 if dest is unreachable,
+ * path is set to an array of the edges along the path,
+ * ordered from src to dest, which the caller should free. */
+int ShortestPath(Node *src, Node *dest, const char *relation, int maxHops, Edge ***path);
+
+/* Finds a path with the least total cost leading from src to dest,
+ * following edges of type relation (any type if NULL).
+ * An edge's cost is the numeric value of its weightProp property,
+ * edges without a non negative numeric weight are not followed.
+ * Paths costing more than maxCost are pruned (SHORTEST_PATH_UNBOUNDED for no limit).
+ * Runs Dijkstra's algorithm, stopping once dest is settled.
+ * Returns path length in hops, -1 if dest is unreachable,
+ * cost is set to the path's total cost and path to an array of the
+ * edges along the path, ordered from src to dest, which the caller should free. */
+int WeightedShortestPath(Node *src, Node *dest, const char *relation, const char *weightProp,
+                         double maxCost, double *cost, Edge ***path);
+
+#endif
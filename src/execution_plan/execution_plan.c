@@ -5,11 +5,19 @@
 
 #include "./ops/op_expand_all.h"
 #include "./ops/op_expand_into.h"
+#include "./ops/op_expand_var_len.h"
 #include "./ops/op_all_node_scan.h"
 #include "./ops/op_node_by_label_scan.h"
+#include "./ops/op_edge_by_type_scan.h"
 #include "./ops/op_produce_results.h"
 #include "./ops/op_filter.h"
+#include "../filter_tree/filter_normalize.h"
 #include "./ops/op_aggregate.h"
+#include "./ops/op_metadata_count.h"
+#include "./ops/op_hash_join.h"
+#include "./ops/op_cartesian_product.h"
+#include "./ops/op_multiway_join.h"
+#include "./traversal_order.h"
 
 #include "../graph/edge.h"
 #include "../rmutil/vector.h"
@@ -25,6 +33,7 @@ OpNode* NewOpNode(OpBase *op) {
     opNode->parents = NULL;
     opNode->parentCount = 0;
     opNode->state = StreamUnInitialized;
+    opNode->estimate = -1;
     return opNode;
 }
 
@@ -111,131 +120,99 @@ void _OpNode_PushInBetween(OpNode *parent, OpNode *onlyChild) {
     _OpNode_AddChild(parent, onlyChild);
 }
 
-/*  Nodes with more than one incoming edge
- * will take part in two expand operations
- * MergeNodes will replace one of the expand operation
- * with an expand_into operation 
- * plan - execution plan to be modified
- * n - node with two incoming edges. */
-void _ExecutionPlan_MergeNodes(ExecutionPlan *plan, const Node *n) {
-    if(Node_IncomeDegree(n) != 2) {
-        return;
-    }
-
-    /* Locate both expand operations involving 
-     * n as the dest node. */
-    
-    OpNode *a = NULL;
-    OpNode *b = NULL;
-
-    OpNode *current = NULL;
-    Vector *nodesToVisit = NewVector(OpNode*, 3);
-    Vector_Push(nodesToVisit, plan->root);
-    /* Due to the structure of our execution plan
-     * there's not need to maintain a visited nodes 
-     * as in classic BFS/DFS. */
-    while(Vector_Size (nodesToVisit) > 0) {
-        Vector_Pop(nodesToVisit, &current);
-        if(current->operation->type == OPType_EXPAND_ALL) {
-            ExpandAll *op = (ExpandAll*)current->operation;
-            // if(Node_Compare(*(op->dest_node), n)) {
-                if(*op->dest_node == n) {
-                if(a == NULL) {
-                    a = current;
-                    continue;
-                } else {
-                    b = current;
-                    break;
-                }
-            }
-        }
-
-        for(int i = 0; i < current->childCount; i++) {
-            Vector_Push(nodesToVisit, current->children[i]);
-        }
+/* Places op between parent and one of its children,
+ * op takes child's position among parent's children. */
+void _OpNode_InsertAbove(OpNode *parent, OpNode *child, OpNode *op) {
+    for(int i = 0; i < parent->childCount; i++) {
+        if(parent->children[i] == child) parent->children[i] = op;
     }
-    Vector_Free(nodesToVisit);
-    
-    if(a == NULL || b == NULL) {
-        return;
+    for(int i = 0; i < child->parentCount; i++) {
+        if(child->parents[i] == parent) child->parents[i] = op;
     }
 
-    /* now that both operations involving node n
-     * are found we can replace one of them with
-     * an expand into operation */
-    ExpandAll *op = (ExpandAll*)a->operation;
-    OpBase *opExpandInto;
-    NewExpandIntoOp(op->ctx, plan->graph, plan->graphName, op->src_node,
-                    op->relation, op->dest_node, &opExpandInto);
+    op->children = malloc(sizeof(OpNode *) * 2);
+    op->children[0] = child;
+    op->childCount = 1;
+    op->parents = malloc(sizeof(OpNode *) * 2);
+    op->parents[0] = parent;
+    op->parentCount = 1;
+}
 
-    // free previous operation.
-    a->operation->free(a->operation);
-    a->operation = opExpandInto;
-    OpNode *expandInto = a;
+/* Join ops pull from their first child only,
+ * executing the rest of their children on their own. */
+static inline int _ExecutionPlan_IsJoin(const OpBase *op) {
+    return op->type == OPType_HASH_JOIN || op->type == OPType_CARTESIAN_PRODUCT;
+}
 
-    // link b operation with expand into
-    _OpNode_AddChild(expandInto, b);
+void _ExecutionPlan_CollectSlots(const OpNode *stream, const Graph *g, int *slots, int *count) {
+    Vector *modifies = stream->operation->modifies;
+    for(int i = 0; modifies && i < Vector_Size(modifies); i++) {
+        char *alias;
+        Vector_Get(modifies, i, &alias);
+        int slot = Graph_GetAliasSlot(g, alias);
+        if(slot == GRAPH_NO_SLOT) continue;
+
+        int seen = 0;
+        for(int j = 0; j < *count && !seen; j++) seen = (slots[j] == slot);
+        if(!seen) slots[(*count)++] = slot;
+    }
 
-    // expand into should inherit b's parents
-    for(int i = 0; i < b->parentCount; i++) {
-        OpNode *bParent = b->parents[i];
-        
-        if(bParent == expandInto) {
-            continue;
-        }
+    for(int i = 0; i < stream->childCount; i++) {
+        _ExecutionPlan_CollectSlots(stream->children[i], g, slots, count);
+    }
+}
 
-        if(!_OpNode_ContainsChild(bParent, expandInto)) {
-            _OpNode_AddChild(bParent, expandInto);
-        }
+int ExecutionPlan_StreamSlots(const OpNode *stream, const Graph *g, int **slots) {
+    int count = 0;
+    *slots = malloc(sizeof(int) * (g->node_count + g->edge_count + 1));
+    _ExecutionPlan_CollectSlots(stream, g, *slots, &count);
+    return count;
+}
 
-        _OpNode_RemoveChild(bParent, b);
+/* Returns op's embedded filter, NULL if op doesn't support embedded filters. */
+FilterProgram** _ExecutionPlan_OpFilter(OpBase *op) {
+    switch(op->type) {
+        case OPType_ALL_NODE_SCAN:
+            return &((AllNodeScan*)op)->filter;
+        case OPType_NODE_BY_LABEL_SCAN:
+            return &((NodeByLabelScan*)op)->filter;
+        case OPType_EDGE_BY_TYPE_SCAN:
+            return &((EdgeByTypeScan*)op)->filter;
+        case OPType_EXPAND_ALL:
+            return &((ExpandAll*)op)->filter;
+        case OPType_MULTIWAY_JOIN:
+            return &((MultiwayJoin*)op)->filter;
+        default:
+            return NULL;
     }
 }
 
-/* Returns the number of expected IDs given node will generate */
-int _ExecutionPlan_EstimateNodeCardinality(RedisModuleCtx *ctx, const char *graph, const Node *n) {
-    Store *s = GetStore(ctx, STORE_NODE, graph, n->label);
-    return s->cardinality;
-}
+/* Embeds filter tree within op, such that op skips entities failing it.
+ * Returns 0 if op doesn't support embedded filters. */
+int _ExecutionPlan_EmbedFilter(OpBase *op, const Graph *g, FT_FilterNode *filterTree) {
+    FilterProgram **filter = _ExecutionPlan_OpFilter(op);
+    if(filter == NULL) return 0;
 
-/* Locates expand all operations which do not have a child operation,
- * And adds a scan operation as a new child. */
-void _ExecutionPlan_OptimizeEntryPoints(RedisModuleCtx *ctx, Graph *g, const char *graph_name,
-                                        AST_QueryExpressionNode *ast, OpNode *root) {
-    /* We've reached a leaf. */
-    if(root->childCount == 0 && root->operation->type == OPType_EXPAND_ALL) {
-        Node **src = ((ExpandAll*)(root->operation))->src_node;
-        Node **dest = ((ExpandAll*)(root->operation))->dest_node;
-        Node **entry_point = src;
+    /* Each op is filtered at most once. */
+    assert(*filter == NULL);
+    *filter = FilterProgram_Compile(filterTree, g);
+    return 1;
+}
 
-        // Determin which node should be scaned, based on node cardinality
-        // int src_cardinality = _ExecutionPlan_EstimateNodeCardinality(ctx, graph_name, *src);
-        // int dest_cardinality = _ExecutionPlan_EstimateNodeCardinality(ctx, graph_name, *dest);
-        
-        // if(dest_cardinality < src_cardinality) {
-        //     entry_point = dest;
-        // }
-        
-        OpBase *scan_op = NULL;
-        if((*entry_point)->label) {
-            /* TODO: when indexing is enabled, use index when possible. */
-            scan_op = NewNodeByLabelScanOp(ctx, g, entry_point, graph_name, (*entry_point)->label);
-        } else {
-            /* Node is not labeled, no other option but a full scan. */
-            scan_op = NewAllNodeScanOp(ctx, g, entry_point, graph_name);
-        }        
-        
-        _OpNode_AddChild(root, NewOpNode(scan_op));
+/* Filters join's stream by the part of filter tree
+ * concerning the entities stream binds, ahead of joining it. */
+void _ExecutionPlan_FilterStream(const Graph *g, OpNode *join, OpNode *stream,
+                                 Vector *saw, FT_FilterNode **filterTree) {
+    if(!FilterTree_ContainsNode(*filterTree, saw)) return;
 
-    } else {
-        /* Continue scanning. */
-        for(int i = 0; i < root->childCount; i++) {
-            _ExecutionPlan_OptimizeEntryPoints(ctx, g, graph_name, ast, root->children[i]);
-        }
+    FT_FilterNode *minTree = FilterTree_MinFilterTree(*filterTree, saw);
+    FilterTree_RemovePredNodes(filterTree, saw);
+    if(!_ExecutionPlan_EmbedFilter(stream->operation, g, minTree)) {
+        _OpNode_InsertAbove(join, stream, NewOpNode(NewFilterOp(g, minTree)));
     }
 }
 
-Vector* _ExecutionPlan_AddFilters(OpNode *root, FT_FilterNode **filterTree) {
+Vector* _ExecutionPlan_AddFilters(const Graph *g, OpNode *root, FT_FilterNode **filterTree) {
     /* We've reached the end of our execution plan. */
     if(root == NULL) {
         return NULL;
@@ -249,8 +226,14 @@ Vector* _ExecutionPlan_AddFilters(OpNode *root, FT_FilterNode **filterTree) {
 
     /* Traverse execution plan, upwards. */
     for(int i = root->childCount-1; i >= 0; i--) {
-        Vector *saw = _ExecutionPlan_AddFilters(root->children[i], filterTree);
-        
+        OpNode *child = root->children[i];
+        Vector *saw = _ExecutionPlan_AddFilters(g, child, filterTree);
+
+        /* Join's streams are filtered separately. */
+        if(saw != NULL && *filterTree != NULL && _ExecutionPlan_IsJoin(root->operation)) {
+            _ExecutionPlan_FilterStream(g, root, child, saw, filterTree);
+        }
+
         /* No need to continue, filter tree is empty. */
         if(*filterTree == NULL) {
             if(saw != NULL) {
@@ -270,16 +253,21 @@ Vector* _ExecutionPlan_AddFilters(OpNode *root, FT_FilterNode **filterTree) {
         }
     }
 
-    // See if filter tree filters any of the current op modified entities
-    if(FilterTree_ContainsNode(*filterTree, seen)) {    
+    /* See if filter tree filters any of the current op modified entities,
+     * filters spanning join's streams are left to its parent. */
+    if(!_ExecutionPlan_IsJoin(root->operation) && FilterTree_ContainsNode(*filterTree, seen)) {
         // Create a minimum filter tree for the current execution plan operation
         FT_FilterNode *minTree = FilterTree_MinFilterTree(*filterTree, seen);
         
         // Remove op modified entities from main filter tree.
         FilterTree_RemovePredNodes(filterTree, seen);
         
-        OpNode *nodeFilter = NewOpNode(NewFilterOp(minTree));
-        _OpNode_PushInBetween(root, nodeFilter);
+        /* Filter the only child from within when possible,
+         * sparing a round trip per rejected record. */
+        if(root->childCount != 1 || !_ExecutionPlan_EmbedFilter(root->children[0]->operation, g, minTree)) {
+            OpNode *nodeFilter = NewOpNode(NewFilterOp(g, minTree));
+            _OpNode_PushInBetween(root, nodeFilter);
+        }
     }
 
     /* Append current op modified entities. */
@@ -293,7 +281,508 @@ Vector* _ExecutionPlan_AddFilters(OpNode *root, FT_FilterNode **filterTree) {
     return seen;
 }
 
-ExecutionPlan *NewExecutionPlan(RedisModuleCtx *ctx, const char *graph_name, AST_QueryExpressionNode *ast) {
+/* Combines streams left to right into a single stream,
+ * streams binding common entities are hash joined on them,
+ * disjoint ones form a cartesian product.
+ * Either way the right stream is executed once. */
+OpNode* _ExecutionPlan_JoinStreams(const Graph *g, Vector *streams) {
+    OpNode *left;
+    Vector_Get(streams, 0, &left);
+
+    for(int i = 1; i < Vector_Size(streams); i++) {
+        OpNode *right;
+        Vector_Get(streams, i, &right);
+
+        int *leftSlots;
+        int *rightSlots;
+        int leftCount = ExecutionPlan_StreamSlots(left, g, &leftSlots);
+        int rightCount = ExecutionPlan_StreamSlots(right, g, &rightSlots);
+        int shared = 0;
+        for(int j = 0; j < leftCount && !shared; j++) {
+            for(int k = 0; k < rightCount && !shared; k++) shared = (leftSlots[j] == rightSlots[k]);
+        }
+        free(leftSlots);
+        free(rightSlots);
+
+        OpNode *join = NewOpNode(shared ? NewHashJoinOp() : NewCartesianProductOp());
+        if(!shared && left->estimate >= 0 && right->estimate >= 0) {
+            join->estimate = left->estimate * right->estimate;
+        }
+        _OpNode_AddChild(join, left);
+        _OpNode_AddChild(join, right);
+        left = join;
+    }
+
+    return left;
+}
+
+static inline int _ExecutionPlan_NodeSlot(const Graph *g, const Node *n) {
+    return Graph_GetAliasSlot(g, Graph_GetNodeAlias(g, n));
+}
+
+/* Collects the connected component of the query graph holding node start,
+ * marking its nodes as visited, returns the number of nodes within it,
+ * edgeCount is set to the number of edges among them. */
+int _ExecutionPlan_Component(const Graph *g, int start, int *visited,
+                             Node **component, int *edgeCount) {
+    int count = 0;
+    *edgeCount = 0;
+    visited[start] = 1;
+    component[count++] = g->nodes[start];
+
+    for(int head = 0; head < count; head++) {
+        Node *n = component[head];
+        Edge *e;
+        *edgeCount += Vector_Size(n->outgoingEdges);
+
+        for(int i = 0; i < Vector_Size(n->outgoingEdges) + Vector_Size(n->incomingEdges); i++) {
+            Node *neighbour;
+            if(i < Vector_Size(n->outgoingEdges)) {
+                Vector_Get(n->outgoingEdges, i, &e);
+                neighbour = e->dest;
+            } else {
+                Vector_Get(n->incomingEdges, i - Vector_Size(n->outgoingEdges), &e);
+                neighbour = e->src;
+            }
+
+            int slot = _ExecutionPlan_NodeSlot(g, neighbour);
+            if(!visited[slot]) {
+                visited[slot] = 1;
+                component[count++] = neighbour;
+            }
+        }
+    }
+
+    return count;
+}
+
+/* Component contains a cycle, and each of its edges
+ * connects two distinct nodes by a single hop. */
+int _ExecutionPlan_MultiwayJoinable(const Graph *g, const AST_MatchNode *match,
+                                    Node **component, int count, int edgeCount) {
+    if(edgeCount < count) return 0;
+
+    for(int i = 0; i < count; i++) {
+        Node *n = component[i];
+        for(int j = 0; j < Vector_Size(n->outgoingEdges); j++) {
+            Edge *e;
+            Vector_Get(n->outgoingEdges, j, &e);
+            if(e->src == e->dest) return 0;
+
+            AST_LinkEntity *link = (AST_LinkEntity*)MatchClause_GetEntity(match, Graph_GetEdgeAlias(g, e));
+            if(link && !AST_LinkEntity_FixedLength(link)) return 0;
+        }
+    }
+    return 1;
+}
+
+/* Creates an op binding node's pattern edge e, expanding from whichever
+ * end point is bound to the other, or checking e if both are. */
+OpNode* _ExecutionPlan_NewExpand(RedisModuleCtx *ctx, Graph *g, GraphContext *gc,
+                                 const AST_MatchNode *match, Edge *e) {
+    AST_LinkEntity *link = (AST_LinkEntity*)MatchClause_GetEntity(match, Graph_GetEdgeAlias(g, e));
+    if(link && !AST_LinkEntity_FixedLength(link)) {
+        return NewOpNode(NewExpandVarLenOp(ctx, g, Graph_GetNodeRef(g, e->src), Graph_GetEdgeRef(g, e),
+                                           Graph_GetNodeRef(g, e->dest),
+                                           link->length.minHops, link->length.maxHops));
+    }
+    return NewOpNode(NewExpandAllOp(ctx, g, gc, Graph_GetNodeRef(g, e->src), Graph_GetEdgeRef(g, e),
+                                    Graph_GetNodeRef(g, e->dest)));
+}
+
+/* Creates an op scanning node's matches. */
+OpNode* _ExecutionPlan_NewScan(RedisModuleCtx *ctx, Graph *g, GraphContext *gc, Node *n) {
+    if(n->label) {
+        /* TODO: when indexing is enabled, use index when possible. */
+        return NewOpNode(NewNodeByLabelScanOp(ctx, g, Graph_GetNodeRef(g, n), gc, n->label));
+    }
+    /* Node is not labeled, no other option but a full scan. */
+    return NewOpNode(NewAllNodeScanOp(ctx, g, Graph_GetNodeRef(g, n), gc));
+}
+
+/* Creates the ops carrying out traversal step, returns the top one. */
+OpNode* _ExecutionPlan_BuildTraversal(RedisModuleCtx *ctx, Graph *g, GraphContext *gc,
+                                      const AST_MatchNode *match, const TraversalStep *step) {
+    OpNode *top;
+    int checked = 0;
+
+    switch(step->t) {
+        case TRAVERSAL_SCAN:
+            top = _ExecutionPlan_NewScan(ctx, g, gc, step->node);
+            break;
+        case TRAVERSAL_EDGE_SCAN:
+            top = NewOpNode(NewEdgeByTypeScanOp(ctx, g, Graph_GetNodeRef(g, step->edges[0]->src),
+                                                Graph_GetEdgeRef(g, step->edges[0]),
+                                                Graph_GetNodeRef(g, step->edges[0]->dest), gc));
+            checked = 1;
+            break;
+        case TRAVERSAL_EXPAND:
+            top = _ExecutionPlan_NewExpand(ctx, g, gc, match, step->edges[0]);
+            _OpNode_AddChild(top, _ExecutionPlan_BuildTraversal(ctx, g, gc, match, step->child));
+            checked = 1;
+            break;
+        case TRAVERSAL_HASH_JOIN:
+            top = NewOpNode(NewHashJoinOp());
+            _OpNode_AddChild(top, _ExecutionPlan_BuildTraversal(ctx, g, gc, match, step->child));
+            _OpNode_AddChild(top, _ExecutionPlan_BuildTraversal(ctx, g, gc, match, step->build));
+            break;
+    }
+    top->estimate = step->bindRows;
+
+    /* Edges closing cycles, both end points are bound,
+     * fixed length ones are probed within src's sorted edges. */
+    for(int i = checked; i < step->edgeCount; i++) {
+        Edge *e = step->edges[i];
+        AST_LinkEntity *link = (AST_LinkEntity*)MatchClause_GetEntity(match, Graph_GetEdgeAlias(g, e));
+        OpNode *check;
+        if(link && !AST_LinkEntity_FixedLength(link)) {
+            check = _ExecutionPlan_NewExpand(ctx, g, gc, match, e);
+        } else {
+            OpBase *into;
+            NewExpandIntoOp(ctx, g, gc, Graph_GetNodeRef(g, e->src), Graph_GetEdgeRef(g, e),
+                            Graph_GetNodeRef(g, e->dest), &into);
+            check = NewOpNode(into);
+        }
+        _OpNode_AddChild(check, top);
+        check->estimate = step->rows;
+        top = check;
+    }
+
+    return top;
+}
+
+/* Creates a stream per connected pattern, cyclic patterns are matched by
+ * a multiway join, others by the cheapest traversal found for them. */
+void _ExecutionPlan_AddStreams(RedisModuleCtx *ctx, Graph *g, GraphContext *gc,
+                               const AST_MatchNode *match, const FT_FilterNode *filters,
+                               Vector *streams) {
+    int *visited = calloc(g->node_count + 1, sizeof(int));
+    Node **component = malloc(sizeof(Node*) * (g->node_count + 1));
+
+    for(int i = 0; i < g->node_count; i++) {
+        if(visited[i]) continue;
+
+        int edgeCount;
+        int count = _ExecutionPlan_Component(g, i, visited, component, &edgeCount);
+
+        OpNode *stream;
+        if(_ExecutionPlan_MultiwayJoinable(g, match, component, count, edgeCount)) {
+            stream = NewOpNode(NewMultiwayJoinOp(g, gc, component, count));
+            stream->estimate = TraversalOrder_EstimateRows(g, gc, match, filters, component, count);
+        } else {
+            TraversalStep *traversal = TraversalOrder_Plan(g, gc, match, filters, component, count);
+            stream = _ExecutionPlan_BuildTraversal(ctx, g, gc, match, traversal);
+            TraversalStep_Free(traversal);
+        }
+
+        /* Streams are ordered by estimated size, descending,
+         * such that joins materialize the smaller streams. */
+        int pos = Vector_Size(streams);
+        Vector_Push(streams, stream);
+        for(; pos > 0; pos--) {
+            OpNode *prev;
+            Vector_Get(streams, pos - 1, &prev);
+            if(prev->estimate >= stream->estimate) break;
+            Vector_Put(streams, pos, prev);
+            Vector_Put(streams, pos - 1, stream);
+        }
+    }
+
+    free(component);
+    free(visited);
+}
+
+/* Checks if filter tree refers to alias. */
+int _ExecutionPlan_FiltersAlias(const FT_FilterNode *root, const char *alias) {
+    if(root == NULL) return 0;
+
+    if(root->t == FT_N_COND) {
+        return (_ExecutionPlan_FiltersAlias(root->cond.left, alias) ||
+                _ExecutionPlan_FiltersAlias(root->cond.right, alias));
+    }
+
+    if(strcmp(root->pred.Lop.alias, alias) == 0) return 1;
+    return (root->pred.t == FT_N_VARYING && strcmp(root->pred.Rop.alias, alias) == 0);
+}
+
+/* Plans queries returning nothing but count(*) or count(alias),
+ * counting from graph metadata rather than enumerating matches:
+ * an unfiltered node is counted by its label cardinality,
+ * an unfiltered single hop by its type's edge statistics and a single hop
+ * whose one end is neither labeled nor filtered by the edges at each
+ * match of its other end. Returns NULL if matches must be enumerated. */
+OpNode* _ExecutionPlan_MetadataCount(RedisModuleCtx *ctx, Graph *g, GraphContext *gc,
+                                     AST_QueryExpressionNode *ast, const FT_FilterNode *filters) {
+    Vector *elements = ast->returnNode->returnElements;
+    if(Vector_Size(elements) != 1) return NULL;
+
+    AST_ReturnElementNode *retElem;
+    Vector_Get(elements, 0, &retElem);
+    if(retElem->type != N_AGG_FUNC || strcasecmp(retElem->func, "count") != 0) return NULL;
+    /* Counting a property skips entities missing it. */
+    if(retElem->variable && (retElem->variable->property ||
+       Graph_GetAliasSlot(g, retElem->variable->alias) == GRAPH_NO_SLOT)) return NULL;
+
+    if(g->node_count == 1 && g->edge_count == 0) {
+        if(filters) return NULL;
+        return NewOpNode(NewMetadataCountOp(ctx, g, gc, ast, METADATA_COUNT_NODES, g->nodes[0], NULL));
+    }
+
+    if(g->node_count != 2 || g->edge_count != 1) return NULL;
+    Edge *e = g->edges[0];
+    if(e->src == e->dest) return NULL;
+    AST_LinkEntity *link = (AST_LinkEntity*)MatchClause_GetEntity(ast->matchNode, Graph_GetEdgeAlias(g, e));
+    if(link && !AST_LinkEntity_FixedLength(link)) return NULL;
+
+    if(filters == NULL) {
+        return NewOpNode(NewMetadataCountOp(ctx, g, gc, ast, METADATA_COUNT_EDGES, NULL, e));
+    }
+
+    /* Edges are counted at the filtered end. */
+    if(_ExecutionPlan_FiltersAlias(filters, Graph_GetEdgeAlias(g, e))) return NULL;
+    Node *bound;
+    if(!e->dest->label && !_ExecutionPlan_FiltersAlias(filters, Graph_GetNodeAlias(g, e->dest))) {
+        bound = e->src;
+    } else if(!e->src->label && !_ExecutionPlan_FiltersAlias(filters, Graph_GetNodeAlias(g, e->src))) {
+        bound = e->dest;
+    } else {
+        return NULL;
+    }
+
+    OpNode *count = NewOpNode(NewMetadataCountOp(ctx, g, gc, ast, METADATA_COUNT_DEGREE, bound, e));
+    OpNode *scan = _ExecutionPlan_NewScan(ctx, g, gc, bound);
+    scan->estimate = GraphContext_LabelCardinality(gc, bound->label);
+    _OpNode_AddChild(count, scan);
+    return count;
+}
+
+static inline void _ExecutionPlan_MarkNodeRef(const Graph *g, Node **ref, int *required) {
+    required[ref - g->nodes] = 1;
+}
+
+static inline void _ExecutionPlan_MarkEdgeRef(const Graph *g, Edge **ref, int *required) {
+    required[g->node_count + (ref - g->edges)] = 1;
+}
+
+/* Marks the slots of return elements. */
+void _ExecutionPlan_MarkReturnSlots(const AST_QueryExpressionNode *ast, const int *slots, int *required) {
+    for(int i = 0; i < Vector_Size(ast->returnNode->returnElements); i++) {
+        if(slots[i] != GRAPH_NO_SLOT) required[slots[i]] = 1;
+    }
+}
+
+/* Marks the slots op binds or reads. */
+void _ExecutionPlan_MarkOpSlots(OpBase *op, const Graph *g, int *required) {
+    /* Bound entities. */
+    for(int i = 0; op->modifies && i < Vector_Size(op->modifies); i++) {
+        char *alias;
+        Vector_Get(op->modifies, i, &alias);
+        int slot = Graph_GetAliasSlot(g, alias);
+        if(slot != GRAPH_NO_SLOT) required[slot] = 1;
+    }
+
+    /* Read entities. */
+    FilterProgram *filter = NULL;
+    FilterProgram **embedded = _ExecutionPlan_OpFilter(op);
+    if(embedded) filter = *embedded;
+
+    switch(op->type) {
+        case OPType_PRODUCE_RESULTS:
+            if(((ProduceResults*)op)->ast) {
+                _ExecutionPlan_MarkReturnSlots(((ProduceResults*)op)->ast, ((ProduceResults*)op)->slots, required);
+            }
+            break;
+        case OPType_AGGREGATE:
+            _ExecutionPlan_MarkReturnSlots(((Aggregate*)op)->ast, ((Aggregate*)op)->slots, required);
+            break;
+        case OPType_METADATA_COUNT:
+            if(((MetadataCount*)op)->node) _ExecutionPlan_MarkNodeRef(g, ((MetadataCount*)op)->node, required);
+            break;
+        case OPType_FILTER:
+            filter = ((Filter*)op)->program;
+            break;
+        case OPType_EXPAND_ALL:
+            _ExecutionPlan_MarkNodeRef(g, ((ExpandAll*)op)->src_node, required);
+            _ExecutionPlan_MarkNodeRef(g, ((ExpandAll*)op)->dest_node, required);
+            _ExecutionPlan_MarkEdgeRef(g, ((ExpandAll*)op)->relation, required);
+            break;
+        case OPType_EXPAND_INTO:
+            _ExecutionPlan_MarkNodeRef(g, ((ExpandInto*)op)->src_node, required);
+            _ExecutionPlan_MarkNodeRef(g, ((ExpandInto*)op)->dest_node, required);
+            _ExecutionPlan_MarkEdgeRef(g, ((ExpandInto*)op)->relation, required);
+            break;
+        case OPType_EXPAND_VAR_LEN:
+            _ExecutionPlan_MarkNodeRef(g, ((ExpandVarLen*)op)->src_node, required);
+            _ExecutionPlan_MarkNodeRef(g, ((ExpandVarLen*)op)->dest_node, required);
+            break;
+        default:
+            break;
+    }
+
+    for(int i = 0; filter && i < filter->len; i++) {
+        const FP_Inst *inst = &filter->insts[i];
+        if(inst->t != FP_INST_PRED) continue;
+        if(inst->lhs.slot != GRAPH_NO_SLOT) required[inst->lhs.slot] = 1;
+        /* Only varying predicates read a second entity. */
+        if(inst->rhs.property && inst->rhs.slot != GRAPH_NO_SLOT) required[inst->rhs.slot] = 1;
+    }
+}
+
+/* Marks the slots bound or read by plan's ops, excluding skip's subtree. */
+void _ExecutionPlan_MarkSlots(OpNode *node, const OpNode *skip, const Graph *g, int *required) {
+    if(node == skip) return;
+    _ExecutionPlan_MarkOpSlots(node->operation, g, required);
+    for(int i = 0; i < node->childCount; i++) {
+        _ExecutionPlan_MarkSlots(node->children[i], skip, g, required);
+    }
+}
+
+/* Binds join ops to their streams, streams are final
+ * once filters had been placed. A materialized stream only captures
+ * the entities some op outside of it binds or reads. */
+void _ExecutionPlan_BindJoins(Graph *g, OpNode *plan, OpNode *root) {
+    int *required = NULL;
+    if(_ExecutionPlan_IsJoin(root->operation)) {
+        required = calloc(g->node_count + g->edge_count + 1, sizeof(int));
+        _ExecutionPlan_MarkSlots(plan, root->children[1], g, required);
+    }
+
+    switch(root->operation->type) {
+        case OPType_HASH_JOIN:
+            HashJoinBindStreams((HashJoin*)root->operation, g, root->children[0], root->children[1], required);
+            break;
+        case OPType_CARTESIAN_PRODUCT:
+            CartesianProductBindStream((CartesianProduct*)root->operation, g, root->children[1], required);
+            break;
+        default:
+            break;
+    }
+    free(required);
+
+    for(int i = 0; i < root->childCount; i++) {
+        _ExecutionPlan_BindJoins(g, plan, root->children[i]);
+    }
+}
+
+/* Estimates the records produced by ops placed once streams were formed. */
+void _ExecutionPlan_EstimateRows(OpNode *root) {
+    for(int i = 0; i < root->childCount; i++) _ExecutionPlan_EstimateRows(root->children[i]);
+    if(root->estimate >= 0 || root->childCount != 1) return;
+
+    double input = root->children[0]->estimate;
+    if(input < 0) return;
+
+    double selectivity, cost;
+    switch(root->operation->type) {
+        case OPType_FILTER:
+            FilterTree_Estimate(((Filter*)root->operation)->filterTree, &selectivity, &cost);
+            root->estimate = input * selectivity;
+            break;
+        case OPType_PRODUCE_RESULTS:
+            root->estimate = input;
+            break;
+        default:
+            break;
+    }
+}
+
+/* Resolves string constants compared against properties with a dictionary
+ * to their dictionary codes, such that equality compares codes. */
+void _ExecutionPlan_ResolveStringCodes(const GraphContext *gc, FT_FilterNode *root) {
+    if(root == NULL) return;
+    if(root->t == FT_N_COND) {
+        _ExecutionPlan_ResolveStringCodes(gc, root->cond.left);
+        _ExecutionPlan_ResolveStringCodes(gc, root->cond.right);
+        return;
+    }
+
+    FT_PredicateNode *pred = &root->pred;
+    if(pred->t != FT_N_CONSTANT || pred->constVal.type != T_STRING) return;
+    StringDict *d = GraphContext_GetStringDict(gc, pred->Lop.property);
+    if(d == NULL) return;
+    pred->constVal.code = StringDict_Lookup(d, pred->constVal.stringval.str, pred->constVal.stringval.len);
+}
+
+/* Seeds projection's property index hints with attribute IDs
+ * taken from the schema of each returned alias' label. */
+void _ExecutionPlan_SeedPropertyHints(const Graph *g, const GraphContext *gc,
+                                      const AST_QueryExpressionNode *ast, int *propIdx) {
+    Vector *elements = ast->returnNode->returnElements;
+    for(int i = 0; i < Vector_Size(elements); i++) {
+        AST_ReturnElementNode *elem;
+        Vector_Get(elements, i, &elem);
+        if(elem->type != N_PROP) continue;
+
+        const char *label = NULL;
+        StoreType type = STORE_NODE;
+        Node *n = Graph_GetNodeByAlias(g, elem->variable->alias);
+        if(n) {
+            label = n->label;
+        } else {
+            Edge *e = Graph_GetEdgeByAlias(g, elem->variable->alias);
+            if(e == NULL) continue;
+            label = e->relationship;
+            type = STORE_EDGE;
+        }
+        if(label == NULL) continue;
+
+        Schema *schema = GraphContext_GetSchema(gc, type, label);
+        if(schema == NULL) continue;
+        int id = Schema_GetAttributeID(schema, elem->variable->property);
+        if(id != SCHEMA_NO_ATTRIBUTE) propIdx[i] = id;
+    }
+}
+
+static inline uint64_t _ExecutionPlan_Cardinality(const GraphContext *gc, StoreType type, const char *name) {
+    return (type == STORE_NODE) ? GraphContext_LabelCardinality(gc, name) : GraphContext_TypeCardinality(gc, name);
+}
+
+/* Records stat unless already recorded. */
+static void _ExecutionPlan_AddStat(ExecutionPlan *plan, const GraphContext *gc, StoreType type, const char *name) {
+    for(int i = 0; i < plan->statCount; i++) {
+        const PlanStat *stat = &plan->stats[i];
+        if(stat->type != type) continue;
+        if(stat->name == name || (stat->name && name && strcmp(stat->name, name) == 0)) return;
+    }
+
+    PlanStat *stat = &plan->stats[plan->statCount++];
+    stat->type = type;
+    stat->name = name;
+    stat->count = _ExecutionPlan_Cardinality(gc, type, name);
+}
+
+/* Records the cardinalities of the labels and relationship types
+ * the query refers to, along with the graph's node and edge counts,
+ * these are the figures the planner costs plans with. */
+static void _ExecutionPlan_RecordStats(ExecutionPlan *plan, const GraphContext *gc) {
+    const Graph *g = plan->graph;
+    plan->stats = malloc(sizeof(PlanStat) * (g->node_count + g->edge_count + 2));
+    plan->statCount = 0;
+
+    _ExecutionPlan_AddStat(plan, gc, STORE_NODE, NULL);
+    _ExecutionPlan_AddStat(plan, gc, STORE_EDGE, NULL);
+    for(int i = 0; i < g->node_count; i++) {
+        _ExecutionPlan_AddStat(plan, gc, STORE_NODE, g->nodes[i]->label);
+    }
+    for(int i = 0; i < g->edge_count; i++) {
+        _ExecutionPlan_AddStat(plan, gc, STORE_EDGE, g->edges[i]->relationship);
+    }
+}
+
+int ExecutionPlan_Outdated(const ExecutionPlan *plan, const GraphContext *gc) {
+    for(int i = 0; i < plan->statCount; i++) {
+        const PlanStat *stat = &plan->stats[i];
+        /* Empty labels count as a single node, such that a handful
+         * of new entities don't trigger replanning. */
+        uint64_t then = stat->count ? stat->count : 1;
+        uint64_t now = _ExecutionPlan_Cardinality(gc, stat->type, stat->name);
+        if(now == 0) now = 1;
+        if(now > then * EXECUTION_PLAN_REPLAN_FACTOR || then > now * EXECUTION_PLAN_REPLAN_FACTOR) return 1;
+    }
+    return 0;
+}
+
+ExecutionPlan *NewExecutionPlan(RedisModuleCtx *ctx, GraphContext *gc, AST_QueryExpressionNode *ast) {
     Graph *graph = BuildGraph(ast->matchNode);
     ExecutionPlan *executionPlan = (ExecutionPlan*)calloc(1, sizeof(ExecutionPlan));
     
@@ -301,124 +790,71 @@ ExecutionPlan *NewExecutionPlan(RedisModuleCtx *ctx, const char *graph_name, AST
     OpBase *produceResults = NULL;
     FT_FilterNode *filterTree = NULL;
 
-    Vector *Ops = NewVector(OpNode*, 0);
     /* Last operation in our execution plan, produce result-set. */
-    NewProduceResultsOp(ctx, ast, &produceResults);
+    NewProduceResultsOp(ctx, graph, ast, &produceResults);
     OpNode *opProduceResults = NewOpNode(produceResults);
+    _ExecutionPlan_SeedPropertyHints(graph, gc, ast, ((ProduceResults*)produceResults)->propIdx);
+    /* Last op before streams, either projection or aggregation. */
+    OpNode *streamsParent = opProduceResults;
 
     executionPlan->root = opProduceResults;
     executionPlan->graph = graph;
-    executionPlan->graphName = graph_name;
-
-    Vector_Push(Ops, opProduceResults);
+    executionPlan->gc = gc;
+    executionPlan->params = NewTrieMap();
+    executionPlan->ast = ast;
 
+    int unsatisfiable = 0;
     if(ast->whereNode != NULL) {
-        executionPlan->filter_tree = BuildFiltersTree(ast->whereNode->filters);
+        executionPlan->filter_tree = BuildFiltersTree(ast->whereNode->filters, executionPlan->params);
+        unsatisfiable = (FilterTree_Normalize(&executionPlan->filter_tree) == FILTER_FAIL);
+        _ExecutionPlan_ResolveStringCodes(gc, executionPlan->filter_tree);
     }
 
-    if(ReturnClause_ContainsAggregation(ast->returnNode)) {
-        OpNode *opAggregate = NewOpNode(NewAggregateOp(ctx, ast));
-        Vector_Push(Ops, opAggregate);
+    /* Counts answered from metadata replace both aggregation and streams. */
+    OpNode *opMetadataCount = NULL;
+    if(!unsatisfiable) {
+        opMetadataCount = _ExecutionPlan_MetadataCount(ctx, graph, gc, ast, executionPlan->filter_tree);
     }
 
-    /* Get all nodes without incoming edges */
-    Vector *entryNodes = Graph_GetNDegreeNodes(graph, 0);
-
-    for(int i = 0; i < Vector_Size(entryNodes); i++) {
-        Node *node;
-        Vector_Get(entryNodes, i, &node);
-        
-        /* Advance if possible. */
-        if(Vector_Size(node->outgoingEdges) > 0) {
-            Vector *reversedExpandOps = NewVector(OpNode*, 0);
-
-            /* Traverse sub-graph expanded from current node. */
-            Node *srcNode = node;
-            Node *destNode;
-            Edge *edge;
-
-            while(Vector_Size(srcNode->outgoingEdges) > 0) {
-                Vector_Get(srcNode->outgoingEdges, 0, &edge);
-                destNode = edge->dest;
-                
-                OpNode *opNodeExpandAll = NewOpNode(NewExpandAllOp(ctx, graph, graph_name,
-                                                                   Graph_GetNodeRef(graph, srcNode),
-                                                                   Graph_GetEdgeRef(graph, edge),
-                                                                   Graph_GetNodeRef(graph, destNode)));
-                Vector_Push(reversedExpandOps, opNodeExpandAll);
-                
-                /* Advance. */
-                srcNode = destNode;
-            }
-
-            /* Save expand ops in reverse order. */
-            while(Vector_Size(reversedExpandOps) > 0) {
-                OpNode *opNodeExpandAll;
-                Vector_Pop(reversedExpandOps, &opNodeExpandAll);
-                Vector_Push(Ops, opNodeExpandAll);
-            }
-        } else {
-            /* Node doesn't have any incoming nor outgoing edges, 
-             * this is an hanging node "()", create a scan operation. */
-            OpNode *scan_op;
-            if(node->label) {
-                /* TODO: when indexing is enabled, use index when possible. */
-                scan_op = NewOpNode(NewNodeByLabelScanOp(ctx, graph, Graph_GetNodeRef(graph, node),
-                                    graph_name, node->label));
-            } else {
-                /* Node is not labeled, no other option but a full scan. */
-                scan_op = NewOpNode(NewAllNodeScanOp(ctx, graph, Graph_GetNodeRef(graph, node),
-                                    graph_name));
-            }
-            Vector_Push(Ops, scan_op);
-        }
-
-        /* Consume Ops in reversed order. */
-        if(Vector_Size(Ops) > 1) {
-            OpNode* currentOp;
-            OpNode* prevOp;
-            Vector_Pop(Ops, &prevOp);
-            
-            /* Connect operations in reversed order */
-            do {
-                Vector_Pop(Ops, &currentOp);
-                _OpNode_AddChild(currentOp, prevOp);
-                prevOp = currentOp;
-            } while(Vector_Size(Ops) != 0);
-
-            /* Reintroduce Projection. */
-            Vector_Push(Ops, opProduceResults);
-        }
-    } /* End of entry nodes loop */
+    if(opMetadataCount) {
+        _OpNode_AddChild(opProduceResults, opMetadataCount);
+    } else if(ReturnClause_ContainsAggregation(ast->returnNode)) {
+        OpNode *opAggregate = NewOpNode(NewAggregateOp(ctx, graph, ast));
+        _OpNode_AddChild(opProduceResults, opAggregate);
+        streamsParent = opAggregate;
+    }
 
-    Vector_Free(Ops);
+    /* No record can pass filters, there's no point in scanning the graph. */
+    Vector *streams = NewVector(OpNode*, 0);
+    if(!unsatisfiable && !opMetadataCount) {
+        _ExecutionPlan_AddStreams(ctx, graph, gc, ast->matchNode, executionPlan->filter_tree, streams);
+    }
 
-    /* Optimizations and modifications. */
-    _ExecutionPlan_OptimizeEntryPoints(ctx, graph, graph_name, ast, executionPlan->root);
-    
-    Vector *nodesToMerge = Graph_GetNDegreeNodes(graph, 2);
-    for(int i = 0; i < Vector_Size(nodesToMerge); i++) {
-        Node *nodeToMerge;
-        Vector_Get(nodesToMerge, i, & nodeToMerge);
-        _ExecutionPlan_MergeNodes(executionPlan, nodeToMerge);
+    if(Vector_Size(streams) > 0) {
+        _OpNode_AddChild(streamsParent, _ExecutionPlan_JoinStreams(graph, streams));
     }
-    
+    Vector_Free(streams);
+
     /* Until we'll be able to applay a the minimum filter tree to each op,
      * filters will be applied at the lowest level. */
-    if(ast->whereNode != NULL) {
-        _ExecutionPlan_AddFilters(executionPlan->root, &executionPlan->filter_tree);
+    if(executionPlan->filter_tree != NULL) {
+        Vector *seen = _ExecutionPlan_AddFilters(graph, executionPlan->root, &executionPlan->filter_tree);
+        if(seen) Vector_Free(seen);
     }
 
-    /* TODO: The plan executor is about to override the nodes/edges within the graph
-     * with entities which must persist, as a result freeing the graph
-     * will corrupt our database, this is why we're freeing the graph's entities 
-     * at this early stage as we only care about their place holders. */
+    _ExecutionPlan_BindJoins(graph, executionPlan->root, executionPlan->root);
+    _ExecutionPlan_EstimateRows(executionPlan->root);
+    _ExecutionPlan_RecordStats(executionPlan, gc);
     return executionPlan;
 }
 
 void _ExecutionPlanPrint(const OpNode *op, char **strPlan, int ident) {
     char strOp[512] = {0};
-    sprintf(strOp, "%*s%s\n", ident, "", op->operation->name);
+    if(op->estimate >= 0) {
+        sprintf(strOp, "%*s%s (estimated rows: %.1f)\n", ident, "", op->operation->name, op->estimate);
+    } else {
+        sprintf(strOp, "%*s%s\n", ident, "", op->operation->name);
+    }
     
     if(*strPlan == NULL) {
         *strPlan = calloc(strlen(strOp) + 1, sizeof(char));
@@ -446,6 +882,11 @@ void ResetStream(OpNode *stream) {
     }
 }
 
+/* Number of node's children pulled by the engine. */
+static inline int _OpNode_PulledStreams(const OpNode *node) {
+    return _ExecutionPlan_IsJoin(node->operation) ? 1 : node->childCount;
+}
+
 OpResult _ExecuteOpNode(OpNode *node, Graph *graph) {
 consume:
     node->state = StreamConsuming;
@@ -473,8 +914,9 @@ OpResult PullFromStreams(OpNode *source, Graph *graph) {
     OpNode *stream;
 
     /* Advance stream(s) */
+    int streamCount = _OpNode_PulledStreams(source);
     int stream_idx = 0;
-    for(; stream_idx < source->childCount; stream_idx++) {
+    for(; stream_idx < streamCount; stream_idx++) {
         stream = source->children[stream_idx];
         if(_ExecuteOpNode(stream, graph) == OP_OK) {
             break;
@@ -482,12 +924,12 @@ OpResult PullFromStreams(OpNode *source, Graph *graph) {
     }
 
     /* All streams are depleted. */
-    if(stream_idx == source->childCount) {
+    if(stream_idx == streamCount) {
         return OP_DEPLETED;
     }
 
     /* Pull from all uninitialized streams. */
-    for(int i = stream_idx+1; i < source->childCount; i++) {
+    for(int i = stream_idx+1; i < streamCount; i++) {
         stream = source->children[i];
         if(stream->state == StreamUnInitialized) {
             if(_ExecuteOpNode(stream, graph) != OP_OK) {
@@ -510,6 +952,124 @@ OpResult PullFromStreams(OpNode *source, Graph *graph) {
     return OP_OK;
 }
 
+OpResult ExecutionPlan_PullStream(OpNode *stream, Graph *graph) {
+    return _ExecuteOpNode(stream, graph);
+}
+
+/* Restores op to the state it was in right after construction,
+ * rebinding it to the current command context. */
+void _ExecutionPlan_ResetOp(OpBase *op, RedisModuleCtx *ctx) {
+    switch(op->type) {
+        case OPType_PRODUCE_RESULTS:
+            ((ProduceResults*)op)->ctx = ctx;
+            ((ProduceResults*)op)->init = 0;
+            ((ProduceResults*)op)->refreshAfterPass = 0;
+            ((ProduceResults*)op)->resultset = NULL;
+            break;
+        case OPType_AGGREGATE:
+            ((Aggregate*)op)->ctx = ctx;
+            ((Aggregate*)op)->init = 0;
+            ((Aggregate*)op)->refreshAfterPass = 0;
+            break;
+        case OPType_METADATA_COUNT:
+            ((MetadataCount*)op)->ctx = ctx;
+            ((MetadataCount*)op)->init = 0;
+            ((MetadataCount*)op)->refreshAfterPass = 0;
+            break;
+        case OPType_EXPAND_ALL:
+            op->reset(op);
+            ((ExpandAll*)op)->ctx = ctx;
+            ((ExpandAll*)op)->state = ExpandAllUninitialized;
+            break;
+        case OPType_EXPAND_VAR_LEN:
+            op->reset(op);
+            ((ExpandVarLen*)op)->ctx = ctx;
+            ((ExpandVarLen*)op)->state = ExpandVarLenUninitialized;
+            break;
+        case OPType_EXPAND_INTO:
+            op->reset(op);
+            ((ExpandInto*)op)->ctx = ctx;
+            ((ExpandInto*)op)->refreshAfterPass = 0;
+            break;
+        case OPType_FILTER:
+            ((Filter*)op)->state = FilterUninitialized;
+            break;
+        case OPType_ALL_NODE_SCAN:
+            op->reset(op);
+            ((AllNodeScan*)op)->ctx = ctx;
+            break;
+        case OPType_NODE_BY_LABEL_SCAN:
+            op->reset(op);
+            ((NodeByLabelScan*)op)->ctx = ctx;
+            break;
+        case OPType_EDGE_BY_TYPE_SCAN:
+            op->reset(op);
+            ((EdgeByTypeScan*)op)->ctx = ctx;
+            break;
+        case OPType_HASH_JOIN:
+            op->reset(op);
+            ((HashJoin*)op)->state = HashJoinUninitialized;
+            break;
+        case OPType_CARTESIAN_PRODUCT:
+            op->reset(op);
+            ((CartesianProduct*)op)->state = CartesianProductUninitialized;
+            break;
+        case OPType_MULTIWAY_JOIN:
+            op->reset(op);
+            break;
+    }
+}
+
+void _ExecutionPlan_ResetOpNode(OpNode *node, RedisModuleCtx *ctx) {
+    node->state = StreamUnInitialized;
+    _ExecutionPlan_ResetOp(node->operation, ctx);
+
+    for(int i = 0; i < node->childCount; i++) {
+        _ExecutionPlan_ResetOpNode(node->children[i], ctx);
+    }
+}
+
+void ExecutionPlan_Reset(ExecutionPlan *plan, RedisModuleCtx *ctx) {
+    _ExecutionPlan_ResetOpNode(plan->root, ctx);
+
+    /* Values bound by previous executions are no longer valid. */
+    char *name;
+    tm_len_t len;
+    FT_Param *param;
+    TrieMapIterator *it = TrieMap_Iterate(plan->params, "", 0);
+    while(TrieMapIterator_Next(it, &name, &len, (void**)&param)) {
+        param->bound = 0;
+        param->value = SI_NullVal();
+    }
+    TrieMapIterator_Free(it);
+}
+
+int ExecutionPlan_BindParam(ExecutionPlan *plan, const char *name, SIValue value) {
+    FT_Param *param = TrieMap_Find(plan->params, (char*)name, strlen(name));
+    if(param == TRIEMAP_NOTFOUND) return 0;
+
+    param->value = value;
+    param->bound = 1;
+    return 1;
+}
+
+const char *ExecutionPlan_UnboundParam(const ExecutionPlan *plan) {
+    char *name;
+    tm_len_t len;
+    FT_Param *param;
+    const char *unbound = NULL;
+
+    TrieMapIterator *it = TrieMap_Iterate(plan->params, "", 0);
+    while(TrieMapIterator_Next(it, &name, &len, (void**)&param)) {
+        if(!param->bound) {
+            unbound = param->name;
+            break;
+        }
+    }
+    TrieMapIterator_Free(it);
+    return unbound;
+}
+
 ResultSet* ExecutionPlan_Execute(ExecutionPlan *plan) {
     while(_ExecuteOpNode(plan->root, plan->graph) == OP_OK);
     
@@ -518,21 +1078,34 @@ ResultSet* ExecutionPlan_Execute(ExecutionPlan *plan) {
 }
 
 void OpNode_Free(OpNode* op) {
-    // Free child operations
-    for(int i = 0; i < op->childCount; i++) {
-        OpNode_Free(op->children[i]);
+    // Free child operations,
+    // a child shared by multiple parents is freed by its last parent.
+    while(op->childCount > 0) {
+        OpNode *child = op->children[0];
+        _OpNode_RemoveChild(op, child);
+        if(child->parentCount == 0) {
+            OpNode_Free(child);
+        }
     }
     
     // Free internal operation
     op->operation->free(op->operation);
+    free(op->children);
+    free(op->parents);
     free(op);
 }
 
 void ExecutionPlanFree(ExecutionPlan *plan) {
+    /* Ops bind stored entities to the query graph,
+     * restore its place holders before freeing it. */
+    ResetStream(plan->root);
     OpNode_Free(plan->root);
-    // Graph_Free(plan->graph);
-    // if(plan->filter_tree) {
-    //     FilterTree_Free(plan->filter_tree);
-    // }
+
+    if(plan->filter_tree) FilterTree_Free(plan->filter_tree);
+    if(plan->params) TrieMap_Free(plan->params, FilterTree_FreeParam);
+    if(plan->graph) Graph_Free(plan->graph);
+    free(plan->stats);
+    /* Query graph aliases point into the AST. */
+    if(plan->ast) Free_AST_QueryExpressionNode(plan->ast);
     free(plan);
 }
\ No newline at end of file
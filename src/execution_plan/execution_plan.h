@@ -5,6 +5,7 @@
 #include "../parser/ast.h"
 #include "../resultset/resultset.h"
 #include "../filter_tree/filter_tree.h"
+#include "../graph_context/graph_context.h"
 
 
 /* StreamState
@@ -24,6 +25,7 @@ struct OpNode {
     struct OpNode **parents;    /* Parent operations. */
     int parentCount;            /* Number of parents. */
     StreamState state;          /* Stream state. */
+    double estimate;            /* Estimated number of records produced, negative if unknown. */
 };
 
 typedef struct OpNode OpNode;
@@ -31,24 +33,71 @@ typedef struct OpNode OpNode;
 OpNode* NewOpNode(OpBase *op);
 void OpNode_Free(OpNode* op);
 
+/* Pulls next record out of stream, used by ops which
+ * execute streams of their own rather than have them pulled. */
+OpResult ExecutionPlan_PullStream(OpNode *stream, Graph *graph);
+
+/* Resets every op within stream. */
+void ResetStream(OpNode *stream);
+
+/* Collects the query graph slots bound by ops within stream,
+ * returns their count, caller should free slots. */
+int ExecutionPlan_StreamSlots(const OpNode *stream, const Graph *g, int **slots);
+
+
+/* Plans are rebuilt once a cardinality they were costed with
+ * grew or shrank by more than this factor. */
+#define EXECUTION_PLAN_REPLAN_FACTOR 2
+
+/* PlanStat
+ * Cardinality a plan was costed with, of a label (nodes)
+ * or relationship type (edges), NULL name stands for all nodes (edges). */
+typedef struct {
+    StoreType type;
+    const char *name;   /* Points into plan's query graph. */
+    uint64_t count;
+} PlanStat;
 
 typedef struct {
     OpNode *root;
     Graph *graph;
     FT_FilterNode *filter_tree;
-    const char *graphName;
+    GraphContext *gc;
+    TrieMap *params;                /* Query parameters, maps name to FT_Param. */
+    AST_QueryExpressionNode *ast;   /* Query AST, owned by plan. */
+    PlanStat *stats;                /* Cardinalities plan was costed with. */
+    int statCount;
 } ExecutionPlan;
 
-/* Creates a new execution plan from AST */
-ExecutionPlan *NewExecutionPlan(RedisModuleCtx *ctx, const char *graph, AST_QueryExpressionNode *ast);
+/* Creates a new execution plan from AST,
+ * plan takes ownership of AST. */
+ExecutionPlan *NewExecutionPlan(RedisModuleCtx *ctx, GraphContext *gc, AST_QueryExpressionNode *ast);
 
 /* Prints execution plan */
 char* ExecutionPlanPrint(const ExecutionPlan *plan);
 
+/* Restores plan to its initial state, allowing it to be executed again
+ * within the context of a new command. */
+void ExecutionPlan_Reset(ExecutionPlan *plan, RedisModuleCtx *ctx);
+
+/* Binds value to query parameter, value must outlive plan's execution.
+ * Returns 1 if plan refers to parameter, 0 otherwise. */
+int ExecutionPlan_BindParam(ExecutionPlan *plan, const char *name, SIValue value);
+
+/* Returns the name of a parameter plan refers to which has no value bound,
+ * NULL if every parameter is bound. */
+const char *ExecutionPlan_UnboundParam(const ExecutionPlan *plan);
+
+/* Checks whether graph changed enough since plan was built for plan
+ * to be rebuilt, i.e. a label or relationship type cardinality plan was
+ * costed with drifted past EXECUTION_PLAN_REPLAN_FACTOR. */
+int ExecutionPlan_Outdated(const ExecutionPlan *plan, const GraphContext *gc);
+
 /* Executes plan */
 ResultSet* ExecutionPlan_Execute(ExecutionPlan *plan);
 
-/* Free execution plan */
+/* Frees execution plan along with its AST, ops, filters
+ * and query graph, graph entities bound to the query graph are not freed. */
 void ExecutionPlanFree(ExecutionPlan *plan);
 
 #endif
\ No newline at end of file
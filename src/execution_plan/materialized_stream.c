@@ -0,0 +1,49 @@
+#include "materialized_stream.h"
+
+void MaterializedStream_Init(MaterializedStream *ms, OpNode *stream, Graph *g,
+                             int *slots, int width) {
+    ms->stream = stream;
+    ms->g = g;
+    ms->slots = slots;
+    ms->width = width;
+    ms->placeholders = malloc(sizeof(GraphEntity*) * width);
+    for(int i = 0; i < width; i++) ms->placeholders[i] = Graph_GetEntityBySlot(g, slots[i]);
+    ms->records = NULL;
+    ms->count = 0;
+    ms->cap = 0;
+}
+
+OpResult MaterializedStream_Fill(MaterializedStream *ms) {
+    OpResult res;
+    Graph *g = ms->g;
+    ms->count = 0;
+    while((res = ExecutionPlan_PullStream(ms->stream, g)) == OP_OK) {
+        if(ms->count == ms->cap) {
+            ms->cap = (ms->cap > 0) ? ms->cap * 2 : 64;
+            ms->records = realloc(ms->records, sizeof(GraphEntity*) * ms->width * ms->cap);
+        }
+
+        GraphEntity **record = ms->records + ms->count * ms->width;
+        for(int i = 0; i < ms->width; i++) record[i] = Graph_GetEntityBySlot(g, ms->slots[i]);
+        ms->count++;
+    }
+
+    /* Stream ops restore their placeholders on reset. */
+    ResetStream(ms->stream);
+    return (res == OP_ERR) ? OP_ERR : OP_OK;
+}
+
+void MaterializedStream_Bind(const MaterializedStream *ms, size_t record, int from) {
+    GraphEntity **entities = ms->records + record * ms->width;
+    for(int i = from; i < ms->width; i++) Graph_SetEntityBySlot(ms->g, ms->slots[i], entities[i]);
+}
+
+void MaterializedStream_Restore(const MaterializedStream *ms, int from) {
+    for(int i = from; i < ms->width; i++) Graph_SetEntityBySlot(ms->g, ms->slots[i], ms->placeholders[i]);
+}
+
+void MaterializedStream_Free(MaterializedStream *ms) {
+    free(ms->slots);
+    free(ms->placeholders);
+    free(ms->records);
+}
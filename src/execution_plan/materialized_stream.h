@@ -0,0 +1,44 @@
+#ifndef __MATERIALIZED_STREAM_H__
+#define __MATERIALIZED_STREAM_H__
+
+#include "execution_plan.h"
+
+/* MaterializedStream
+ * Records produced by a stream, captured as the entities the stream
+ * binds to query graph slots, such that the stream is executed once
+ * and its records are replayed by rebinding those entities. */
+typedef struct {
+    OpNode *stream;                 /* Captured stream. */
+    Graph *g;                       /* Query graph stream binds. */
+    int *slots;                     /* Slots captured per record. */
+    GraphEntity **placeholders;     /* Entities bound to slots prior to execution. */
+    int width;                      /* Number of captured slots. */
+    GraphEntity **records;          /* Captured entities, width per record. */
+    size_t count;                   /* Number of captured records. */
+    size_t cap;
+} MaterializedStream;
+
+/* Prepares ms to capture slots out of stream,
+ * ms takes ownership of slots. */
+void MaterializedStream_Init(MaterializedStream *ms, OpNode *stream, Graph *g,
+                             int *slots, int width);
+
+/* Executes stream to depletion capturing each of its records,
+ * replacing previously captured ones, slots are restored once done. */
+OpResult MaterializedStream_Fill(MaterializedStream *ms);
+
+/* Entity captured at column col of record. */
+static inline GraphEntity* MaterializedStream_Get(const MaterializedStream *ms,
+                                                  size_t record, int col) {
+    return ms->records[record * ms->width + col];
+}
+
+/* Binds columns [from, width) of record to their slots. */
+void MaterializedStream_Bind(const MaterializedStream *ms, size_t record, int from);
+
+/* Restores placeholders of columns [from, width). */
+void MaterializedStream_Restore(const MaterializedStream *ms, int from);
+
+void MaterializedStream_Free(MaterializedStream *ms);
+
+#endif
@@ -13,9 +13,15 @@
 typedef enum {
 OPType_AGGREGATE,
 OPType_ALL_NODE_SCAN,
+OPType_CARTESIAN_PRODUCT,
+OPType_EDGE_BY_TYPE_SCAN,
 OPType_EXPAND_ALL,
 OPType_EXPAND_INTO,
+OPType_EXPAND_VAR_LEN,
 OPType_FILTER,
+OPType_HASH_JOIN,
+OPType_METADATA_COUNT,
+OPType_MULTIWAY_JOIN,
 OPType_NODE_BY_LABEL_SCAN,
 OPType_PRODUCE_RESULTS,
 } OPType;
@@ -5,14 +5,15 @@
 #include "../../grouping/group_cache.h"
 #include "../../query_executor.h"
 
-OpBase* NewAggregateOp(RedisModuleCtx *ctx, AST_QueryExpressionNode *ast) {
-    return (OpBase*)NewAggregate(ctx, ast);
+OpBase* NewAggregateOp(RedisModuleCtx *ctx, Graph *g, AST_QueryExpressionNode *ast) {
+    return (OpBase*)NewAggregate(ctx, g, ast);
 }
 
-Aggregate* NewAggregate(RedisModuleCtx *ctx, AST_QueryExpressionNode *ast) {
+Aggregate* NewAggregate(RedisModuleCtx *ctx, Graph *g, AST_QueryExpressionNode *ast) {
     Aggregate *aggregate = malloc(sizeof(Aggregate));
     aggregate->ctx = ctx;
     aggregate->ast = ast;
+    aggregate->slots = ReturnClause_BindSlots(ast->returnNode, g);
     aggregate->refreshAfterPass = 0;
     aggregate->init = 0;
 
@@ -25,24 +26,55 @@ Aggregate* NewAggregate(RedisModuleCtx *ctx, AST_QueryExpressionNode *ast) {
     return aggregate;
 }
 
-void _aggregateRecord(RedisModuleCtx *ctx, const AST_ReturnNode* returnTree, const Graph* g) {
-    /* Get group */
-    Vector* groupKeys = ReturnClause_RetrieveGroupKeys(returnTree, g);
+/* Concats group keys as a comma seperated string, each key is read
+ * from a single property, whose interned strings are represented by their codes. */
+void _Aggregate_GroupKey(const Vector *keys, char **groupKey) {
+    size_t count = Vector_Size(keys);
+    SIValue **values = (SIValue**)keys->data;
+
+    /* Quoted strings, codes and other values take no more than 32 bytes. */
+    size_t length = count + 1;
+    for(int i = 0; i < count; i++) {
+        length += (values[i]->type == T_STRING && !values[i]->code) ? values[i]->stringval.len + 2 : 32;
+    }
+
+    char *key = malloc(length);
+    size_t offset = 0;
+    for(int i = 0; i < count; i++) {
+        if(i > 0) key[offset++] = ',';
+        if(values[i]->type == T_STRING && values[i]->code) {
+            offset += snprintf(key + offset, length - offset, "#%u", values[i]->code);
+        } else {
+            offset += SIValue_ToString(*values[i], key + offset, length - offset);
+        }
+    }
+    key[offset] = '\0';
+    *groupKey = key;
+}
+
+Group* Aggregate_GetGroup(RedisModuleCtx *ctx, const AST_ReturnNode* returnTree, const Graph* g, const int *slots) {
+    Vector* groupKeys = ReturnClause_RetrieveGroupKeys(returnTree, g, slots);
     char* groupKey;
-    SIValue_StringConcat(groupKeys, &groupKey);
-    // TODO: free groupKeys
+    _Aggregate_GroupKey(groupKeys, &groupKey);
 
     Group* group = NULL;
     CacheGroupGet(groupKey, &group);
 
     if(!group) {
-        /* Create a new group
+        /* Create a new group, which takes ownership over groupKeys.
          * Get aggregation functions. */
         group = NewGroup(groupKeys, ReturnClause_GetAggFuncs(ctx, returnTree));
         CacheGroupAdd(groupKey, group);
+    } else {
+        Vector_Free(groupKeys);
     }
+    free(groupKey);
+    return group;
+}
 
-    Vector* valsToAgg = ReturnClause_RetrieveGroupAggVals(returnTree, g);
+void _aggregateRecord(RedisModuleCtx *ctx, const AST_ReturnNode* returnTree, const Graph* g, const int *slots) {
+    Group *group = Aggregate_GetGroup(ctx, returnTree, g, slots);
+    Vector* valsToAgg = ReturnClause_RetrieveGroupAggVals(returnTree, g, slots);
 
     // Run each value through its coresponding function.
     for(int i = 0; i < Vector_Size(valsToAgg); i++) {
@@ -53,6 +85,7 @@ void _aggregateRecord(RedisModuleCtx *ctx, const AST_ReturnNode* returnTree, con
         Vector_Get(group->aggregationFunctions, i, &funcCtx);
         Agg_Step(funcCtx, value, 1);
     }
+    Vector_Free(valsToAgg);
 }
 
 OpResult AggregateConsume(OpBase *opBase, Graph* graph) {
@@ -68,7 +101,7 @@ OpResult AggregateConsume(OpBase *opBase, Graph* graph) {
         return OP_REFRESH;
     }
 
-    _aggregateRecord(op->ctx, op->ast->returnNode, graph);
+    _aggregateRecord(op->ctx, op->ast->returnNode, graph, op->slots);
     op->refreshAfterPass = 1;
     
     return OP_OK;
@@ -80,5 +113,6 @@ OpResult AggregateReset(OpBase *opBase) {
 
 void AggregateFree(OpBase *opBase) {
     Aggregate *op = (Aggregate*)opBase;
+    free(op->slots);
     free(op);
 }
\ No newline at end of file
@@ -5,6 +5,7 @@
 #include "../../parser/ast.h"
 #include "../../redismodule.h"
 #include "../../graph/graph.h"
+#include "../../grouping/group.h"
 
 /* Aggregate
  * aggregates graph according to  
@@ -14,11 +15,15 @@
      RedisModuleCtx *ctx;
      int refreshAfterPass;
      AST_QueryExpressionNode *ast;
+     int *slots;        /* Return elements binding slots. */
      int init;
  } Aggregate;
 
-OpBase* NewAggregateOp(RedisModuleCtx *ctx, AST_QueryExpressionNode *ast);
-Aggregate* NewAggregate(RedisModuleCtx *ctx, AST_QueryExpressionNode *ast);
+OpBase* NewAggregateOp(RedisModuleCtx *ctx, Graph *g, AST_QueryExpressionNode *ast);
+Aggregate* NewAggregate(RedisModuleCtx *ctx, Graph *g, AST_QueryExpressionNode *ast);
+/* Retrieves the group current record falls into, created on demand. */
+Group* Aggregate_GetGroup(RedisModuleCtx *ctx, const AST_ReturnNode* returnTree, const Graph* g, const int *slots);
+
 OpResult AggregateConsume(OpBase *opBase, Graph* graph);
 OpResult AggregateReset(OpBase *opBase);
 void AggregateFree(OpBase *opBase);
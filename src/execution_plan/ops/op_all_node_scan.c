@@ -1,12 +1,12 @@
 #include "op_all_node_scan.h"
 
-OpBase* NewAllNodeScanOp(RedisModuleCtx *ctx, Graph *g, Node **n, const char *graph_name) {
-    return (OpBase*)NewAllNodeScan(ctx, g, n, graph_name);
+OpBase* NewAllNodeScanOp(RedisModuleCtx *ctx, Graph *g, Node **n, GraphContext *gc) {
+    return (OpBase*)NewAllNodeScan(ctx, g, n, gc);
 }
 
-AllNodeScan* NewAllNodeScan(RedisModuleCtx *ctx, Graph *g, Node **n, const char *graph_name) {
+AllNodeScan* NewAllNodeScan(RedisModuleCtx *ctx, Graph *g, Node **n, GraphContext *gc) {
     // Get graph store
-    Store *store = GetStore(ctx, STORE_NODE, graph_name, NULL);
+    Store *store = GraphContext_GetStore(gc, STORE_NODE, NULL);
     if(store == NULL) {
         return NULL;
     }
@@ -16,8 +16,9 @@ AllNodeScan* NewAllNodeScan(RedisModuleCtx *ctx, Graph *g, Node **n, const char
     allNodeScan->node = n;
     allNodeScan->_node = *n;
     allNodeScan->store = store;
-    allNodeScan->graph = graph_name;
+    allNodeScan->gc = gc;
     allNodeScan->iter = Store_Search(store, "");
+    allNodeScan->filter = NULL;
 
     // Set our Op operations
     allNodeScan->op.name = "All Node Scan";
@@ -42,16 +43,17 @@ OpResult AllNodeScanConsume(OpBase *opBase, Graph* graph) {
     char *id;
     tm_len_t idLen;
     Node *node;
-    int res = StoreIterator_Next(op->iter, &id, &idLen, (void**)&node);
-    
-    if(res == 0) {
-        return OP_DEPLETED;
+
+    /* Skip nodes failing embedded filter. */
+    while(StoreIterator_Next(op->iter, &id, &idLen, (void**)&node)) {
+        /* Update node */
+        *op->node = node;
+        if(op->filter == NULL || FilterProgram_Apply(op->filter, graph) == FILTER_PASS) {
+            return OP_OK;
+        }
     }
-    
-    /* Update node */
-    *op->node = node;
 
-    return OP_OK;
+    return OP_DEPLETED;
 }
 
 OpResult AllNodeScanReset(OpBase *op) {
@@ -72,5 +74,7 @@ void AllNodeScanFree(OpBase *ctx) {
     if(allNodeScan->iter != NULL) {
        StoreIterator_Free(allNodeScan->iter);
     }
+    FilterProgram_Free(allNodeScan->filter);
+    Vector_Free(allNodeScan->op.modifies);
     free(allNodeScan);
 }
\ No newline at end of file
@@ -6,6 +6,8 @@
 #include "../../graph/graph.h"
 #include "../../graph/node.h"
 #include "../../stores/store.h"
+#include "../../graph_context/graph_context.h"
+#include "../../filter_tree/filter_program.h"
 
 /* AllNodesScan
  * Scans entire graph
@@ -17,12 +19,13 @@
     Node *_node;
     Store *store;           /* store being scanned */
     RedisModuleCtx *ctx;    /* redis module API context */
-    const char *graph;      /* queried graph id */
+    GraphContext *gc;       /* queried graph */
     StoreIterator *iter;    /* graph iterator */
+    FilterProgram *filter;  /* embedded filter, NULL if none */
  } AllNodeScan;
 
-OpBase* NewAllNodeScanOp(RedisModuleCtx *ctx, Graph *g, Node **n, const char *graph_name);
-AllNodeScan* NewAllNodeScan(RedisModuleCtx *ctx, Graph *g, Node **n, const char *graph_name);
+OpBase* NewAllNodeScanOp(RedisModuleCtx *ctx, Graph *g, Node **n, GraphContext *gc);
+AllNodeScan* NewAllNodeScan(RedisModuleCtx *ctx, Graph *g, Node **n, GraphContext *gc);
 OpResult AllNodeScanConsume(OpBase *opBase, Graph* graph);
 OpResult AllNodeScanReset(OpBase *op);
 void AllNodeScanFree(OpBase *ctx);
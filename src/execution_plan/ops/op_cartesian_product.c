@@ -0,0 +1,70 @@
+#include "op_cartesian_product.h"
+
+OpBase* NewCartesianProductOp() {
+    return (OpBase*)NewCartesianProduct();
+}
+
+CartesianProduct* NewCartesianProduct() {
+    CartesianProduct *cartesianProduct = calloc(1, sizeof(CartesianProduct));
+    cartesianProduct->state = CartesianProductUninitialized;
+
+    // Set our Op operations
+    cartesianProduct->op.name = "Cartesian Product";
+    cartesianProduct->op.type = OPType_CARTESIAN_PRODUCT;
+    cartesianProduct->op.consume = CartesianProductConsume;
+    cartesianProduct->op.reset = CartesianProductReset;
+    cartesianProduct->op.free = CartesianProductFree;
+    cartesianProduct->op.modifies = NULL;
+
+    return cartesianProduct;
+}
+
+void CartesianProductBindStream(CartesianProduct *op, Graph *g, OpNode *right, const int *required) {
+    int *slots;
+    int count = ExecutionPlan_StreamSlots(right, g, &slots);
+
+    int width = 0;
+    for(int i = 0; i < count; i++) {
+        if(required[slots[i]]) slots[width++] = slots[i];
+    }
+    MaterializedStream_Init(&op->right, right, g, slots, width);
+}
+
+OpResult CartesianProductConsume(OpBase *opBase, Graph* graph) {
+    CartesianProduct *op = (CartesianProduct*)opBase;
+
+    if(op->state == CartesianProductUninitialized) {
+        /* Materialize right stream before pulling from left one. */
+        if(MaterializedStream_Fill(&op->right) != OP_OK) return OP_ERR;
+        op->state = CartesianProductResetted;
+        return OP_REFRESH;
+    }
+
+    /* No record to pair left records with. */
+    if(op->right.count == 0) return OP_DEPLETED;
+
+    if(op->state == CartesianProductResetted) {
+        op->current = 0;
+        op->state = CartesianProductConsuming;
+    }
+
+    if(op->current < op->right.count) {
+        MaterializedStream_Bind(&op->right, op->current++, 0);
+        return OP_OK;
+    }
+
+    return OP_REFRESH;
+}
+
+OpResult CartesianProductReset(OpBase *ctx) {
+    CartesianProduct *op = (CartesianProduct*)ctx;
+    MaterializedStream_Restore(&op->right, 0);
+    if(op->state != CartesianProductUninitialized) op->state = CartesianProductResetted;
+    return OP_OK;
+}
+
+void CartesianProductFree(OpBase *ctx) {
+    CartesianProduct *op = (CartesianProduct*)ctx;
+    MaterializedStream_Free(&op->right);
+    free(op);
+}
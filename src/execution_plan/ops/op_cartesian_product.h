@@ -0,0 +1,37 @@
+#ifndef __OP_CARTESIAN_PRODUCT_H__
+#define __OP_CARTESIAN_PRODUCT_H__
+
+#include "op.h"
+#include "../materialized_stream.h"
+
+/* CartesianProductStates
+ * Different states in which CartesianProduct can be at. */
+typedef enum {
+    CartesianProductUninitialized,  /* Right stream wasn't materialized yet. */
+    CartesianProductResetted,       /* New left record was just pulled. */
+    CartesianProductConsuming,      /* Pairing left record with right records. */
+} CartesianProductStates;
+
+/* CartesianProduct
+ * Pairs each record of its left stream (first child) with every record
+ * of its right stream (second child), streams bind disjoint entities.
+ * Right stream is materialized once, rather than re-executed per left record. */
+typedef struct {
+    OpBase op;
+    MaterializedStream right;       /* Right stream records. */
+    size_t current;                 /* Next right record to pair with left record. */
+    CartesianProductStates state;
+} CartesianProduct;
+
+OpBase* NewCartesianProductOp();
+CartesianProduct* NewCartesianProduct();
+
+/* Binds op to its right stream, once plan is final, right entities
+ * are captured only if their slot is marked within required. */
+void CartesianProductBindStream(CartesianProduct *op, Graph *g, OpNode *right, const int *required);
+
+OpResult CartesianProductConsume(OpBase *opBase, Graph* graph);
+OpResult CartesianProductReset(OpBase *ctx);
+void CartesianProductFree(OpBase *ctx);
+
+#endif
@@ -0,0 +1,99 @@
+#include "op_edge_by_type_scan.h"
+
+OpBase *NewEdgeByTypeScanOp(RedisModuleCtx *ctx, Graph *g, Node **src_node, Edge **relation,
+                            Node **dest_node, GraphContext *gc) {
+    return (OpBase*)NewEdgeByTypeScan(ctx, g, src_node, relation, dest_node, gc);
+}
+
+EdgeByTypeScan* NewEdgeByTypeScan(RedisModuleCtx *ctx, Graph *g, Node **src_node, Edge **relation,
+                                  Node **dest_node, GraphContext *gc) {
+    EdgeByTypeScan *edgeByTypeScan = malloc(sizeof(EdgeByTypeScan));
+    edgeByTypeScan->ctx = ctx;
+    edgeByTypeScan->src_node = src_node;
+    edgeByTypeScan->_src_node = *src_node;
+    edgeByTypeScan->relation = relation;
+    edgeByTypeScan->_relation = *relation;
+    edgeByTypeScan->dest_node = dest_node;
+    edgeByTypeScan->_dest_node = *dest_node;
+    edgeByTypeScan->gc = gc;
+    /* Untyped edges are scanned from the store of all edges,
+     * an unknown type has no store, in which case there's nothing to scan. */
+    edgeByTypeScan->store = GraphContext_GetTypeStore(gc, (*relation)->relationship);
+    edgeByTypeScan->iter = NULL;
+    if(edgeByTypeScan->store) edgeByTypeScan->iter = Store_Search(edgeByTypeScan->store, "");
+    edgeByTypeScan->filter = NULL;
+
+    // Set our Op operations
+    edgeByTypeScan->op.name = "Edge By Type Scan";
+    edgeByTypeScan->op.type = OPType_EDGE_BY_TYPE_SCAN;
+    edgeByTypeScan->op.consume = EdgeByTypeScanConsume;
+    edgeByTypeScan->op.reset = EdgeByTypeScanReset;
+    edgeByTypeScan->op.free = EdgeByTypeScanFree;
+    edgeByTypeScan->op.modifies = NewVector(char*, 3);
+
+    char *modified;
+    modified = Graph_GetNodeAlias(g, *src_node);
+    Vector_Push(edgeByTypeScan->op.modifies, modified);
+    modified = Graph_GetEdgeAlias(g, *relation);
+    Vector_Push(edgeByTypeScan->op.modifies, modified);
+    modified = Graph_GetNodeAlias(g, *dest_node);
+    Vector_Push(edgeByTypeScan->op.modifies, modified);
+
+    return edgeByTypeScan;
+}
+
+static inline int _EdgeByTypeScan_LabelMatch(const Node *pattern, const Node *n) {
+    return pattern->label == NULL || (n->label && strcmp(n->label, pattern->label) == 0);
+}
+
+OpResult EdgeByTypeScanConsume(OpBase *opBase, Graph* graph) {
+    EdgeByTypeScan *op = (EdgeByTypeScan*)opBase;
+
+    if(op->iter == NULL) return OP_DEPLETED;
+
+    char *id;
+    tm_len_t idLen;
+    Edge *e;
+
+    while(StoreIterator_Next(op->iter, &id, &idLen, (void**)&e)) {
+        if(!_EdgeByTypeScan_LabelMatch(op->_src_node, e->src) ||
+           !_EdgeByTypeScan_LabelMatch(op->_dest_node, e->dest)) continue;
+
+        /* Update graph, skipping edges failing embedded filter. */
+        *op->src_node = e->src;
+        *op->relation = e;
+        *op->dest_node = e->dest;
+        if(op->filter == NULL || FilterProgram_Apply(op->filter, graph) == FILTER_PASS) {
+            return OP_OK;
+        }
+    }
+
+    return OP_DEPLETED;
+}
+
+OpResult EdgeByTypeScanReset(OpBase *ctx) {
+    EdgeByTypeScan *op = (EdgeByTypeScan*)ctx;
+
+    /* Restore original entities. */
+    *op->src_node = op->_src_node;
+    *op->relation = op->_relation;
+    *op->dest_node = op->_dest_node;
+
+    if(op->iter != NULL) {
+        StoreIterator_Free(op->iter);
+    }
+
+    op->iter = NULL;
+    if(op->store) op->iter = Store_Search(op->store, "");
+    return OP_OK;
+}
+
+void EdgeByTypeScanFree(OpBase *ctx) {
+    EdgeByTypeScan *op = (EdgeByTypeScan*)ctx;
+    if(op->iter != NULL) {
+        StoreIterator_Free(op->iter);
+    }
+    FilterProgram_Free(op->filter);
+    Vector_Free(op->op.modifies);
+    free(op);
+}
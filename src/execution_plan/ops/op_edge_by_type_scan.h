@@ -0,0 +1,48 @@
+#ifndef __OP_EDGE_BY_TYPE_SCAN_H
+#define __OP_EDGE_BY_TYPE_SCAN_H
+
+#include "op.h"
+#include "../../redismodule.h"
+#include "../../graph/graph.h"
+#include "../../graph/edge.h"
+#include "../../stores/store.h"
+#include "../../graph_context/graph_context.h"
+#include "../../filter_tree/filter_program.h"
+
+typedef struct {
+    OpBase op;
+    Node **src_node;        /* Source node being bound. */
+    Node *_src_node;
+    Edge **relation;        /* Edge being scanned. */
+    Edge *_relation;
+    Node **dest_node;       /* Destination node being bound. */
+    Node *_dest_node;
+    Store *store;           /* Relationship type store, NULL if type is unknown. */
+    RedisModuleCtx *ctx;
+    GraphContext *gc;       /* queried graph */
+    StoreIterator *iter;
+    FilterProgram *filter;  /* embedded filter, NULL if none */
+} EdgeByTypeScan;
+
+/* EdgeByTypeScan
+ * Scans entire relationship type store,
+ * binds each edge along with its end points,
+ * skipping edges whose end points lack their pattern labels.
+ * Unknown types are scanned as empty, no store is created for them. */
+OpBase *NewEdgeByTypeScanOp(RedisModuleCtx *ctx, Graph *g, Node **src_node, Edge **relation,
+                            Node **dest_node, GraphContext *gc);
+
+EdgeByTypeScan* NewEdgeByTypeScan(RedisModuleCtx *ctx, Graph *g, Node **src_node, Edge **relation,
+                                  Node **dest_node, GraphContext *gc);
+
+/* EdgeByTypeScan next operation
+ * called each time a new edge is required */
+OpResult EdgeByTypeScanConsume(OpBase *opBase, Graph* graph);
+
+/* Restart iterator */
+OpResult EdgeByTypeScanReset(OpBase *ctx);
+
+/* Frees EdgeByTypeScan */
+void EdgeByTypeScanFree(OpBase *ctx);
+
+#endif
@@ -1,13 +1,13 @@
 #include "op_expand_all.h"
 #include "../../hexastore/hexastore.h"
 
-OpBase* NewExpandAllOp(RedisModuleCtx *ctx, Graph *g, const char *graph_name,
+OpBase* NewExpandAllOp(RedisModuleCtx *ctx, Graph *g, GraphContext *gc,
                        Node **src_node, Edge **relation, Node **dest_node) {
     
-    return (OpBase*)NewExpandAll(ctx, g, graph_name, src_node, relation, dest_node);
+    return (OpBase*)NewExpandAll(ctx, g, gc, src_node, relation, dest_node);
 }
 
-ExpandAll* NewExpandAll(RedisModuleCtx *ctx, Graph *g, const char *graph_name,
+ExpandAll* NewExpandAll(RedisModuleCtx *ctx, Graph *g, GraphContext *gc,
                         Node **src_node, Edge **relation, Node **dest_node) {
     
     ExpandAll *expand_all = malloc(sizeof(ExpandAll));
@@ -19,11 +19,18 @@ ExpandAll* NewExpandAll(RedisModuleCtx *ctx, Graph *g, const char *graph_name,
     expand_all->_dest_node = *dest_node;
     expand_all->relation = relation;
     expand_all->_relation = *relation;
-    expand_all->hexastore = GetHexaStore(ctx, graph_name);
-    expand_all->triplet = NewTriplet(NULL, NULL, NULL);
+    expand_all->hexastore = GraphContext_GetHexaStore(gc);
+    expand_all->triplet.subject = NULL;
+    expand_all->triplet.predicate = NULL;
+    expand_all->triplet.object = NULL;
+    expand_all->triplet.kind = UNKNOW;
+    expand_all->modifies.kind = UNKNOW;
     expand_all->str_triplet = sdsempty();
     expand_all->iter = HexaStore_Search(expand_all->hexastore, "");
+    expand_all->edges = NewVector(Edge*, 0);
+    expand_all->edgeIdx = 0;
     expand_all->state = ExpandAllUninitialized;
+    expand_all->filter = NULL;
 
     // Set our Op operations
     expand_all->op.name = "Expand All";
@@ -48,6 +55,10 @@ ExpandAll* NewExpandAll(RedisModuleCtx *ctx, Graph *g, const char *graph_name,
     return expand_all;
 }
 
+static inline int _ExpandAll_LabelMatch(const Node *pattern, const Node *n) {
+    return pattern->label == NULL || (n->label && strcmp(n->label, pattern->label) == 0);
+}
+
 /* ExpandAllConsume next operation 
  * each call will update the graph
  * returns OP_DEPLETED when no additional updates are available */
@@ -60,47 +71,70 @@ OpResult ExpandAllConsume(OpBase *opBase, Graph* graph) {
 
     /* State reseted. */
     if(op->state == ExpandAllResetted) {
-        op->triplet->subject = *(op->src_node);
-        op->triplet->predicate = *(op->relation);
-        op->triplet->object = *(op->dest_node);
-        if(op->triplet->kind == UNKNOW) op->triplet->kind = TripletGetKind(op->triplet);
+        op->triplet.subject = *(op->src_node);
+        op->triplet.predicate = *(op->relation);
+        op->triplet.object = *(op->dest_node);
+        if(op->triplet.kind == UNKNOW) op->triplet.kind = TripletGetKind(&op->triplet);
 
         if(op->modifies.kind == UNKNOW) {
-            int s = (op->triplet->subject->id == INVALID_ENTITY_ID);
-            int o = (op->triplet->object->id == INVALID_ENTITY_ID);
-            int p = (op->triplet->predicate->id == INVALID_ENTITY_ID);
+            int s = (op->triplet.subject->id == INVALID_ENTITY_ID);
+            int o = (op->triplet.object->id == INVALID_ENTITY_ID);
+            int p = (op->triplet.predicate->id == INVALID_ENTITY_ID);
             op->modifies.kind = (s > 0) << 2 | (o > 0) << 1 | (p > 0);
         }
 
-        /* Overrides current value with triplet string representation,
-        * if string buffer is large enough, there will be no allocation. */
-        TripletToString(op->triplet, &op->str_triplet);
-        
-        /* Search hexastore, reuse iterator. */
-        HexaStore_Search_Iterator(op->hexastore, op->str_triplet, op->iter);
-
         op->state = ExpandAllConsuming;
+
+        if(op->modifies.kind == P) {
+            /* Both ends are bound, search src's sorted edges
+             * rather than the hexastore. */
+            op->edges->top = 0;
+            op->edgeIdx = 0;
+            Node_GetEdges(op->triplet.subject, op->triplet.object, op->_relation->relationship, op->edges);
+        } else {
+            /* Overrides current value with triplet string representation,
+            * if string buffer is large enough, there will be no allocation. */
+            TripletToString(&op->triplet, &op->str_triplet);
+            
+            /* Search hexastore, reuse iterator. */
+            HexaStore_Search_Iterator(op->hexastore, op->str_triplet, op->iter);
+        }
     }
-    
-    Triplet *triplet = NULL;
-    if(!TripletIterator_Next(op->iter, &triplet)) {
+
+    if(op->modifies.kind == P) {
+        while(op->edgeIdx < Vector_Size(op->edges)) {
+            Vector_Get(op->edges, op->edgeIdx++, op->relation);
+            if(op->filter == NULL || FilterProgram_Apply(op->filter, graph) == FILTER_PASS) {
+                return OP_OK;
+            }
+        }
         return OP_REFRESH;
     }
+    
+    Edge *edge = NULL;
+    while(TripletIterator_Next(op->iter, &edge)) {
+        /* Nodes bound by expansion must carry their pattern node's label. */
+        if((op->modifies.kind & S) && !_ExpandAll_LabelMatch(op->_src_node, edge->src)) continue;
+        if((op->modifies.kind & O) && !_ExpandAll_LabelMatch(op->_dest_node, edge->dest)) continue;
 
-    /* TODO: Make sure retrieved id are indeed
-     * labeled under nodes / edge lables. */
-         
-    /* Update graph. */
-    if(op->modifies.kind & S) {
-        *op->src_node = triplet->subject;
-    }
-    if(op->modifies.kind & P) {
-        *op->relation = triplet->predicate;
-    }
-    if(op->modifies.kind & O) {
-        *op->dest_node = triplet->object;
+        /* Update graph. */
+        if(op->modifies.kind & S) {
+            *op->src_node = edge->src;
+        }
+        if(op->modifies.kind & P) {
+            *op->relation = edge;
+        }
+        if(op->modifies.kind & O) {
+            *op->dest_node = edge->dest;
+        }
+
+        /* Skip triplets failing embedded filter. */
+        if(op->filter == NULL || FilterProgram_Apply(op->filter, graph) == FILTER_PASS) {
+            return OP_OK;
+        }
     }
-    return OP_OK;
+
+    return OP_REFRESH;
 }
 
 OpResult ExpandAllReset(OpBase *ctx) {
@@ -130,6 +164,9 @@ void ExpandAllFree(OpBase *ctx) {
     if(op->iter != NULL) {
         TripletIterator_Free(op->iter);
     }
+    Vector_Free(op->edges);
     sdsfree(op->str_triplet);
+    FilterProgram_Free(op->filter);
+    Vector_Free(op->op.modifies);
     free(op);
 }
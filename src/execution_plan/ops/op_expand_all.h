@@ -4,6 +4,8 @@
 #include "op.h"
 #include "../../rmutil/sds.h"
 #include "../../hexastore/triplet.h"
+#include "../../graph_context/graph_context.h"
+#include "../../filter_tree/filter_program.h"
 
 
 /* ExpandAllStates 
@@ -27,18 +29,21 @@ typedef struct {
     Edge *_relation;        /* Original edge to expand. */
     RedisModuleCtx *ctx;    /* Redis context. */
     HexaStore *hexastore;   /* Graph store. */
-    Triplet *triplet;
+    Triplet triplet;        /* Pattern searched for. */
     Triplet modifies;       /* Which entities does this operation modifies. */
     sds str_triplet;        /* String representation of current triplet. */
     TripletIterator *iter;  /* Graph iterator. */
+    Vector *edges;          /* Edges connecting bound src and dest. */
+    int edgeIdx;            /* Next edge to bind. */
     ExpandAllStates state;  /* Operation current state. */
+    FilterProgram *filter;  /* Embedded filter, NULL if none. */
 } ExpandAll;
 
 /* Creates a new ExpandAll operation */
-OpBase* NewExpandAllOp(RedisModuleCtx *ctx, Graph *g, const char *graph_name,
+OpBase* NewExpandAllOp(RedisModuleCtx *ctx, Graph *g, GraphContext *gc,
                        Node **src_node, Edge **relation, Node **dest_node);
 
-ExpandAll* NewExpandAll(RedisModuleCtx *ctx, Graph *g, const char *graph_name,
+ExpandAll* NewExpandAll(RedisModuleCtx *ctx, Graph *g, GraphContext *gc,
                         Node **src_node, Edge **relation, Node **dest_node);
 
 /* ExpandAllConsume next operation 
@@ -1,11 +1,11 @@
 #include "op_expand_into.h"
 
-void NewExpandIntoOp(RedisModuleCtx *ctx, Graph *g, const char *graph_name, Node **src_node,
+void NewExpandIntoOp(RedisModuleCtx *ctx, Graph *g, GraphContext *gc, Node **src_node,
                      Edge **relation, Node **dest_node, OpBase **op) {
-    *op = (OpBase *)NewExpandInto(ctx, g, graph_name, src_node, relation, dest_node);
+    *op = (OpBase *)NewExpandInto(ctx, g, gc, src_node, relation, dest_node);
 }
 
-ExpandInto* NewExpandInto(RedisModuleCtx *ctx, Graph *g, const char *graph_name, Node **src_node,
+ExpandInto* NewExpandInto(RedisModuleCtx *ctx, Graph *g, GraphContext *gc, Node **src_node,
                           Edge **relation, Node **dest_node) {
     ExpandInto *expandInto = calloc(1, sizeof(ExpandInto));
 
@@ -15,9 +15,8 @@ ExpandInto* NewExpandInto(RedisModuleCtx *ctx, Graph *g, const char *graph_name,
     expandInto->_relation = *relation;
     expandInto->refreshAfterPass = 0;
     expandInto->ctx = ctx;
-    expandInto->str_triplet = sdsempty();
-    expandInto->hexastore = GetHexaStore(ctx, graph_name);
-    expandInto->iter = HexaStore_Search(expandInto->hexastore, "");
+    expandInto->edges = NewVector(Edge*, 0);
+    expandInto->edgeIdx = 0;
 
     // Set our Op operations
     expandInto->op.name = "Expand Into";
@@ -39,37 +38,24 @@ OpResult ExpandIntoConsume(OpBase *opBase, Graph* graph) {
     if( (*(op->src_node))->id == INVALID_ENTITY_ID ||
         (*(op->dest_node))->id == INVALID_ENTITY_ID) return OP_REFRESH;
 
-    /* Request data refresh. */
-    if(op->refreshAfterPass) {
-        op->refreshAfterPass = 0;
-        *op->relation = op->_relation;
-        return OP_REFRESH;
+    /* Look up edges connecting current pair. */
+    if(!op->refreshAfterPass) {
+        op->edges->top = 0;
+        op->edgeIdx = 0;
+        Node_GetEdges(*op->src_node, *op->dest_node, op->_relation->relationship, op->edges);
+        op->refreshAfterPass = 1;
     }
-    
-    Triplet t = {.subject = *(op->src_node),
-                 .predicate = *(op->relation),
-                 .object = *(op->dest_node)};
-
-    t.kind = SO;
 
-    /* Overrides current value with triplet string representation,
-     * If string buffer is large enough, there will be no allocation. */
-    TripletToString(&t, &op->str_triplet);
-
-    /* Search hexastore, reuse iterator. */
-    HexaStore_Search_Iterator(op->hexastore, op->str_triplet, op->iter);
-    
-    /* No connection between src and dest. */
-    Triplet *triplet = NULL;
-    if(!TripletIterator_Next(op->iter, &triplet)) return OP_REFRESH;
+    /* Connection found, bind next edge. */
+    if(op->edgeIdx < Vector_Size(op->edges)) {
+        Vector_Get(op->edges, op->edgeIdx++, op->relation);
+        return OP_OK;
+    }
 
-    /* Update graph. */
-    *op->relation = triplet->predicate;
-    
-    /* Connection found,
-     * Require a data refresh next time we're called */
-    op->refreshAfterPass = 1;
-    return OP_OK;
+    /* Pair exhausted, request data refresh. */
+    op->refreshAfterPass = 0;
+    *op->relation = op->_relation;
+    return OP_REFRESH;
 }
 
 /* Simply returns OP_OK */
@@ -77,11 +63,14 @@ OpResult ExpandIntoReset(OpBase *ctx) {
     ExpandInto *op = (ExpandInto*)ctx;
     /* Restore original relation. */
     *op->relation = op->_relation;
+    op->refreshAfterPass = 0;
     return OP_OK;
 }
 
 /* Frees ExpandInto*/
 void ExpandIntoFree(OpBase *ctx) {
     ExpandInto *op = (ExpandInto*)ctx;
+    Vector_Free(op->edges);
+    Vector_Free(op->op.modifies);
     free(op);
 }
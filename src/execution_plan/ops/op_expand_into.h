@@ -2,8 +2,7 @@
 #define __OP_EXPAND_INTO_H
 
 #include "op.h"
-#include "../../rmutil/sds.h"
-#include "../../hexastore/hexastore.h"
+#include "../../graph_context/graph_context.h"
 
 /* ExpandInto checks to see if
  * there's a connection between source and destination
@@ -14,22 +13,21 @@ typedef struct {
     Node **dest_node;
     Edge **relation; /* Type of relation we're looking for to exists between nodes. */
     Edge *_relation;
-    sds str_triplet;
     int refreshAfterPass;
     RedisModuleCtx *ctx;
-    HexaStore *hexastore;
-    TripletIterator *iter;  /* Graph iterator. */
+    Vector *edges;  /* Edges connecting current src and dest. */
+    int edgeIdx;    /* Next edge to bind. */
 } ExpandInto;
 
 /* Creates a new ExpandInto operation */
-void NewExpandIntoOp(RedisModuleCtx *ctx, Graph *g, const char *graph_name, Node **src_node,
+void NewExpandIntoOp(RedisModuleCtx *ctx, Graph *g, GraphContext *gc, Node **src_node,
                      Edge **relation, Node **dest_node, OpBase **op);
 
-ExpandInto* NewExpandInto(RedisModuleCtx *ctx, Graph *g, const char *graph_name, Node **src_node,
+ExpandInto* NewExpandInto(RedisModuleCtx *ctx, Graph *g, GraphContext *gc, Node **src_node,
                           Edge **relation, Node **dest_node);
 
 /* ExpandIntoConsume next operation 
- * Returns OP_OK if there's a connection between source and dest nodes
+ * Returns OP_OK once per edge connecting source and dest nodes
  * OP_DEPLETED is returned when there's no more data to work with. */
 OpResult ExpandIntoConsume(OpBase *opBase, Graph* graph);
 
@@ -0,0 +1,182 @@
+#include "op_expand_var_len.h"
+
+void _NodeSet_Push(NodeSet *set, Node *n) {
+    if(set->len == set->cap) {
+        set->cap = (set->cap > 0) ? set->cap * 2 : 16;
+        set->nodes = realloc(set->nodes, sizeof(Node*) * set->cap);
+    }
+    set->nodes[set->len++] = n;
+}
+
+int _NodeSet_Compare(const void *a, const void *b) {
+    long int idA = (*(Node**)a)->id;
+    long int idB = (*(Node**)b)->id;
+    return (idA > idB) - (idA < idB);
+}
+
+/* Sorts set by node id, dropping duplicates. */
+void _NodeSet_SortUnique(NodeSet *set) {
+    if(set->len < 2) return;
+    qsort(set->nodes, set->len, sizeof(Node*), _NodeSet_Compare);
+
+    size_t j = 0;
+    for(size_t i = 1; i < set->len; i++) {
+        if(set->nodes[i] != set->nodes[j]) set->nodes[++j] = set->nodes[i];
+    }
+    set->len = j + 1;
+}
+
+/* Removes from a every node within b, both sets are sorted. */
+void _NodeSet_Difference(NodeSet *a, const NodeSet *b) {
+    size_t i = 0;
+    size_t j = 0;
+    size_t len = 0;
+
+    while(i < a->len) {
+        while(j < b->len && b->nodes[j]->id < a->nodes[i]->id) j++;
+        if(j < b->len && b->nodes[j] == a->nodes[i]) {
+            i++;
+        } else {
+            a->nodes[len++] = a->nodes[i++];
+        }
+    }
+    a->len = len;
+}
+
+/* Merges sorted, disjoint sets a and b into out. */
+void _NodeSet_Merge(const NodeSet *a, const NodeSet *b, NodeSet *out) {
+    size_t i = 0;
+    size_t j = 0;
+    out->len = 0;
+
+    while(i < a->len && j < b->len) {
+        if(a->nodes[i]->id < b->nodes[j]->id) _NodeSet_Push(out, a->nodes[i++]);
+        else _NodeSet_Push(out, b->nodes[j++]);
+    }
+    while(i < a->len) _NodeSet_Push(out, a->nodes[i++]);
+    while(j < b->len) _NodeSet_Push(out, b->nodes[j++]);
+}
+
+void _NodeSet_Swap(NodeSet *a, NodeSet *b) {
+    NodeSet tmp = *a;
+    *a = *b;
+    *b = tmp;
+}
+
+OpBase* NewExpandVarLenOp(RedisModuleCtx *ctx, Graph *g, Node **src_node, Edge **relation,
+                          Node **dest_node, int minHops, int maxHops) {
+
+    return (OpBase*)NewExpandVarLen(ctx, g, src_node, relation, dest_node, minHops, maxHops);
+}
+
+ExpandVarLen* NewExpandVarLen(RedisModuleCtx *ctx, Graph *g, Node **src_node, Edge **relation,
+                              Node **dest_node, int minHops, int maxHops) {
+
+    ExpandVarLen *expand = calloc(1, sizeof(ExpandVarLen));
+
+    expand->ctx = ctx;
+    expand->src_node = src_node;
+    expand->dest_node = dest_node;
+    expand->_dest_node = *dest_node;
+    expand->relation = (*relation)->relationship;
+    expand->minHops = minHops;
+    expand->maxHops = maxHops;
+    expand->state = ExpandVarLenUninitialized;
+
+    // Set our Op operations
+    expand->op.name = "Expand Variable Length";
+    expand->op.type = OPType_EXPAND_VAR_LEN;
+    expand->op.consume = ExpandVarLenConsume;
+    expand->op.reset = ExpandVarLenReset;
+    expand->op.free = ExpandVarLenFree;
+    expand->op.modifies = NewVector(char*, 1);
+
+    /* Source node is set by child operations,
+     * the link itself is not bound to any single edge. */
+    Vector_Push(expand->op.modifies, Graph_GetNodeAlias(g, *dest_node));
+
+    return expand;
+}
+
+/* Collects every node reachable from src within hop bounds. */
+void _ExpandVarLen_Traverse(ExpandVarLen *op, Node *src) {
+    op->reached.len = 0;
+    op->frontier.len = 0;
+    _NodeSet_Push(&op->frontier, src);
+    if(op->minHops == 0) _NodeSet_Push(&op->reached, src);
+
+    for(int level = 1; op->frontier.len > 0; level++) {
+        if(op->maxHops != AST_LINK_UNBOUNDED && level > op->maxHops) break;
+
+        /* Expand frontier by a single hop. */
+        op->next.len = 0;
+        for(size_t i = 0; i < op->frontier.len; i++) {
+            Vector *edges = op->frontier.nodes[i]->outgoingEdges;
+            for(int j = 0; j < Vector_Size(edges); j++) {
+                Edge *e;
+                Vector_Get(edges, j, &e);
+                if(op->relation && strcmp(e->relationship, op->relation) != 0) continue;
+                _NodeSet_Push(&op->next, e->dest);
+            }
+        }
+        _NodeSet_SortUnique(&op->next);
+
+        /* Once within bounds, nodes already reached are not expanded again,
+         * whatever they lead to is already reached as well,
+         * this guarantees termination for unbounded links. */
+        if(level >= op->minHops) {
+            _NodeSet_Difference(&op->next, &op->reached);
+            _NodeSet_Merge(&op->reached, &op->next, &op->merged);
+            _NodeSet_Swap(&op->reached, &op->merged);
+        }
+
+        _NodeSet_Swap(&op->frontier, &op->next);
+    }
+
+    op->reachedIdx = 0;
+}
+
+OpResult ExpandVarLenConsume(OpBase *opBase, Graph* graph) {
+    ExpandVarLen *op = (ExpandVarLen*)opBase;
+
+    if(op->state == ExpandVarLenUninitialized) {
+        return OP_REFRESH;
+    }
+
+    /* State reseted, traverse from new source node. */
+    if(op->state == ExpandVarLenResetted) {
+        _ExpandVarLen_Traverse(op, *op->src_node);
+        op->state = ExpandVarLenConsuming;
+    }
+
+    const char *label = op->_dest_node->label;
+    while(op->reachedIdx < op->reached.len) {
+        Node *n = op->reached.nodes[op->reachedIdx++];
+        /* Intermediate nodes may have any label, reached node must match. */
+        if(label && (n->label == NULL || strcmp(n->label, label) != 0)) continue;
+
+        *op->dest_node = n;
+        return OP_OK;
+    }
+
+    return OP_REFRESH;
+}
+
+OpResult ExpandVarLenReset(OpBase *ctx) {
+    ExpandVarLen *op = (ExpandVarLen*)ctx;
+    *op->dest_node = op->_dest_node;
+    op->reached.len = 0;
+    op->reachedIdx = 0;
+    op->state = ExpandVarLenResetted;   /* Mark reset. */
+    return OP_OK;
+}
+
+void ExpandVarLenFree(OpBase *ctx) {
+    ExpandVarLen *op = (ExpandVarLen*)ctx;
+    free(op->frontier.nodes);
+    free(op->next.nodes);
+    free(op->reached.nodes);
+    free(op->merged.nodes);
+    Vector_Free(op->op.modifies);
+    free(op);
+}
@@ -0,0 +1,64 @@
+#ifndef __OP_EXPAND_VAR_LEN_H
+#define __OP_EXPAND_VAR_LEN_H
+
+#include "op.h"
+#include "../../parser/ast.h"
+#include "../../graph_context/graph_context.h"
+
+/* ExpandVarLenStates
+ * Different states in which ExpandVarLen can be at. */
+typedef enum {
+    ExpandVarLenUninitialized,  /* ExpandVarLen wasn't initialized it. */
+    ExpandVarLenResetted,       /* ExpandVarLen was just restarted. */
+    ExpandVarLenConsuming,      /* ExpandVarLen consuming data. */
+} ExpandVarLenStates;
+
+/* NodeSet
+ * Growable array of nodes, kept sorted by node id
+ * once a traversal level is complete. */
+typedef struct {
+    Node **nodes;
+    size_t len;
+    size_t cap;
+} NodeSet;
+
+/* ExpandVarLen
+ * Expands a variable length link -[:type*min..max]->,
+ * traversing the graph level by level from source node,
+ * each node reachable within [min, max] hops is set once. */
+typedef struct {
+    OpBase op;
+    Node **src_node;            /* Source node to expand, set by child op. */
+    Node **dest_node;           /* Reached node. */
+    Node *_dest_node;           /* Original destination node. */
+    char *relation;             /* Relationship type to follow, NULL for any type. */
+    int minHops;                /* Minimum number of hops. */
+    int maxHops;                /* Maximum number of hops, AST_LINK_UNBOUNDED if unbounded. */
+    RedisModuleCtx *ctx;        /* Redis context. */
+    NodeSet frontier;           /* Nodes reached at current level. */
+    NodeSet next;               /* Nodes reached at next level. */
+    NodeSet reached;            /* Nodes reached within hop bounds. */
+    NodeSet merged;             /* Scratch space for merging levels into reached. */
+    size_t reachedIdx;          /* Next reached node to set. */
+    ExpandVarLenStates state;   /* Operation current state. */
+} ExpandVarLen;
+
+/* Creates a new ExpandVarLen operation */
+OpBase* NewExpandVarLenOp(RedisModuleCtx *ctx, Graph *g, Node **src_node, Edge **relation,
+                          Node **dest_node, int minHops, int maxHops);
+
+ExpandVarLen* NewExpandVarLen(RedisModuleCtx *ctx, Graph *g, Node **src_node, Edge **relation,
+                              Node **dest_node, int minHops, int maxHops);
+
+/* ExpandVarLenConsume next operation
+ * each call sets the next node reachable from source
+ * returns OP_REFRESH when source node is exhausted. */
+OpResult ExpandVarLenConsume(OpBase *opBase, Graph* graph);
+
+/* Restart operation */
+OpResult ExpandVarLenReset(OpBase *ctx);
+
+/* Frees ExpandVarLen */
+void ExpandVarLenFree(OpBase *ctx);
+
+#endif
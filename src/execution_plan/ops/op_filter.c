@@ -1,12 +1,13 @@
 #include "op_filter.h"
 
-OpBase* NewFilterOp(FT_FilterNode *filterTree) {
-    return (OpBase*)NewFilter(filterTree);
+OpBase* NewFilterOp(const Graph *g, FT_FilterNode *filterTree) {
+    return (OpBase*)NewFilter(g, filterTree);
 }
 
-Filter* NewFilter(FT_FilterNode *filterTree) {
+Filter* NewFilter(const Graph *g, FT_FilterNode *filterTree) {
     Filter *filter = malloc(sizeof(Filter));
     filter->filterTree = filterTree;
+    filter->program = FilterProgram_Compile(filterTree, g);
     filter->state = FilterUninitialized;
 
     // Set our Op operations
@@ -29,8 +30,8 @@ OpResult FilterConsume(OpBase *opBase, Graph* graph) {
         return OP_REFRESH;
     }
 
-    /* Pass graph through filter tree */
-    int pass = applyFilters(graph, filter->filterTree);
+    /* Pass graph through compiled filter tree */
+    int pass = FilterProgram_Apply(filter->program, graph);
 
     filter->state = FilterRequestRefresh;
 
@@ -50,6 +51,7 @@ OpResult FilterReset(OpBase *ctx) {
 /* Frees Filter*/
 void FilterFree(OpBase *ctx) {
     Filter *filter = (Filter*)ctx;
-    FilterTree_Free(filter->filterTree);
+    /* Program owns filter tree. */
+    FilterProgram_Free(filter->program);
     free(filter);
 }
\ No newline at end of file
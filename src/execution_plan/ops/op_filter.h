@@ -3,6 +3,7 @@
 
 #include "op.h"
 #include "../../filter_tree/filter_tree.h"
+#include "../../filter_tree/filter_program.h"
 
 /* FilterState 
  * Different states in which ExpandAll can be at. */
@@ -17,12 +18,13 @@ typedef enum {
 typedef struct {
     OpBase op;
     FT_FilterNode *filterTree;
+    FilterProgram *program;     /* filterTree compiled against the query graph. */
     FilterState state;
 } Filter;
 
 /* Creates a new Filter operation */
-OpBase* NewFilterOp(FT_FilterNode *filterTree);
-Filter* NewFilter(FT_FilterNode *filterTree);
+OpBase* NewFilterOp(const Graph *g, FT_FilterNode *filterTree);
+Filter* NewFilter(const Graph *g, FT_FilterNode *filterTree);
 
 /* FilterConsume next operation 
  * returns OP_DEPLETED when */
@@ -0,0 +1,142 @@
+#include <assert.h>
+#include <stdint.h>
+#include "op_hash_join.h"
+
+OpBase* NewHashJoinOp() {
+    return (OpBase*)NewHashJoin();
+}
+
+HashJoin* NewHashJoin() {
+    HashJoin *hashJoin = calloc(1, sizeof(HashJoin));
+    hashJoin->state = HashJoinUninitialized;
+
+    // Set our Op operations
+    hashJoin->op.name = "Hash Join";
+    hashJoin->op.type = OPType_HASH_JOIN;
+    hashJoin->op.consume = HashJoinConsume;
+    hashJoin->op.reset = HashJoinReset;
+    hashJoin->op.free = HashJoinFree;
+    hashJoin->op.modifies = NULL;
+
+    return hashJoin;
+}
+
+int _HashJoin_ContainsSlot(const int *slots, int count, int slot) {
+    for(int i = 0; i < count; i++) {
+        if(slots[i] == slot) return 1;
+    }
+    return 0;
+}
+
+void HashJoinBindStreams(HashJoin *op, Graph *g, OpNode *probe, OpNode *build, const int *required) {
+    int *probeSlots;
+    int *buildSlots;
+    int probeCount = ExecutionPlan_StreamSlots(probe, g, &probeSlots);
+    int buildCount = ExecutionPlan_StreamSlots(build, g, &buildSlots);
+
+    /* Captured build slots, shared ones first. */
+    int *slots = malloc(sizeof(int) * buildCount);
+    op->joinSlots = malloc(sizeof(int) * buildCount);
+    op->joinSlotCount = 0;
+    int width = 0;
+    for(int i = 0; i < buildCount; i++) {
+        if(_HashJoin_ContainsSlot(probeSlots, probeCount, buildSlots[i])) {
+            op->joinSlots[op->joinSlotCount++] = buildSlots[i];
+        }
+    }
+    for(int i = 0; i < op->joinSlotCount; i++) slots[width++] = op->joinSlots[i];
+    for(int i = 0; i < buildCount; i++) {
+        if(required[buildSlots[i]] && !_HashJoin_ContainsSlot(op->joinSlots, op->joinSlotCount, buildSlots[i])) {
+            slots[width++] = buildSlots[i];
+        }
+    }
+    assert(op->joinSlotCount > 0);
+
+    MaterializedStream_Init(&op->build, build, g, slots, width);
+    free(probeSlots);
+    free(buildSlots);
+}
+
+static inline unsigned int _HashJoin_Bucket(const HashJoin *op, long int id) {
+    return (unsigned int)(((uint64_t)id * 0x9E3779B97F4A7C15ULL) >> 32) & op->bucketMask;
+}
+
+/* Materializes build stream and hashes its records
+ * by the id of their first shared entity. */
+OpResult _HashJoin_Build(HashJoin *op) {
+    if(MaterializedStream_Fill(&op->build) != OP_OK) return OP_ERR;
+
+    size_t count = op->build.count;
+    unsigned int bucketCount = 16;
+    while(bucketCount < count * 2) bucketCount <<= 1;
+    op->bucketMask = bucketCount - 1;
+    op->buckets = realloc(op->buckets, sizeof(int) * bucketCount);
+    op->chain = realloc(op->chain, sizeof(int) * (count + 1));
+    memset(op->buckets, -1, sizeof(int) * bucketCount);
+
+    /* Insert in reverse, such that chains follow build order. */
+    for(int i = (int)count - 1; i >= 0; i--) {
+        unsigned int b = _HashJoin_Bucket(op, MaterializedStream_Get(&op->build, i, 0)->id);
+        op->chain[i] = op->buckets[b];
+        op->buckets[b] = i;
+    }
+    return OP_OK;
+}
+
+/* Checks if every shared entity of build record matches probe record. */
+static inline int _HashJoin_Match(const HashJoin *op, const Graph *g, int record) {
+    for(int i = 0; i < op->joinSlotCount; i++) {
+        GraphEntity *e = Graph_GetEntityBySlot(g, op->joinSlots[i]);
+        if(e->id != MaterializedStream_Get(&op->build, record, i)->id) return 0;
+    }
+    return 1;
+}
+
+OpResult HashJoinConsume(OpBase *opBase, Graph* graph) {
+    HashJoin *op = (HashJoin*)opBase;
+
+    if(op->state == HashJoinUninitialized) {
+        /* Materialize build stream before pulling from probe stream,
+         * whose bindings would otherwise restrict build stream ops. */
+        if(_HashJoin_Build(op) != OP_OK) return OP_ERR;
+        op->state = HashJoinResetted;
+        return OP_REFRESH;
+    }
+
+    /* No record to join probe records with. */
+    if(op->build.count == 0) return OP_DEPLETED;
+
+    if(op->state == HashJoinResetted) {
+        GraphEntity *key = Graph_GetEntityBySlot(graph, op->joinSlots[0]);
+        op->current = op->buckets[_HashJoin_Bucket(op, key->id)];
+        op->state = HashJoinConsuming;
+    }
+
+    while(op->current != -1) {
+        int record = op->current;
+        op->current = op->chain[record];
+        if(_HashJoin_Match(op, graph, record)) {
+            /* Shared entities are already bound by probe stream. */
+            MaterializedStream_Bind(&op->build, record, op->joinSlotCount);
+            return OP_OK;
+        }
+    }
+
+    return OP_REFRESH;
+}
+
+OpResult HashJoinReset(OpBase *ctx) {
+    HashJoin *op = (HashJoin*)ctx;
+    MaterializedStream_Restore(&op->build, op->joinSlotCount);
+    if(op->state != HashJoinUninitialized) op->state = HashJoinResetted;
+    return OP_OK;
+}
+
+void HashJoinFree(OpBase *ctx) {
+    HashJoin *op = (HashJoin*)ctx;
+    MaterializedStream_Free(&op->build);
+    free(op->joinSlots);
+    free(op->buckets);
+    free(op->chain);
+    free(op);
+}
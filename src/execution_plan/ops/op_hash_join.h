@@ -0,0 +1,45 @@
+#ifndef __OP_HASH_JOIN_H__
+#define __OP_HASH_JOIN_H__
+
+#include "op.h"
+#include "../materialized_stream.h"
+
+/* HashJoinStates
+ * Different states in which HashJoin can be at. */
+typedef enum {
+    HashJoinUninitialized,  /* Build stream wasn't materialized yet. */
+    HashJoinResetted,       /* New probe record was just pulled. */
+    HashJoinConsuming,      /* Pairing probe record with matching build records. */
+} HashJoinStates;
+
+/* HashJoin
+ * Joins its probe stream (first child) with its build stream (second child)
+ * on the ids of the entities both streams bind.
+ * Build stream is materialized once and hashed by the id of the first
+ * shared entity, each probe record is then paired with the build records
+ * found under its own entity id. */
+typedef struct {
+    OpBase op;
+    MaterializedStream build;   /* Build stream records, shared slots lead each record. */
+    int *joinSlots;             /* Slots bound by both streams. */
+    int joinSlotCount;
+    int *buckets;               /* First build record per bucket, -1 if empty. */
+    int *chain;                 /* Next build record sharing bucket, per record. */
+    unsigned int bucketMask;
+    int current;                /* Next build record to check against probe record. */
+    HashJoinStates state;
+} HashJoin;
+
+OpBase* NewHashJoinOp();
+HashJoin* NewHashJoin();
+
+/* Binds op to its streams, once plan is final.
+ * Streams must share at least one bound entity, build entities
+ * are captured only if their slot is marked within required. */
+void HashJoinBindStreams(HashJoin *op, Graph *g, OpNode *probe, OpNode *build, const int *required);
+
+OpResult HashJoinConsume(OpBase *opBase, Graph* graph);
+OpResult HashJoinReset(OpBase *ctx);
+void HashJoinFree(OpBase *ctx);
+
+#endif
@@ -0,0 +1,105 @@
+#include "op_metadata_count.h"
+#include "op_aggregate.h"
+#include "../../aggregate/aggregate.h"
+#include "../../query_executor.h"
+
+OpBase *NewMetadataCountOp(RedisModuleCtx *ctx, Graph *g, GraphContext *gc, AST_QueryExpressionNode *ast,
+                           MetadataCountType t, Node *node, Edge *relation) {
+    return (OpBase*)NewMetadataCount(ctx, g, gc, ast, t, node, relation);
+}
+
+MetadataCount* NewMetadataCount(RedisModuleCtx *ctx, Graph *g, GraphContext *gc, AST_QueryExpressionNode *ast,
+                                MetadataCountType t, Node *node, Edge *relation) {
+    MetadataCount *metadataCount = malloc(sizeof(MetadataCount));
+    metadataCount->ctx = ctx;
+    metadataCount->gc = gc;
+    metadataCount->ast = ast;
+    metadataCount->slots = ReturnClause_BindSlots(ast->returnNode, g);
+    metadataCount->t = t;
+    metadataCount->_node = node;
+    metadataCount->node = (node) ? Graph_GetNodeRef(g, node) : NULL;
+    metadataCount->_relation = relation;
+    metadataCount->outgoing = (relation && relation->src == node);
+    metadataCount->init = 0;
+    metadataCount->refreshAfterPass = 0;
+
+    // Set our Op operations
+    metadataCount->op.name = "Metadata Count";
+    metadataCount->op.type = OPType_METADATA_COUNT;
+    metadataCount->op.consume = MetadataCountConsume;
+    metadataCount->op.reset = MetadataCountReset;
+    metadataCount->op.free = MetadataCountFree;
+    metadataCount->op.modifies = NULL;
+    return metadataCount;
+}
+
+/* Adds count to count function's group, groups are only
+ * introduced by non-zero counts, as if records were aggregated. */
+static void _MetadataCount_Add(MetadataCount *op, const Graph *g, size_t count) {
+    if(count == 0) return;
+
+    Group *group = Aggregate_GetGroup(op->ctx, op->ast->returnNode, g, op->slots);
+    AggCtx *funcCtx;
+    Vector_Get(group->aggregationFunctions, 0, &funcCtx);
+    Agg_StepRepeat(funcCtx, NULL, 0, count);
+}
+
+/* Number of edges matching pattern edge at bound node. */
+static size_t _MetadataCount_Degree(const MetadataCount *op) {
+    const Node *n = *op->node;
+    const char *relation = op->_relation->relationship;
+
+    /* Untyped edges match edges of any type. */
+    if(relation == NULL) {
+        return Vector_Size(op->outgoing ? n->outgoingEdges : n->incomingEdges);
+    }
+
+    int first;
+    return Node_EdgeRun(n, op->outgoing, relation, &first);
+}
+
+OpResult MetadataCountConsume(OpBase *opBase, Graph* graph) {
+    MetadataCount *op = (MetadataCount*)opBase;
+
+    if(op->t != METADATA_COUNT_DEGREE) {
+        /* Whole count is accounted for by a single pass. */
+        if(op->init) return OP_DEPLETED;
+        op->init = 1;
+
+        size_t count;
+        if(op->t == METADATA_COUNT_NODES) {
+            count = GraphContext_LabelCardinality(op->gc, op->_node->label);
+        } else {
+            count = GraphContext_EdgeCount(op->gc, op->_relation->src->label,
+                                           op->_relation->relationship, op->_relation->dest->label);
+        }
+        if(count == 0) return OP_DEPLETED;
+
+        _MetadataCount_Add(op, graph, count);
+        return OP_OK;
+    }
+
+    if(!op->init) {
+        op->init = 1;
+        return OP_REFRESH;
+    }
+
+    if(op->refreshAfterPass == 1) {
+        op->refreshAfterPass = 0;
+        return OP_REFRESH;
+    }
+
+    _MetadataCount_Add(op, graph, _MetadataCount_Degree(op));
+    op->refreshAfterPass = 1;
+    return OP_OK;
+}
+
+OpResult MetadataCountReset(OpBase *opBase) {
+    return OP_OK;
+}
+
+void MetadataCountFree(OpBase *opBase) {
+    MetadataCount *op = (MetadataCount*)opBase;
+    free(op->slots);
+    free(op);
+}
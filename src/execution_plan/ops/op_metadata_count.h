@@ -0,0 +1,55 @@
+#ifndef __OP_METADATA_COUNT_H
+#define __OP_METADATA_COUNT_H
+
+#include "op.h"
+#include "../../parser/ast.h"
+#include "../../redismodule.h"
+#include "../../graph/graph.h"
+#include "../../graph/node.h"
+#include "../../graph/edge.h"
+#include "../../graph_context/graph_context.h"
+
+typedef enum {
+    METADATA_COUNT_NODES,   /* Nodes of a label, from its bitmap. */
+    METADATA_COUNT_EDGES,   /* Edges of a type between labels, from edge statistics. */
+    METADATA_COUNT_DEGREE,  /* Edges of a type at each node bound by child stream. */
+} MetadataCountType;
+
+typedef struct {
+    OpBase op;
+    MetadataCountType t;
+    Node *_node;            /* Pattern node counted, or whose edges are counted. */
+    Node **node;            /* Node bound by child stream, degree counts only. */
+    Edge *_relation;        /* Pattern edge counted. */
+    int outgoing;           /* Are node's outgoing edges counted. */
+    RedisModuleCtx *ctx;
+    GraphContext *gc;       /* queried graph */
+    AST_QueryExpressionNode *ast;
+    int *slots;             /* Return elements binding slots. */
+    int init;
+    int refreshAfterPass;
+} MetadataCount;
+
+/* MetadataCount
+ * Answers RETURN count(*) without enumerating the counted pattern,
+ * counting nodes by label cardinality, edges by edge statistics,
+ * or edges at each node bound by its child by adjacency list runs.
+ * Takes the place of the aggregate op, feeding the count function's
+ * group directly. */
+OpBase *NewMetadataCountOp(RedisModuleCtx *ctx, Graph *g, GraphContext *gc, AST_QueryExpressionNode *ast,
+                           MetadataCountType t, Node *node, Edge *relation);
+
+MetadataCount* NewMetadataCount(RedisModuleCtx *ctx, Graph *g, GraphContext *gc, AST_QueryExpressionNode *ast,
+                                MetadataCountType t, Node *node, Edge *relation);
+
+/* MetadataCount next operation,
+ * accounts for the whole count at once, or for a single bound node. */
+OpResult MetadataCountConsume(OpBase *opBase, Graph* graph);
+
+/* Restart */
+OpResult MetadataCountReset(OpBase *ctx);
+
+/* Frees MetadataCount */
+void MetadataCountFree(OpBase *ctx);
+
+#endif
@@ -0,0 +1,365 @@
+#include <string.h>
+#include "op_multiway_join.h"
+
+/* Level at which n is bound, -1 if it isn't among the first count ones. */
+static int _MJ_Level(Node **order, int count, const Node *n) {
+    for(int i = 0; i < count; i++) {
+        if(order[i] == n) return i;
+    }
+    return -1;
+}
+
+/* Number of pattern edges connecting n to the first count ordered nodes. */
+static int _MJ_Connections(const Node *n, Node **order, int count) {
+    Edge *e;
+    int connections = 0;
+    for(int i = 0; i < Vector_Size(n->outgoingEdges); i++) {
+        Vector_Get(n->outgoingEdges, i, &e);
+        if(_MJ_Level(order, count, e->dest) >= 0) connections++;
+    }
+    for(int i = 0; i < Vector_Size(n->incomingEdges); i++) {
+        Vector_Get(n->incomingEdges, i, &e);
+        if(_MJ_Level(order, count, e->src) >= 0) connections++;
+    }
+    return connections;
+}
+
+/* Orders nodes for binding, starting with the node having the fewest
+ * candidates, each following node is the one most connected to the nodes
+ * ordered ahead of it, ties are broken by candidates count. */
+static void _MJ_Order(GraphContext *gc, Node **nodes, int nodeCount, Node **order) {
+    Node **pending = malloc(sizeof(Node*) * nodeCount);
+    memcpy(pending, nodes, sizeof(Node*) * nodeCount);
+    int pendingCount = nodeCount;
+
+    for(int k = 0; k < nodeCount; k++) {
+        int best = 0;
+        int bestConnections = -1;
+        int bestCardinality = 0;
+        for(int i = 0; i < pendingCount; i++) {
+            int connections = _MJ_Connections(pending[i], order, k);
+            int cardinality = GraphContext_LabelCardinality(gc, pending[i]->label);
+            if(connections > bestConnections ||
+               (connections == bestConnections && cardinality < bestCardinality)) {
+                best = i;
+                bestConnections = connections;
+                bestCardinality = cardinality;
+            }
+        }
+        order[k] = pending[best];
+        pending[best] = pending[--pendingCount];
+    }
+
+    free(pending);
+}
+
+static void _MJ_AddConstraint(MultiwayJoin *join, MJ_Level *level, Edge *e, int boundLevel, int outgoing) {
+    MJ_Constraint *c = &level->constraints[level->constraintCount++];
+    char *alias = Graph_GetEdgeAlias(join->g, e);
+    c->edgeSlot = Graph_GetAliasSlot(join->g, alias);
+    c->_edge = e;
+    c->level = boundLevel;
+    c->outgoing = outgoing;
+    c->relation = e->relationship;
+    Vector_Push(join->op.modifies, alias);
+}
+
+/* Sets up level k, constrained by the edges connecting
+ * its node to nodes bound at earlier levels. */
+static void _MJ_InitLevel(MultiwayJoin *join, Node **order, int k) {
+    MJ_Level *level = &join->levels[k];
+    Node *n = order[k];
+    char *alias = Graph_GetNodeAlias(join->g, n);
+    level->slot = Graph_GetAliasSlot(join->g, alias);
+    level->_node = n;
+    level->label = n->label;
+    Vector_Push(join->op.modifies, alias);
+
+    Edge *e;
+    int edgeCount = Vector_Size(n->outgoingEdges) + Vector_Size(n->incomingEdges);
+    level->constraints = malloc(sizeof(MJ_Constraint) * (edgeCount + 1));
+    level->constraintCount = 0;
+
+    /* (n)-[e]->(bound), n is found among bound's incoming edges. */
+    for(int i = 0; i < Vector_Size(n->outgoingEdges); i++) {
+        Vector_Get(n->outgoingEdges, i, &e);
+        int boundLevel = _MJ_Level(order, k, e->dest);
+        if(boundLevel >= 0) _MJ_AddConstraint(join, level, e, boundLevel, 0);
+    }
+    /* (bound)-[e]->(n), n is found among bound's outgoing edges. */
+    for(int i = 0; i < Vector_Size(n->incomingEdges); i++) {
+        Vector_Get(n->incomingEdges, i, &e);
+        int boundLevel = _MJ_Level(order, k, e->src);
+        if(boundLevel >= 0) _MJ_AddConstraint(join, level, e, boundLevel, 1);
+    }
+
+    level->lists = calloc(level->constraintCount + 1, sizeof(MJ_Neighbour*));
+    level->listLens = calloc(level->constraintCount + 1, sizeof(int));
+    level->listCaps = calloc(level->constraintCount + 1, sizeof(int));
+}
+
+OpBase* NewMultiwayJoinOp(Graph *g, GraphContext *gc, Node **nodes, int nodeCount) {
+    return (OpBase*)NewMultiwayJoin(g, gc, nodes, nodeCount);
+}
+
+MultiwayJoin* NewMultiwayJoin(Graph *g, GraphContext *gc, Node **nodes, int nodeCount) {
+    MultiwayJoin *multiwayJoin = calloc(1, sizeof(MultiwayJoin));
+    multiwayJoin->gc = gc;
+    multiwayJoin->g = g;
+    multiwayJoin->levels = calloc(nodeCount, sizeof(MJ_Level));
+    multiwayJoin->levelCount = nodeCount;
+    multiwayJoin->filter = NULL;
+
+    // Set our Op operations
+    multiwayJoin->op.name = "Multiway Join";
+    multiwayJoin->op.type = OPType_MULTIWAY_JOIN;
+    multiwayJoin->op.consume = MultiwayJoinConsume;
+    multiwayJoin->op.reset = MultiwayJoinReset;
+    multiwayJoin->op.free = MultiwayJoinFree;
+    multiwayJoin->op.modifies = NewVector(char*, nodeCount * 2);
+
+    Node **order = malloc(sizeof(Node*) * nodeCount);
+    _MJ_Order(gc, nodes, nodeCount, order);
+    for(int k = 0; k < nodeCount; k++) _MJ_InitLevel(multiwayJoin, order, k);
+    free(order);
+
+    return multiwayJoin;
+}
+
+/* Appends a candidate binding node to level,
+ * returns the slots for the edges binding it. */
+static Edge** _MJ_AddCandidate(MJ_Level *level, Node *node) {
+    if(level->count == level->cap) {
+        level->cap = (level->cap > 0) ? level->cap * 2 : 16;
+        level->nodes = realloc(level->nodes, sizeof(Node*) * level->cap);
+        level->edges = realloc(level->edges, sizeof(Edge*) * level->cap * (level->constraintCount + 1));
+    }
+    level->nodes[level->count] = node;
+    return level->edges + (level->count++) * level->constraintCount;
+}
+
+static int _MJ_CompareNeighbours(const void *a, const void *b) {
+    long int x = ((const MJ_Neighbour*)a)->id;
+    long int y = ((const MJ_Neighbour*)b)->id;
+    return (x > y) - (x < y);
+}
+
+/* Collects the neighbours bound node reaches through edges satisfying c,
+ * sorted by id, returns their count. */
+static int _MJ_CollectNeighbours(MultiwayJoin *join, MJ_Level *level, int i) {
+    MJ_Constraint *c = &level->constraints[i];
+    Node *bound = (Node*)Graph_GetEntityBySlot(join->g, join->levels[c->level].slot);
+    Vector *edges = c->outgoing ? bound->outgoingEdges : bound->incomingEdges;
+
+    /* Edges are sorted by type then neighbour id, a typed constraint's
+     * neighbours are already in order, others require sorting. */
+    int first = 0;
+    int count = Vector_Size(edges);
+    if(c->relation) count = Node_EdgeRun(bound, c->outgoing, c->relation, &first);
+
+    int len = 0;
+    for(int j = first; j < first + count; j++) {
+        Edge *e;
+        Vector_Get(edges, j, &e);
+
+        if(len == level->listCaps[i]) {
+            level->listCaps[i] = (len > 0) ? len * 2 : 16;
+            level->lists[i] = realloc(level->lists[i], sizeof(MJ_Neighbour) * level->listCaps[i]);
+        }
+        MJ_Neighbour *neighbour = &level->lists[i][len++];
+        neighbour->node = c->outgoing ? e->dest : e->src;
+        neighbour->id = neighbour->node->id;
+        neighbour->edge = e;
+    }
+
+    if(!c->relation) qsort(level->lists[i], len, sizeof(MJ_Neighbour), _MJ_CompareNeighbours);
+    level->listLens[i] = len;
+    return len;
+}
+
+/* Position of the first neighbour at or past from having id no smaller than id,
+ * probes exponentially growing distances before searching in between. */
+static int _MJ_Seek(const MJ_Neighbour *list, int len, int from, long int id) {
+    int lo = from;
+    int hi = from;
+    int step = 1;
+    while(hi < len && list[hi].id < id) {
+        lo = hi + 1;
+        hi += step;
+        step <<= 1;
+    }
+    if(hi > len) hi = len;
+
+    while(lo < hi) {
+        int mid = lo + (hi - lo) / 2;
+        if(list[mid].id < id) lo = mid + 1;
+        else hi = mid;
+    }
+    return lo;
+}
+
+/* Adds node as a candidate once per combination of the
+ * parallel edges leading to it, runs are [start[i], end[i]). */
+static void _MJ_AddCombinations(MJ_Level *level, Node *node, const int *start, const int *end) {
+    int cc = level->constraintCount;
+    int idx[cc];
+    memcpy(idx, start, sizeof(int) * cc);
+
+    while(1) {
+        Edge **edges = _MJ_AddCandidate(level, node);
+        for(int i = 0; i < cc; i++) edges[i] = level->lists[i][idx[i]].edge;
+
+        /* Advance to next combination. */
+        int i = 0;
+        for(; i < cc; i++) {
+            if(++idx[i] < end[i]) break;
+            idx[i] = start[i];
+        }
+        if(i == cc) break;
+    }
+}
+
+/* Intersects level's neighbour lists, each common neighbour
+ * carrying level's label becomes a candidate. */
+static void _MJ_Intersect(MJ_Level *level) {
+    int cc = level->constraintCount;
+    int pos[cc];
+    int end[cc];
+    memset(pos, 0, sizeof(int) * cc);
+
+    while(1) {
+        long int id = level->lists[0][pos[0]].id;
+        for(int i = 1; i < cc; i++) {
+            if(level->lists[i][pos[i]].id > id) id = level->lists[i][pos[i]].id;
+        }
+
+        /* Move every list to id, lagging ones leap over their gap. */
+        int aligned = 1;
+        for(int i = 0; i < cc; i++) {
+            pos[i] = _MJ_Seek(level->lists[i], level->listLens[i], pos[i], id);
+            if(pos[i] == level->listLens[i]) return;
+            if(level->lists[i][pos[i]].id != id) aligned = 0;
+        }
+        if(!aligned) continue;
+
+        for(int i = 0; i < cc; i++) {
+            end[i] = pos[i];
+            while(end[i] < level->listLens[i] && level->lists[i][end[i]].id == id) end[i]++;
+        }
+
+        Node *node = level->lists[0][pos[0]].node;
+        if(level->label == NULL || (node->label && strcmp(node->label, level->label) == 0)) {
+            _MJ_AddCombinations(level, node, pos, end);
+        }
+
+        for(int i = 0; i < cc; i++) {
+            pos[i] = end[i];
+            if(pos[i] == level->listLens[i]) return;
+        }
+    }
+}
+
+/* Computes level k's candidates given the nodes bound at earlier levels. */
+static void _MJ_Fill(MultiwayJoin *join, int k) {
+    MJ_Level *level = &join->levels[k];
+    level->count = 0;
+    level->pos = 0;
+
+    if(level->constraintCount == 0) {
+        if(level->label == NULL) {
+            for(uint32_t idx = 0; idx < join->gc->node_count; idx++) {
+                _MJ_AddCandidate(level, GraphContext_GetNodeByIndex(join->gc, idx));
+            }
+            return;
+        }
+
+        uint32_t idx;
+        BitmapIterator iter;
+        Bitmap *bitmap = GraphContext_GetLabelBitmap(join->gc, level->label);
+        if(bitmap == NULL) return;
+        Bitmap_Iterate(bitmap, &iter);
+        while(BitmapIterator_Next(&iter, &idx)) _MJ_AddCandidate(level, GraphContext_GetNodeByIndex(join->gc, idx));
+        return;
+    }
+
+    for(int i = 0; i < level->constraintCount; i++) {
+        if(_MJ_CollectNeighbours(join, level, i) == 0) return;
+    }
+    _MJ_Intersect(level);
+}
+
+static void _MJ_Bind(MultiwayJoin *join, MJ_Level *level, int candidate) {
+    Graph_SetEntityBySlot(join->g, level->slot, (GraphEntity*)level->nodes[candidate]);
+    Edge **edges = level->edges + candidate * level->constraintCount;
+    for(int i = 0; i < level->constraintCount; i++) {
+        Graph_SetEntityBySlot(join->g, level->constraints[i].edgeSlot, (GraphEntity*)edges[i]);
+    }
+}
+
+OpResult MultiwayJoinConsume(OpBase *opBase, Graph* graph) {
+    MultiwayJoin *op = (MultiwayJoin*)opBase;
+
+    if(!op->started) {
+        op->started = 1;
+        op->depth = 0;
+        _MJ_Fill(op, 0);
+    }
+
+    /* Depth first, binding one level at a time. */
+    while(op->depth >= 0) {
+        MJ_Level *level = &op->levels[op->depth];
+        if(level->pos == level->count) {
+            op->depth--;
+            continue;
+        }
+
+        _MJ_Bind(op, level, level->pos++);
+        if(op->depth + 1 < op->levelCount) {
+            op->depth++;
+            _MJ_Fill(op, op->depth);
+            continue;
+        }
+
+        /* Skip matches failing embedded filter. */
+        if(op->filter == NULL || FilterProgram_Apply(op->filter, graph) == FILTER_PASS) {
+            return OP_OK;
+        }
+    }
+
+    return OP_DEPLETED;
+}
+
+OpResult MultiwayJoinReset(OpBase *ctx) {
+    MultiwayJoin *op = (MultiwayJoin*)ctx;
+
+    /* Restore original entities. */
+    for(int k = 0; k < op->levelCount; k++) {
+        MJ_Level *level = &op->levels[k];
+        Graph_SetEntityBySlot(op->g, level->slot, (GraphEntity*)level->_node);
+        for(int i = 0; i < level->constraintCount; i++) {
+            Graph_SetEntityBySlot(op->g, level->constraints[i].edgeSlot,
+                                  (GraphEntity*)level->constraints[i]._edge);
+        }
+    }
+
+    op->started = 0;
+    return OP_OK;
+}
+
+void MultiwayJoinFree(OpBase *ctx) {
+    MultiwayJoin *op = (MultiwayJoin*)ctx;
+    for(int k = 0; k < op->levelCount; k++) {
+        MJ_Level *level = &op->levels[k];
+        for(int i = 0; i < level->constraintCount; i++) free(level->lists[i]);
+        free(level->lists);
+        free(level->listLens);
+        free(level->listCaps);
+        free(level->constraints);
+        free(level->nodes);
+        free(level->edges);
+    }
+    free(op->levels);
+    FilterProgram_Free(op->filter);
+    Vector_Free(op->op.modifies);
+    free(op);
+}
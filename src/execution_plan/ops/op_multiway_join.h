@@ -0,0 +1,67 @@
+#ifndef __OP_MULTIWAY_JOIN_H__
+#define __OP_MULTIWAY_JOIN_H__
+
+#include "op.h"
+#include "../../graph/graph.h"
+#include "../../graph_context/graph_context.h"
+#include "../../filter_tree/filter_program.h"
+
+/* Edge connecting a pattern node to a node bound ahead of it. */
+typedef struct {
+    int edgeSlot;           /* Edge binding slot. */
+    Edge *_edge;            /* Edge placeholder. */
+    int level;              /* Level at which the other end is bound. */
+    int outgoing;           /* Other end's outgoing edges lead to node if set, incoming otherwise. */
+    const char *relation;   /* Required relationship, NULL for any. */
+} MJ_Constraint;
+
+/* Stored neighbour reached through edge. */
+typedef struct {
+    long int id;
+    Node *node;
+    Edge *edge;
+} MJ_Neighbour;
+
+/* Pattern node bound at a given depth of the join. */
+typedef struct {
+    int slot;                   /* Node binding slot. */
+    Node *_node;                /* Node placeholder. */
+    const char *label;          /* Required label, NULL for any. */
+    MJ_Constraint *constraints; /* Edges to nodes bound at earlier levels. */
+    int constraintCount;
+    MJ_Neighbour **lists;       /* Neighbour list per constraint, sorted by id. */
+    int *listLens;
+    int *listCaps;
+    Node **nodes;               /* Candidate bindings. */
+    Edge **edges;               /* Edges binding candidate, constraintCount per candidate. */
+    int count;                  /* Number of candidates. */
+    int cap;
+    int pos;                    /* Next candidate to bind. */
+} MJ_Level;
+
+/* MultiwayJoin
+ * Matches a cyclic pattern one node at a time, candidates for each node
+ * are the intersection of the neighbour lists of every bound node it
+ * connects to, such that partial matches which can't close the cycle
+ * are never produced, keeping the work within the worst case output
+ * size of the pattern. */
+typedef struct {
+    OpBase op;
+    GraphContext *gc;
+    Graph *g;
+    MJ_Level *levels;           /* Pattern nodes, in binding order. */
+    int levelCount;
+    int depth;                  /* Level currently enumerated, -1 once depleted. */
+    int started;
+    FilterProgram *filter;      /* embedded filter, NULL if none */
+} MultiwayJoin;
+
+/* Creates a join over the pattern formed by nodes and the edges among them. */
+OpBase* NewMultiwayJoinOp(Graph *g, GraphContext *gc, Node **nodes, int nodeCount);
+MultiwayJoin* NewMultiwayJoin(Graph *g, GraphContext *gc, Node **nodes, int nodeCount);
+
+OpResult MultiwayJoinConsume(OpBase *opBase, Graph* graph);
+OpResult MultiwayJoinReset(OpBase *ctx);
+void MultiwayJoinFree(OpBase *ctx);
+
+#endif
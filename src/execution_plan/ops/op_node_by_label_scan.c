@@ -1,25 +1,22 @@
 #include "op_node_by_label_scan.h"
 
 OpBase *NewNodeByLabelScanOp(RedisModuleCtx *ctx, Graph *g, Node **node,
-                            const char *graph_name, char *label) {
-    return (OpBase*)NewNodeByLabelScan(ctx, g, node, graph_name, label);
+                            GraphContext *gc, char *label) {
+    return (OpBase*)NewNodeByLabelScan(ctx, g, node, gc, label);
 }
 
 NodeByLabelScan* NewNodeByLabelScan(RedisModuleCtx *ctx, Graph *g, Node **node,
-                                    const char *graph_name, char *label) {
-    // Get graph store
-    Store *store = GetStore(ctx, STORE_NODE, graph_name, label);
-    if(store == NULL) {
-        return NULL;
-    }
-    
+                                    GraphContext *gc, char *label) {
     NodeByLabelScan *nodeByLabelScan = malloc(sizeof(NodeByLabelScan));
     nodeByLabelScan->ctx = ctx;
     nodeByLabelScan->node = node;
     nodeByLabelScan->_node = *node;
-    nodeByLabelScan->graph = graph_name;
-    nodeByLabelScan->store = store;
-    nodeByLabelScan->iter = Store_Search(store, "");
+    nodeByLabelScan->gc = gc;
+    /* Unknown labels match nothing, introducing the label
+     * invalidates cached plans holding this op. */
+    nodeByLabelScan->bitmap = GraphContext_GetLabelBitmap(gc, label);
+    if(nodeByLabelScan->bitmap) Bitmap_Iterate(nodeByLabelScan->bitmap, &nodeByLabelScan->iter);
+    nodeByLabelScan->filter = NULL;
     
 
     // Set our Op operations
@@ -38,20 +35,18 @@ NodeByLabelScan* NewNodeByLabelScan(RedisModuleCtx *ctx, Graph *g, Node **node,
 OpResult NodeByLabelScanConsume(OpBase *opBase, Graph* graph) {
     NodeByLabelScan *op = (NodeByLabelScan*)opBase;
 
-    if(op->iter == NULL) return OP_DEPLETED;
-
-    char *id;
-    tm_len_t idLen;
+    uint32_t idx;
+    if(op->bitmap == NULL) return OP_DEPLETED;
     
-    /* Update node */
-    Node **n = op->node;
-    int res = StoreIterator_Next(op->iter, &id, &idLen, (void**)op->node);
-
-    if(res == 0) {
-        return OP_DEPLETED;
-    } 
+    /* Update node, skipping nodes failing embedded filter. */
+    while(BitmapIterator_Next(&op->iter, &idx)) {
+        *op->node = GraphContext_GetNodeByIndex(op->gc, idx);
+        if(op->filter == NULL || FilterProgram_Apply(op->filter, graph) == FILTER_PASS) {
+            return OP_OK;
+        }
+    }
 
-    return OP_OK;
+    return OP_DEPLETED;
 }
 
 OpResult NodeByLabelScanReset(OpBase *ctx) {
@@ -59,19 +54,13 @@ OpResult NodeByLabelScanReset(OpBase *ctx) {
 
     /* Restore original node. */
     *nodeByLabelScan->node = nodeByLabelScan->_node;
-    
-    if(nodeByLabelScan->iter != NULL) {
-        StoreIterator_Free(nodeByLabelScan->iter);
-    }
-    
-    nodeByLabelScan->iter = Store_Search(nodeByLabelScan->store, "");
+    if(nodeByLabelScan->bitmap) Bitmap_Iterate(nodeByLabelScan->bitmap, &nodeByLabelScan->iter);
     return OP_OK;
 }
 
 void NodeByLabelScanFree(OpBase *op) {
     NodeByLabelScan *nodeByLabelScan = (NodeByLabelScan*)op;
-    if(nodeByLabelScan->iter != NULL) {
-        StoreIterator_Free(nodeByLabelScan->iter);
-    }
+    FilterProgram_Free(nodeByLabelScan->filter);
+    Vector_Free(nodeByLabelScan->op.modifies);
     free(nodeByLabelScan);
 }
\ No newline at end of file
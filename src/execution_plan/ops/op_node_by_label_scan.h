@@ -5,28 +5,31 @@
 #include "../../redismodule.h"
 #include "../../graph/graph.h"
 #include "../../graph/node.h"
-#include "../../stores/store.h"
+#include "../../util/bitmap.h"
+#include "../../graph_context/graph_context.h"
+#include "../../filter_tree/filter_program.h"
 /* NodeByLabelScan 
- * Scans entire label-store
- * Sets node id to current element within
- * the label store */
+ * Scans entire label bitmap
+ * Sets node to current element within
+ * the label bitmap */
 
 typedef struct {
     OpBase op;
     Node **node;            /* node being scanned */
     Node *_node;
-    Store *store;
+    Bitmap *bitmap;         /* label's nodes, NULL for an unknown label */
     RedisModuleCtx *ctx;
-    const char *graph;      /* queried graph id */
-    StoreIterator *iter;
+    GraphContext *gc;       /* queried graph */
+    BitmapIterator iter;
+    FilterProgram *filter;  /* embedded filter, NULL if none */
 } NodeByLabelScan;
 
 /* Creates a new NodeByLabelScan operation */
 OpBase *NewNodeByLabelScanOp(RedisModuleCtx *ctx, Graph *g, Node **node,
-                            const char *graph_name, char *label);
+                            GraphContext *gc, char *label);
 
 NodeByLabelScan* NewNodeByLabelScan(RedisModuleCtx *ctx, Graph *g, Node **node,
-                                    const char *graph_name, char *label);
+                                    GraphContext *gc, char *label);
 
 /* NodeByLabelScan next operation
  * called each time a new ID is required */
@@ -1,15 +1,18 @@
 #include "op_produce_results.h"
 #include "../../resultset/record.h"
+#include "../../query_executor.h"
 
-void NewProduceResultsOp(RedisModuleCtx *ctx, AST_QueryExpressionNode *ast, OpBase **op) {
-    *op = (OpBase *)NewProduceResults(ctx, ast);
+void NewProduceResultsOp(RedisModuleCtx *ctx, Graph *g, AST_QueryExpressionNode *ast, OpBase **op) {
+    *op = (OpBase *)NewProduceResults(ctx, g, ast);
 }
 
-ProduceResults* NewProduceResults(RedisModuleCtx *ctx, AST_QueryExpressionNode *ast) {
+ProduceResults* NewProduceResults(RedisModuleCtx *ctx, Graph *g, AST_QueryExpressionNode *ast) {
     ProduceResults *produceResults = malloc(sizeof(ProduceResults));
     produceResults->ctx = ctx;
     produceResults->ast = ast;
     produceResults->resultset = NULL;
+    produceResults->slots = (ast) ? ReturnClause_BindSlots(ast->returnNode, g) : NULL;
+    produceResults->propIdx = (ast) ? calloc(Vector_Size(ast->returnNode->returnElements), sizeof(int)) : NULL;
     produceResults->refreshAfterPass = 0;
     produceResults->init = 0;
 
@@ -42,11 +45,14 @@ OpResult ProduceResultsConsume(OpBase *opBase, Graph* graph) {
     
     /* TODO: remove condition. */
     if(!op->resultset->aggregated) {
-        /* Append to final result set. */
-        Record *r = Record_FromGraph(op->ctx, op->ast, graph);
-        if(ResultSet_AddRecord(op->resultset, r) == RESULTSET_FULL) {
+        /* Append to final result set, skip graphs missing a requested property. */
+        Record *r = Record_FromGraph(op->resultset->arena, op->ast, graph, op->slots, op->propIdx);
+        if(r && ResultSet_AddRecord(op->resultset, r) == RESULTSET_FULL) {
             return OP_ERR;
         }
+
+        /* Once LIMIT is reached there's no point in searching for another match. */
+        if(ResultSet_Full(op->resultset)) return OP_DEPLETED;
     }
 
     /* Request data refresh next time consume is called. */
@@ -62,6 +68,8 @@ OpResult ProduceResultsReset(OpBase *op) {
 /* Frees ProduceResults */
 void ProduceResultsFree(OpBase *op) {
     if(op != NULL) {
+        free(((ProduceResults*)op)->slots);
+        free(((ProduceResults*)op)->propIdx);
         free(op);
     }
 }
\ No newline at end of file
@@ -17,13 +17,15 @@ typedef struct {
     int refreshAfterPass;
     AST_QueryExpressionNode *ast;
     ResultSet *resultset;
+    int *slots;                     /* Return elements binding slots. */
+    int *propIdx;                   /* Return elements property index hints. */
     int init;
 } ProduceResults;
 
 
 /* Creates a new NodeByLabelScan operation */
-void NewProduceResultsOp(RedisModuleCtx *ctx, AST_QueryExpressionNode *ast, OpBase **op);
-ProduceResults* NewProduceResults(RedisModuleCtx *ctx, AST_QueryExpressionNode *ast);
+void NewProduceResultsOp(RedisModuleCtx *ctx, Graph *g, AST_QueryExpressionNode *ast, OpBase **op);
+ProduceResults* NewProduceResults(RedisModuleCtx *ctx, Graph *g, AST_QueryExpressionNode *ast);
 
 /* ProduceResults next operation
  * called each time a new result record is required */
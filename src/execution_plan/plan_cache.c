@@ -0,0 +1,156 @@
+#include <ctype.h>
+#include <string.h>
+#include <stdlib.h>
+
+#include "plan_cache.h"
+
+PlanCache *NewPlanCache(size_t capacity) {
+    PlanCache *cache = malloc(sizeof(PlanCache));
+    cache->entries = NewTrieMap();
+    cache->head = NULL;
+    cache->tail = NULL;
+    cache->size = 0;
+    cache->capacity = (capacity > 0) ? capacity : 1;
+    return cache;
+}
+
+char *PlanCache_NormalizeQuery(const char *query) {
+    size_t len = strlen(query);
+    char *normalized = malloc(sizeof(char) * (len + 1));
+    char quote = '\0';  /* Open string literal delimiter. */
+    size_t j = 0;
+
+    for(size_t i = 0; i < len; i++) {
+        char c = query[i];
+
+        if(quote) {
+            /* Within a string literal, copy as is. */
+            normalized[j++] = c;
+            if(c == '\\' && i + 1 < len) {
+                normalized[j++] = query[++i];
+            } else if(c == quote) {
+                quote = '\0';
+            }
+            continue;
+        }
+
+        if(isspace(c)) {
+            /* Collapse whitespace, skipping leading whitespace. */
+            if(j > 0 && normalized[j-1] != ' ') normalized[j++] = ' ';
+            continue;
+        }
+
+        if(c == '"' || c == '\'') quote = c;
+        normalized[j++] = c;
+    }
+
+    /* Drop trailing whitespace. */
+    if(j > 0 && normalized[j-1] == ' ' && !quote) j--;
+    normalized[j] = '\0';
+    return normalized;
+}
+
+/* Unlinks entry from the recently used list. */
+void _PlanCache_Unlink(PlanCache *cache, PlanCacheEntry *entry) {
+    if(entry->prev) entry->prev->next = entry->next;
+    else cache->head = entry->next;
+
+    if(entry->next) entry->next->prev = entry->prev;
+    else cache->tail = entry->prev;
+
+    entry->prev = NULL;
+    entry->next = NULL;
+}
+
+/* Links entry as the most recently used entry. */
+void _PlanCache_PushFront(PlanCache *cache, PlanCacheEntry *entry) {
+    entry->prev = NULL;
+    entry->next = cache->head;
+    if(cache->head) cache->head->prev = entry;
+    cache->head = entry;
+    if(cache->tail == NULL) cache->tail = entry;
+}
+
+void _PlanCache_FreeEntry(void *value) {
+    PlanCacheEntry *entry = (PlanCacheEntry*)value;
+    ExecutionPlanFree(entry->plan);
+    free(entry->query);
+    free(entry);
+}
+
+/* Evicts the least recently used entry. */
+void _PlanCache_Evict(PlanCache *cache) {
+    PlanCacheEntry *entry = cache->tail;
+    if(entry == NULL) return;
+
+    _PlanCache_Unlink(cache, entry);
+    TrieMap_Delete(cache->entries, entry->query, strlen(entry->query), _PlanCache_FreeEntry);
+    cache->size--;
+}
+
+ExecutionPlan *PlanCache_Get(PlanCache *cache, const char *query) {
+    size_t len = strlen(query);
+    if(len > PLAN_CACHE_MAX_QUERY_LEN) return NULL;
+
+    PlanCacheEntry *entry = TrieMap_Find(cache->entries, (char*)query, len);
+    if(entry == TRIEMAP_NOTFOUND) return NULL;
+
+    /* Mark as most recently used. */
+    if(cache->head != entry) {
+        _PlanCache_Unlink(cache, entry);
+        _PlanCache_PushFront(cache, entry);
+    }
+
+    return entry->plan;
+}
+
+int PlanCache_Add(PlanCache *cache, const char *query, ExecutionPlan *plan) {
+    size_t len = strlen(query);
+    if(len > PLAN_CACHE_MAX_QUERY_LEN) return 0;
+
+    /* Replace previously cached plan. */
+    PlanCacheEntry *entry = TrieMap_Find(cache->entries, (char*)query, len);
+    if(entry != TRIEMAP_NOTFOUND) {
+        _PlanCache_Unlink(cache, entry);
+        TrieMap_Delete(cache->entries, entry->query, len, _PlanCache_FreeEntry);
+        cache->size--;
+    }
+
+    if(cache->size >= cache->capacity) _PlanCache_Evict(cache);
+
+    entry = malloc(sizeof(PlanCacheEntry));
+    entry->query = strdup(query);
+    entry->plan = plan;
+    _PlanCache_PushFront(cache, entry);
+
+    TrieMap_Add(cache->entries, entry->query, len, entry, NULL);
+    cache->size++;
+    return 1;
+}
+
+void PlanCache_Remove(PlanCache *cache, const char *query) {
+    size_t len = strlen(query);
+    if(len > PLAN_CACHE_MAX_QUERY_LEN) return;
+
+    PlanCacheEntry *entry = TrieMap_Find(cache->entries, (char*)query, len);
+    if(entry == TRIEMAP_NOTFOUND) return;
+
+    _PlanCache_Unlink(cache, entry);
+    TrieMap_Delete(cache->entries, entry->query, len, _PlanCache_FreeEntry);
+    cache->size--;
+}
+
+void PlanCache_Clear(PlanCache *cache) {
+    if(cache->size == 0) return;
+
+    TrieMap_Free(cache->entries, _PlanCache_FreeEntry);
+    cache->entries = NewTrieMap();
+    cache->head = NULL;
+    cache->tail = NULL;
+    cache->size = 0;
+}
+
+void PlanCache_Free(PlanCache *cache) {
+    TrieMap_Free(cache->entries, _PlanCache_FreeEntry);
+    free(cache);
+}
@@ -0,0 +1,57 @@
+#ifndef __PLAN_CACHE_H__
+#define __PLAN_CACHE_H__
+
+#include <stdint.h>
+#include "execution_plan.h"
+#include "../util/triemap/triemap.h"
+
+#define PLAN_CACHE_DEFAULT_CAPACITY 128
+#define PLAN_CACHE_MAX_QUERY_LEN UINT16_MAX   /* Longest cacheable query. */
+
+/* PlanCacheEntry
+ * A single cached execution plan,
+ * entries are linked in most to least recently used order. */
+typedef struct PlanCacheEntry {
+    char *query;                    /* Normalized query text. */
+    ExecutionPlan *plan;            /* Parsed and optimized plan. */
+    struct PlanCacheEntry *prev;    /* More recently used entry. */
+    struct PlanCacheEntry *next;    /* Less recently used entry. */
+} PlanCacheEntry;
+
+/* PlanCache
+ * LRU cache of execution plans keyed by normalized query text,
+ * each graph holds its own cache. */
+typedef struct PlanCache {
+    TrieMap *entries;       /* Maps normalized query to its entry. */
+    PlanCacheEntry *head;   /* Most recently used entry. */
+    PlanCacheEntry *tail;   /* Least recently used entry. */
+    size_t size;            /* Number of cached plans. */
+    size_t capacity;        /* Maximum number of cached plans. */
+} PlanCache;
+
+/* Creates a new plan cache holding up to capacity plans. */
+PlanCache *NewPlanCache(size_t capacity);
+
+/* Returns a normalized copy of query, whitespace runs outside of
+ * string literals are collapsed into a single space and leading and
+ * trailing whitespace is removed, caller is responsible for freeing it. */
+char *PlanCache_NormalizeQuery(const char *query);
+
+/* Retrieves plan cached under normalized query, marking it as most recently used.
+ * Returns NULL if query is not cached. */
+ExecutionPlan *PlanCache_Get(PlanCache *cache, const char *query);
+
+/* Caches plan under normalized query, evicting the least recently
+ * used plan if cache is full, cache takes ownership of plan.
+ * Returns 1 if plan was cached, 0 if query is too long to be cached. */
+int PlanCache_Add(PlanCache *cache, const char *query, ExecutionPlan *plan);
+
+/* Drops the plan cached under normalized query, if any. */
+void PlanCache_Remove(PlanCache *cache, const char *query);
+
+/* Drops every cached plan. */
+void PlanCache_Clear(PlanCache *cache);
+
+void PlanCache_Free(PlanCache *cache);
+
+#endif
@@ -0,0 +1,607 @@
+#include <math.h>
+#include <string.h>
+#include "traversal_order.h"
+#include "../query_executor.h"
+#include "../parser/grammar.h"
+#include "../filter_tree/filter_normalize.h"
+
+/* Top level conjunct of the filter tree. */
+typedef struct {
+    int *nodes;             /* Component nodes conjunct refers to. */
+    int count;
+    double selectivity;
+} _TO_Conjunct;
+
+typedef struct {
+    const Graph *g;
+    GraphContext *gc;
+    Node **nodes;               /* Component's nodes. */
+    int count;
+    double *cardinality;        /* Label cardinality, per node. */
+    double allNodes;            /* Number of nodes within graph. */
+    Edge **edges;               /* Edges among component's nodes. */
+    int edgeCount;
+    int *src;                   /* Source node index, per edge. */
+    int *dest;                  /* Destination node index, per edge. */
+    AST_LinkEntity **links;     /* Variable length link, NULL for single hop edges. */
+    double *edgeSelectivity;    /* Chance edge connects a pair of candidates. */
+    double *typeCardinality;    /* Relationship type store size, per edge. */
+    _TO_Conjunct *conjuncts;
+    int conjunctCount;
+    int relaxed;                /* Drop variable length links which can't be followed. */
+} _TO_Ctx;
+
+/* Cheapest plan found for a set of nodes. */
+typedef struct {
+    double cost;
+    double rows;
+    TraversalStepType t;
+    int node;               /* Scanned or expanded node. */
+    int edge;               /* Binding or scanned edge. */
+    unsigned int input;     /* Expanded set, probe set of hash joins. */
+    unsigned int build;     /* Build set of hash joins. */
+} _TO_Entry;
+
+static int _TO_NodeIdx(const _TO_Ctx *ctx, const Node *n) {
+    for(int i = 0; i < ctx->count; i++) {
+        if(ctx->nodes[i] == n) return i;
+    }
+    return -1;
+}
+
+static void _TO_AddNode(int *nodes, int *count, int node) {
+    for(int i = 0; i < *count; i++) {
+        if(nodes[i] == node) return;
+    }
+    nodes[(*count)++] = node;
+}
+
+/* Collects the component nodes binding alias,
+ * returns 0 if alias isn't bound within component. */
+static int _TO_AliasNodes(const _TO_Ctx *ctx, const char *alias, int *nodes, int *count) {
+    int slot = Graph_GetAliasSlot(ctx->g, alias);
+    if(slot == GRAPH_NO_SLOT) return 0;
+
+    if(slot < ctx->g->node_count) {
+        int idx = _TO_NodeIdx(ctx, ctx->g->nodes[slot]);
+        if(idx < 0) return 0;
+        _TO_AddNode(nodes, count, idx);
+        return 1;
+    }
+
+    /* Edges are bound along with their end points. */
+    Edge *e = ctx->g->edges[slot - ctx->g->node_count];
+    for(int i = 0; i < ctx->edgeCount; i++) {
+        if(ctx->edges[i] != e) continue;
+        _TO_AddNode(nodes, count, ctx->src[i]);
+        _TO_AddNode(nodes, count, ctx->dest[i]);
+        return 1;
+    }
+    return 0;
+}
+
+static int _TO_FilterNodes(const _TO_Ctx *ctx, const FT_FilterNode *root, int *nodes, int *count) {
+    if(root->t == FT_N_COND) {
+        return _TO_FilterNodes(ctx, root->cond.left, nodes, count) &&
+               _TO_FilterNodes(ctx, root->cond.right, nodes, count);
+    }
+
+    if(!_TO_AliasNodes(ctx, root->pred.Lop.alias, nodes, count)) return 0;
+    if(root->pred.t == FT_N_VARYING) return _TO_AliasNodes(ctx, root->pred.Rop.alias, nodes, count);
+    return 1;
+}
+
+/* Splits filter tree into its conjuncts, keeping those
+ * referring to component's entities only. */
+static void _TO_CollectConjuncts(_TO_Ctx *ctx, const FT_FilterNode *root) {
+    if(root == NULL) return;
+    if(root->t == FT_N_COND && root->cond.op == AND) {
+        _TO_CollectConjuncts(ctx, root->cond.left);
+        _TO_CollectConjuncts(ctx, root->cond.right);
+        return;
+    }
+
+    int *nodes = malloc(sizeof(int) * ctx->count);
+    int count = 0;
+    if(!_TO_FilterNodes(ctx, root, nodes, &count)) {
+        free(nodes);
+        return;
+    }
+
+    double cost;
+    _TO_Conjunct *conjunct = &ctx->conjuncts[ctx->conjunctCount++];
+    conjunct->nodes = nodes;
+    conjunct->count = count;
+    FilterTree_Estimate(root, &conjunct->selectivity, &cost);
+}
+
+static int _TO_CountConjuncts(const FT_FilterNode *root) {
+    if(root == NULL) return 0;
+    if(root->t == FT_N_COND && root->cond.op == AND) {
+        return _TO_CountConjuncts(root->cond.left) + _TO_CountConjuncts(root->cond.right);
+    }
+    return 1;
+}
+
+/* Chance edge e connects a random pair of its end points' candidates. */
+static double _TO_EdgeSelectivity(const _TO_Ctx *ctx, int e) {
+    Edge *edge = ctx->edges[e];
+    double srcCard = ctx->cardinality[ctx->src[e]];
+    double destCard = ctx->cardinality[ctx->dest[e]];
+    if(srcCard == 0 || destCard == 0) return 0;
+
+    AST_LinkEntity *link = ctx->links[e];
+    if(link == NULL) {
+        double count = GraphContext_EdgeCount(ctx->gc, ctx->nodes[ctx->src[e]]->label,
+                                              edge->relationship, ctx->nodes[ctx->dest[e]]->label);
+        return fmin(1, count / (srcCard * destCard));
+    }
+
+    /* Paths may cross nodes of any label, each hop is estimated
+     * by the relationship's average degree. */
+    double degree = GraphContext_EdgeCount(ctx->gc, NULL, edge->relationship, NULL) / ctx->allNodes;
+    int minHops = link->length.minHops;
+    int maxHops = link->length.maxHops;
+    if(maxHops == AST_LINK_UNBOUNDED) maxHops = TRAVERSAL_UNBOUNDED_HOPS;
+    if(maxHops < minHops) maxHops = minHops;
+
+    double reached = (minHops == 0) ? 1 : 0;
+    double paths = 1;
+    for(int hop = 1; hop <= maxHops; hop++) {
+        paths *= degree;
+        if(hop >= minHops) reached += paths;
+    }
+    return fmin(1, reached / ctx->allNodes);
+}
+
+static void _TO_Init(_TO_Ctx *ctx, const Graph *g, GraphContext *gc, const AST_MatchNode *match,
+                     const FT_FilterNode *filters, Node **component, int count) {
+    ctx->g = g;
+    ctx->gc = gc;
+    ctx->nodes = component;
+    ctx->count = count;
+    ctx->relaxed = 0;
+    ctx->allNodes = GraphContext_LabelCardinality(gc, NULL);
+    ctx->cardinality = malloc(sizeof(double) * count);
+    for(int i = 0; i < count; i++) {
+        ctx->cardinality[i] = GraphContext_LabelCardinality(gc, component[i]->label);
+    }
+
+    /* Each edge is collected once, through its source. */
+    ctx->edgeCount = 0;
+    for(int i = 0; i < count; i++) ctx->edgeCount += Vector_Size(component[i]->outgoingEdges);
+    ctx->edges = malloc(sizeof(Edge*) * (ctx->edgeCount + 1));
+    ctx->src = malloc(sizeof(int) * (ctx->edgeCount + 1));
+    ctx->dest = malloc(sizeof(int) * (ctx->edgeCount + 1));
+    ctx->links = malloc(sizeof(AST_LinkEntity*) * (ctx->edgeCount + 1));
+    ctx->edgeSelectivity = malloc(sizeof(double) * (ctx->edgeCount + 1));
+    ctx->typeCardinality = malloc(sizeof(double) * (ctx->edgeCount + 1));
+
+    int e = 0;
+    for(int i = 0; i < count; i++) {
+        Vector *outgoing = component[i]->outgoingEdges;
+        for(int j = 0; j < Vector_Size(outgoing); j++, e++) {
+            Vector_Get(outgoing, j, &ctx->edges[e]);
+            ctx->src[e] = i;
+            ctx->dest[e] = _TO_NodeIdx(ctx, ctx->edges[e]->dest);
+
+            AST_LinkEntity *link = (AST_LinkEntity*)MatchClause_GetEntity(match, Graph_GetEdgeAlias(g, ctx->edges[e]));
+            ctx->links[e] = (link && !AST_LinkEntity_FixedLength(link)) ? link : NULL;
+            ctx->edgeSelectivity[e] = _TO_EdgeSelectivity(ctx, e);
+            ctx->typeCardinality[e] = GraphContext_TypeCardinality(gc, ctx->edges[e]->relationship);
+        }
+    }
+
+    ctx->conjunctCount = 0;
+    ctx->conjuncts = malloc(sizeof(_TO_Conjunct) * (_TO_CountConjuncts(filters) + 1));
+    _TO_CollectConjuncts(ctx, filters);
+}
+
+static void _TO_Free(_TO_Ctx *ctx) {
+    for(int i = 0; i < ctx->conjunctCount; i++) free(ctx->conjuncts[i].nodes);
+    free(ctx->conjuncts);
+    free(ctx->cardinality);
+    free(ctx->edges);
+    free(ctx->src);
+    free(ctx->dest);
+    free(ctx->links);
+    free(ctx->edgeSelectivity);
+    free(ctx->typeCardinality);
+}
+
+static int _TO_Covers(const _TO_Conjunct *conjunct, const char *bound) {
+    for(int i = 0; i < conjunct->count; i++) {
+        if(!bound[conjunct->nodes[i]]) return 0;
+    }
+    return 1;
+}
+
+/* Estimated records binding the nodes flagged by bound along with the
+ * edges among them, except for skipped ones, filtered by every conjunct
+ * bound nodes cover. */
+static double _TO_Rows(const _TO_Ctx *ctx, const char *bound, const char *skip) {
+    double rows = 1;
+    for(int i = 0; i < ctx->count; i++) {
+        if(bound[i]) rows *= ctx->cardinality[i];
+    }
+    for(int e = 0; e < ctx->edgeCount; e++) {
+        if(skip && skip[e]) continue;
+        if(bound[ctx->src[e]] && bound[ctx->dest[e]]) rows *= ctx->edgeSelectivity[e];
+    }
+    for(int i = 0; i < ctx->conjunctCount; i++) {
+        if(_TO_Covers(&ctx->conjuncts[i], bound)) rows *= ctx->conjuncts[i].selectivity;
+    }
+    return rows;
+}
+
+/* Selectivity of the conjuncts bound covers, which are covered by neither a nor b. */
+static double _TO_NewSelectivity(const _TO_Ctx *ctx, const char *bound, const char *a, const char *b) {
+    double selectivity = 1;
+    for(int i = 0; i < ctx->conjunctCount; i++) {
+        const _TO_Conjunct *conjunct = &ctx->conjuncts[i];
+        if(!_TO_Covers(conjunct, bound)) continue;
+        if(a && _TO_Covers(conjunct, a)) continue;
+        if(b && _TO_Covers(conjunct, b)) continue;
+        selectivity *= conjunct->selectivity;
+    }
+    return selectivity;
+}
+
+/* Picks the edge over which node is reached from bound nodes, returns -1
+ * if there's no such edge, or if node is connected to bound nodes by
+ * a variable length link which can't be followed. Variable length links
+ * are followed from their source to an unbound destination only. */
+static int _TO_BindingEdge(const _TO_Ctx *ctx, const char *bound, int node) {
+    int binding = -1;
+    for(int e = 0; e < ctx->edgeCount; e++) {
+        int other;
+        if(ctx->src[e] == node) other = ctx->dest[e];
+        else if(ctx->dest[e] == node) other = ctx->src[e];
+        else continue;
+
+        if(other == node) {
+            /* Self loops are checked once node is bound. */
+            if(ctx->links[e] && !ctx->relaxed) return -1;
+            continue;
+        }
+        if(!bound[other]) continue;
+
+        if(ctx->links[e]) {
+            if(ctx->dest[e] != node || (binding >= 0 && ctx->links[binding])) {
+                if(!ctx->relaxed) return -1;
+                continue;
+            }
+            binding = e;
+        } else if(binding < 0) {
+            binding = e;
+        }
+    }
+    return binding;
+}
+
+/* Number of edges checked once node is bound over binding edge. */
+static int _TO_CheckCount(const _TO_Ctx *ctx, const char *bound, int node, int binding) {
+    int checks = 0;
+    for(int e = 0; e < ctx->edgeCount; e++) {
+        if(e == binding || ctx->links[e]) continue;
+        if(ctx->src[e] == node && (bound[ctx->dest[e]] || ctx->dest[e] == node)) checks++;
+        else if(ctx->dest[e] == node && bound[ctx->src[e]]) checks++;
+    }
+    return checks;
+}
+
+/* Node is connected to itself by a variable length link, which can't be followed. */
+static int _TO_LinkedToSelf(const _TO_Ctx *ctx, int node) {
+    for(int e = 0; e < ctx->edgeCount; e++) {
+        if(ctx->src[e] == node && ctx->dest[e] == node && ctx->links[e]) return 1;
+    }
+    return 0;
+}
+
+static void _TO_Flags(const _TO_Ctx *ctx, unsigned int set, char *flags) {
+    for(int i = 0; i < ctx->count; i++) flags[i] = (set >> i) & 1;
+}
+
+/* Creates a step binding node over binding edge, -1 for a scan,
+ * once nodes flagged by bound are bound. */
+static TraversalStep* _TO_NewStep(const _TO_Ctx *ctx, TraversalStepType t, const char *bound,
+                                  int node, int binding, TraversalStep *child) {
+    TraversalStep *step = calloc(1, sizeof(TraversalStep));
+    step->t = t;
+    step->node = ctx->nodes[node];
+    step->child = child;
+    step->edges = malloc(sizeof(Edge*) * (ctx->edgeCount + 1));
+
+    char after[ctx->count];
+    char checked[ctx->edgeCount + 1];
+    memcpy(after, bound, ctx->count);
+    after[node] = 1;
+    memset(checked, 0, ctx->edgeCount + 1);
+
+    if(binding >= 0) step->edges[step->edgeCount++] = ctx->edges[binding];
+    for(int e = 0; e < ctx->edgeCount; e++) {
+        if(e == binding || ctx->links[e]) continue;
+        if(ctx->src[e] != node && ctx->dest[e] != node) continue;
+        if(!after[ctx->src[e]] || !after[ctx->dest[e]]) continue;
+        step->edges[step->edgeCount++] = ctx->edges[e];
+        checked[e] = 1;
+    }
+
+    step->rows = _TO_Rows(ctx, after, NULL);
+    step->bindRows = _TO_Rows(ctx, after, checked);
+    return step;
+}
+
+/* Edge e can be scanned, binding both its end points at once. Single hop
+ * edges between distinct nodes qualify, as long as no variable length
+ * link connects their end points, which would be left unfollowed. */
+static int _TO_EdgeScannable(const _TO_Ctx *ctx, int e) {
+    if(ctx->links[e] || ctx->src[e] == ctx->dest[e]) return 0;
+    for(int i = 0; i < ctx->edgeCount; i++) {
+        if(!ctx->links[i]) continue;
+        if((ctx->src[i] == ctx->src[e] || ctx->src[i] == ctx->dest[e]) &&
+           (ctx->dest[i] == ctx->src[e] || ctx->dest[i] == ctx->dest[e])) return 0;
+    }
+    return 1;
+}
+
+/* Number of single hop edges other than e among e's end points. */
+static int _TO_EdgeScanChecks(const _TO_Ctx *ctx, int e) {
+    int checks = 0;
+    for(int i = 0; i < ctx->edgeCount; i++) {
+        if(i == e || ctx->links[i]) continue;
+        if((ctx->src[i] == ctx->src[e] || ctx->src[i] == ctx->dest[e]) &&
+           (ctx->dest[i] == ctx->src[e] || ctx->dest[i] == ctx->dest[e])) checks++;
+    }
+    return checks;
+}
+
+/* Creates a step scanning edge e, followed by checks
+ * for the remaining edges among its end points. */
+static TraversalStep* _TO_NewEdgeScan(const _TO_Ctx *ctx, int e) {
+    TraversalStep *step = calloc(1, sizeof(TraversalStep));
+    step->t = TRAVERSAL_EDGE_SCAN;
+    step->edges = malloc(sizeof(Edge*) * (ctx->edgeCount + 1));
+    step->edges[step->edgeCount++] = ctx->edges[e];
+
+    char bound[ctx->count];
+    char checked[ctx->edgeCount + 1];
+    memset(bound, 0, ctx->count);
+    memset(checked, 0, ctx->edgeCount + 1);
+    bound[ctx->src[e]] = 1;
+    bound[ctx->dest[e]] = 1;
+
+    for(int i = 0; i < ctx->edgeCount; i++) {
+        if(i == e || ctx->links[i]) continue;
+        if(!bound[ctx->src[i]] || !bound[ctx->dest[i]]) continue;
+        step->edges[step->edgeCount++] = ctx->edges[i];
+        checked[i] = 1;
+    }
+
+    step->rows = _TO_Rows(ctx, bound, NULL);
+    step->bindRows = _TO_Rows(ctx, bound, checked);
+    return step;
+}
+
+static TraversalStep* _TO_BuildStep(const _TO_Ctx *ctx, const _TO_Entry *table, unsigned int set) {
+    const _TO_Entry *entry = &table[set];
+    char bound[ctx->count];
+    TraversalStep *step;
+
+    switch(entry->t) {
+        case TRAVERSAL_SCAN:
+            memset(bound, 0, ctx->count);
+            return _TO_NewStep(ctx, TRAVERSAL_SCAN, bound, entry->node, -1, NULL);
+        case TRAVERSAL_EDGE_SCAN:
+            return _TO_NewEdgeScan(ctx, entry->edge);
+        case TRAVERSAL_EXPAND:
+            _TO_Flags(ctx, entry->input, bound);
+            return _TO_NewStep(ctx, TRAVERSAL_EXPAND, bound, entry->node, entry->edge,
+                               _TO_BuildStep(ctx, table, entry->input));
+        default:
+            step = calloc(1, sizeof(TraversalStep));
+            step->t = TRAVERSAL_HASH_JOIN;
+            step->child = _TO_BuildStep(ctx, table, entry->input);
+            step->build = _TO_BuildStep(ctx, table, entry->build);
+            step->bindRows = entry->rows;
+            step->rows = entry->rows;
+            return step;
+    }
+}
+
+/* Joining a and b sharing a single node loses no edge. */
+static int _TO_Separable(const _TO_Ctx *ctx, unsigned int a, unsigned int b) {
+    unsigned int shared = a & b;
+    for(int e = 0; e < ctx->edgeCount; e++) {
+        unsigned int ends = (1u << ctx->src[e]) | (1u << ctx->dest[e]);
+        if((ends & ~shared & a) && (ends & ~shared & b)) return 0;
+    }
+    return 1;
+}
+
+/* Dynamic programming over connected subsets of nodes, each set is bound
+ * either by expanding a smaller set to one more node or by hash joining
+ * two sets sharing a single node, pairs of nodes may also be bound by
+ * scanning an edge connecting them. */
+static TraversalStep* _TO_Exhaustive(const _TO_Ctx *ctx) {
+    unsigned int full = (1u << ctx->count) - 1;
+    _TO_Entry *table = malloc(sizeof(_TO_Entry) * (full + 1));
+    for(unsigned int set = 0; set <= full; set++) table[set].cost = HUGE_VAL;
+
+    char bound[ctx->count];
+    char input[ctx->count];
+    char build[ctx->count];
+
+    for(unsigned int set = 1; set <= full; set++) {
+        _TO_Entry *entry = &table[set];
+        _TO_Flags(ctx, set, bound);
+        double rows = _TO_Rows(ctx, bound, NULL);
+
+        /* Single node, scanned. */
+        if((set & (set - 1)) == 0) {
+            int node = __builtin_ctz(set);
+            memset(input, 0, ctx->count);
+            if(!ctx->relaxed && _TO_LinkedToSelf(ctx, node)) continue;
+            double scanned = ctx->cardinality[node];
+            entry->cost = scanned * TRAVERSAL_COST_SCAN + rows * TRAVERSAL_COST_RECORD +
+                          scanned * _TO_CheckCount(ctx, input, node, -1) * TRAVERSAL_COST_EXPAND;
+            entry->rows = rows;
+            entry->t = TRAVERSAL_SCAN;
+            entry->node = node;
+            continue;
+        }
+
+        /* Pair of nodes, scanned through an edge connecting them. */
+        for(int e = 0; e < ctx->edgeCount; e++) {
+            if(((1u << ctx->src[e]) | (1u << ctx->dest[e])) != set) continue;
+            if(!_TO_EdgeScannable(ctx, e)) continue;
+            if(!ctx->relaxed && (_TO_LinkedToSelf(ctx, ctx->src[e]) || _TO_LinkedToSelf(ctx, ctx->dest[e]))) continue;
+
+            double scanned = ctx->typeCardinality[e];
+            double cost = scanned * TRAVERSAL_COST_SCAN + rows * TRAVERSAL_COST_RECORD +
+                          scanned * _TO_EdgeScanChecks(ctx, e) * TRAVERSAL_COST_EXPAND;
+            if(cost < entry->cost) {
+                entry->cost = cost;
+                entry->rows = rows;
+                entry->t = TRAVERSAL_EDGE_SCAN;
+                entry->edge = e;
+            }
+        }
+
+        /* Expand to one of set's nodes. */
+        for(int node = 0; node < ctx->count; node++) {
+            unsigned int prev = set & ~(1u << node);
+            if(prev == set || table[prev].cost == HUGE_VAL) continue;
+
+            _TO_Flags(ctx, prev, input);
+            int binding = _TO_BindingEdge(ctx, input, node);
+            if(binding < 0) continue;
+
+            double selectivity = _TO_NewSelectivity(ctx, bound, input, NULL);
+            double expanded = (selectivity > 0) ? rows / selectivity : rows;
+            double cost = table[prev].cost + expanded * TRAVERSAL_COST_RECORD +
+                          table[prev].rows * TRAVERSAL_COST_EXPAND +
+                          expanded * _TO_CheckCount(ctx, input, node, binding) * TRAVERSAL_COST_EXPAND;
+            if(cost < entry->cost) {
+                entry->cost = cost;
+                entry->rows = rows;
+                entry->t = TRAVERSAL_EXPAND;
+                entry->node = node;
+                entry->edge = binding;
+                entry->input = prev;
+            }
+        }
+
+        /* Hash join two sub patterns sharing a node. */
+        for(unsigned int probe = (set - 1) & set; probe > 0; probe = (probe - 1) & set) {
+            if(table[probe].cost == HUGE_VAL || (probe & (probe - 1)) == 0) continue;
+            for(int node = 0; node < ctx->count; node++) {
+                if(!((probe >> node) & 1)) continue;
+                unsigned int other = (set & ~probe) | (1u << node);
+                if((other & (other - 1)) == 0 || table[other].cost == HUGE_VAL) continue;
+                if(!_TO_Separable(ctx, probe, other)) continue;
+
+                _TO_Flags(ctx, probe, input);
+                _TO_Flags(ctx, other, build);
+                double selectivity = _TO_NewSelectivity(ctx, bound, input, build);
+                double joined = (selectivity > 0) ? rows / selectivity : rows;
+                double cost = table[probe].cost + table[other].cost +
+                              table[probe].rows * TRAVERSAL_COST_HASH_PROBE +
+                              table[other].rows * TRAVERSAL_COST_HASH_BUILD +
+                              joined * TRAVERSAL_COST_RECORD;
+                if(cost < entry->cost) {
+                    entry->cost = cost;
+                    entry->rows = rows;
+                    entry->t = TRAVERSAL_HASH_JOIN;
+                    entry->input = probe;
+                    entry->build = other;
+                }
+            }
+        }
+    }
+
+    TraversalStep *step = NULL;
+    if(table[full].cost != HUGE_VAL) step = _TO_BuildStep(ctx, table, full);
+    free(table);
+    return step;
+}
+
+/* Scans the node cheapest to scan, then repeatedly expands
+ * to the node leading to the fewest records. */
+static TraversalStep* _TO_Greedy(const _TO_Ctx *ctx) {
+    char bound[ctx->count];
+    memset(bound, 0, ctx->count);
+
+    int first = 0;
+    for(int i = 1; i < ctx->count; i++) {
+        if(ctx->cardinality[i] < ctx->cardinality[first]) first = i;
+    }
+    TraversalStep *step = _TO_NewStep(ctx, TRAVERSAL_SCAN, bound, first, -1, NULL);
+    bound[first] = 1;
+
+    for(int k = 1; k < ctx->count; k++) {
+        int best = -1;
+        int bestEdge = -1;
+        double bestRows = HUGE_VAL;
+        for(int node = 0; node < ctx->count; node++) {
+            if(bound[node]) continue;
+            int binding = _TO_BindingEdge(ctx, bound, node);
+            if(binding < 0) continue;
+
+            bound[node] = 1;
+            double rows = _TO_Rows(ctx, bound, NULL);
+            bound[node] = 0;
+            if(best < 0 || rows < bestRows) {
+                best = node;
+                bestEdge = binding;
+                bestRows = rows;
+            }
+        }
+
+        if(best < 0) {
+            TraversalStep_Free(step);
+            return NULL;
+        }
+        step = _TO_NewStep(ctx, TRAVERSAL_EXPAND, bound, best, bestEdge, step);
+        bound[best] = 1;
+    }
+
+    return step;
+}
+
+TraversalStep* TraversalOrder_Plan(const Graph *g, GraphContext *gc, const AST_MatchNode *match,
+                                   const FT_FilterNode *filters, Node **component, int count) {
+    _TO_Ctx ctx;
+    _TO_Init(&ctx, g, gc, match, filters, component, count);
+
+    TraversalStep *step = (count <= TRAVERSAL_DP_MAX_NODES) ? _TO_Exhaustive(&ctx) : _TO_Greedy(&ctx);
+    if(step == NULL) {
+        /* Variable length links which can't be followed are left out. */
+        ctx.relaxed = 1;
+        step = (count <= TRAVERSAL_DP_MAX_NODES) ? _TO_Exhaustive(&ctx) : _TO_Greedy(&ctx);
+    }
+
+    _TO_Free(&ctx);
+    return step;
+}
+
+double TraversalOrder_EstimateRows(const Graph *g, GraphContext *gc, const AST_MatchNode *match,
+                                   const FT_FilterNode *filters, Node **component, int count) {
+    _TO_Ctx ctx;
+    _TO_Init(&ctx, g, gc, match, filters, component, count);
+
+    char bound[count];
+    memset(bound, 1, count);
+    double rows = _TO_Rows(&ctx, bound, NULL);
+
+    _TO_Free(&ctx);
+    return rows;
+}
+
+void TraversalStep_Free(TraversalStep *step) {
+    if(step == NULL) return;
+    TraversalStep_Free(step->child);
+    TraversalStep_Free(step->build);
+    free(step->edges);
+    free(step);
+}
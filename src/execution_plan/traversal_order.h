@@ -0,0 +1,60 @@
+#ifndef __TRAVERSAL_ORDER_H__
+#define __TRAVERSAL_ORDER_H__
+
+#include "../graph/graph.h"
+#include "../parser/ast.h"
+#include "../filter_tree/filter_tree.h"
+#include "../graph_context/graph_context.h"
+
+/* Patterns of up to this many nodes are ordered exhaustively,
+ * larger ones are ordered greedily. */
+#define TRAVERSAL_DP_MAX_NODES 10
+
+/* Estimated cost of the work done per record. */
+#define TRAVERSAL_COST_SCAN 1.0         /* Reading a store entry. */
+#define TRAVERSAL_COST_RECORD 1.0       /* Producing a record. */
+#define TRAVERSAL_COST_EXPAND 2.0       /* Hexastore lookup, per expanded record. */
+#define TRAVERSAL_COST_HASH_BUILD 2.0   /* Materializing and hashing a record. */
+#define TRAVERSAL_COST_HASH_PROBE 1.0   /* Probing hash table with a record. */
+
+/* Unbounded variable length links are estimated to span up to this many hops. */
+#define TRAVERSAL_UNBOUNDED_HOPS 3
+
+typedef enum {
+    TRAVERSAL_SCAN,         /* Scans node's label store. */
+    TRAVERSAL_EDGE_SCAN,    /* Scans edges[0] type store, binding both its end points. */
+    TRAVERSAL_EXPAND,       /* Expands child's records to node. */
+    TRAVERSAL_HASH_JOIN,    /* Joins child with build on their common node. */
+} TraversalStepType;
+
+/* TraversalStep
+ * Step of a traversal tree, binds node either by a scan or by expanding
+ * over edges[0] from nodes bound by child. Remaining edges connect node
+ * to nodes bound ahead of it, each is checked once node is bound. */
+typedef struct TraversalStep {
+    TraversalStepType t;
+    Node *node;                     /* Bound node, NULL for hash joins and edge scans. */
+    Edge **edges;                   /* Binding edge followed by checked edges. */
+    int edgeCount;
+    double bindRows;                /* Estimated records binding node. */
+    double rows;                    /* Estimated records passing checks. */
+    struct TraversalStep *child;    /* Input, probe side of hash joins. */
+    struct TraversalStep *build;    /* Build side of hash joins. */
+} TraversalStep;
+
+/* Finds the cheapest traversal binding each of the nodes within component
+ * along with the edges among them, considering every scanned node or
+ * relationship type, expansion order and direction as well as hash joins
+ * of sub patterns.
+ * Costs are estimated from label cardinalities, per type edge counts
+ * and the selectivity of filters. */
+TraversalStep* TraversalOrder_Plan(const Graph *g, GraphContext *gc, const AST_MatchNode *match,
+                                   const FT_FilterNode *filters, Node **component, int count);
+
+/* Estimated number of records matching component. */
+double TraversalOrder_EstimateRows(const Graph *g, GraphContext *gc, const AST_MatchNode *match,
+                                   const FT_FilterNode *filters, Node **component, int count);
+
+void TraversalStep_Free(TraversalStep *step);
+
+#endif
@@ -0,0 +1,267 @@
+#include <math.h>
+#include "filter_normalize.h"
+#include "../parser/grammar.h"
+
+/* Operand of a flattened AND/OR chain. */
+typedef struct {
+    FT_FilterNode *node;
+    double rank;    /* Expected cost per decided record, lower runs first. */
+    int idx;        /* Position within WHERE clause, breaks ties. */
+} _FT_Operand;
+
+int static inline _FT_IsConstantPredicate(const FT_FilterNode *node) {
+    return (node->t == FT_N_PRED && node->pred.t == FT_N_CONSTANT);
+}
+
+int _FT_SameOperand(const char *aAlias, const char *aProp, const char *bAlias, const char *bProp) {
+    return strcmp(aAlias, bAlias) == 0 && strcmp(aProp, bProp) == 0;
+}
+
+int _FT_PredicatesEqual(const FT_PredicateNode *a, const FT_PredicateNode *b) {
+    if(a->t != b->t || a->op != b->op) return 0;
+    if(!_FT_SameOperand(a->Lop.alias, a->Lop.property, b->Lop.alias, b->Lop.property)) return 0;
+
+    switch(a->t) {
+        case FT_N_CONSTANT:
+            return a->cf == b->cf && a->cf((void*)&a->constVal, (void*)&b->constVal) == 0;
+        case FT_N_PARAM:
+            return a->param == b->param;
+        default:
+            return _FT_SameOperand(a->Rop.alias, a->Rop.property, b->Rop.alias, b->Rop.property);
+    }
+}
+
+/* Value range satisfying a constant predicate, NULL bound for unbounded. */
+typedef struct {
+    const SIValue *lo;
+    const SIValue *hi;
+    int loInclusive;
+    int hiInclusive;
+} _FT_Range;
+
+_FT_Range _FT_PredicateRange(const FT_PredicateNode *pred) {
+    _FT_Range r = {NULL, NULL, 0, 0};
+    switch(pred->op) {
+        case EQ:
+            r.lo = r.hi = &pred->constVal;
+            r.loInclusive = r.hiInclusive = 1;
+            break;
+        case GT:
+        case GE:
+            r.lo = &pred->constVal;
+            r.loInclusive = (pred->op == GE);
+            break;
+        case LT:
+        case LE:
+            r.hi = &pred->constVal;
+            r.hiInclusive = (pred->op == LE);
+            break;
+    }
+    return r;
+}
+
+/* Checks if range a ends before range b starts. */
+int _FT_RangeBelow(const _FT_Range *a, const _FT_Range *b, CmpFunc cf) {
+    if(a->hi == NULL || b->lo == NULL) return 0;
+    int cmp = cf((void*)a->hi, (void*)b->lo);
+    return cmp < 0 || (cmp == 0 && !(a->hiInclusive && b->loInclusive));
+}
+
+/* Checks if no value satisfies both constant predicates
+ * over the same entity property. */
+int _FT_ConstantsContradict(const FT_PredicateNode *a, const FT_PredicateNode *b) {
+    if(a->op == NE || b->op == NE) {
+        const FT_PredicateNode *ne = (a->op == NE) ? a : b;
+        const FT_PredicateNode *other = (a->op == NE) ? b : a;
+        return other->op == EQ && a->cf((void*)&ne->constVal, (void*)&other->constVal) == 0;
+    }
+
+    _FT_Range ra = _FT_PredicateRange(a);
+    _FT_Range rb = _FT_PredicateRange(b);
+    return _FT_RangeBelow(&ra, &rb, a->cf) || _FT_RangeBelow(&rb, &ra, a->cf);
+}
+
+/* Checks for pairs of conjuncts which can never pass together. */
+int _FT_ConjunctionContradicts(_FT_Operand *operands, int len) {
+    for(int i = 0; i < len; i++) {
+        const FT_FilterNode *a = operands[i].node;
+        if(!_FT_IsConstantPredicate(a)) continue;
+
+        for(int j = i + 1; j < len; j++) {
+            const FT_FilterNode *b = operands[j].node;
+            if(!_FT_IsConstantPredicate(b) || a->pred.cf != b->pred.cf) continue;
+            if(!_FT_SameOperand(a->pred.Lop.alias, a->pred.Lop.property,
+                                b->pred.Lop.alias, b->pred.Lop.property)) continue;
+            if(_FT_ConstantsContradict(&a->pred, &b->pred)) return 1;
+        }
+    }
+    return 0;
+}
+
+/* Comparing a property against itself, e.g. a.x < a.x. */
+int _FT_PredicateContradicts(const FT_PredicateNode *pred) {
+    if(pred->t != FT_N_VARYING) return 0;
+    if(pred->op != NE && pred->op != GT && pred->op != LT) return 0;
+    return _FT_SameOperand(pred->Lop.alias, pred->Lop.property, pred->Rop.alias, pred->Rop.property);
+}
+
+void _FT_PredicateEstimate(const FT_PredicateNode *pred, double *selectivity, double *cost) {
+    switch(pred->op) {
+        case EQ:
+            *selectivity = FT_SELECTIVITY_EQ;
+            break;
+        case NE:
+            *selectivity = FT_SELECTIVITY_NE;
+            break;
+        default:
+            *selectivity = FT_SELECTIVITY_RANGE;
+            break;
+    }
+
+    switch(pred->t) {
+        case FT_N_CONSTANT:
+            *cost = FT_COST_PROPERTY +
+                    ((pred->constVal.type == T_STRING) ? FT_COST_STRING : FT_COST_NUMERIC);
+            break;
+        case FT_N_PARAM:
+            *cost = FT_COST_PROPERTY + FT_COST_PARAM;
+            break;
+        default:
+            /* Varying predicates compare doubles. */
+            *cost = 2 * FT_COST_PROPERTY + FT_COST_NUMERIC;
+            break;
+    }
+}
+
+void FilterTree_Estimate(const FT_FilterNode *root, double *selectivity, double *cost) {
+    if(root->t == FT_N_PRED) {
+        _FT_PredicateEstimate(&root->pred, selectivity, cost);
+        return;
+    }
+
+    double lSel, lCost, rSel, rCost;
+    FilterTree_Estimate(root->cond.left, &lSel, &lCost);
+    FilterTree_Estimate(root->cond.right, &rSel, &rCost);
+
+    /* Right side is evaluated only when left side doesn't decide. */
+    if(root->cond.op == AND) {
+        *selectivity = lSel * rSel;
+        *cost = lCost + lSel * rCost;
+    } else {
+        *selectivity = 1 - (1 - lSel) * (1 - rSel);
+        *cost = lCost + (1 - lSel) * rCost;
+    }
+}
+
+/* Collects the operands of a chain of op conditions, freeing the chain. */
+void _FT_CollectOperands(FT_FilterNode *node, int op, Vector *operands) {
+    if(node->t == FT_N_COND && node->cond.op == op) {
+        _FT_CollectOperands(node->cond.left, op, operands);
+        _FT_CollectOperands(node->cond.right, op, operands);
+        free(node);
+        return;
+    }
+    Vector_Push(operands, node);
+}
+
+int _FT_Operand_Compare(const void *a, const void *b) {
+    const _FT_Operand *oa = a;
+    const _FT_Operand *ob = b;
+    if(oa->rank != ob->rank) return (oa->rank < ob->rank) ? -1 : 1;
+    return oa->idx - ob->idx;
+}
+
+/* Flattens chain rooted at node, drops duplicate operands,
+ * folds contradicting conjunctions and rebuilds the chain ordered by rank.
+ * Operands are already normalized. Returns 0 if chain can never pass. */
+int _FT_NormalizeChain(FT_FilterNode **node) {
+    int op = (*node)->cond.op;
+    Vector *collected = NewVector(FT_FilterNode*, 4);
+    _FT_CollectOperands(*node, op, collected);
+    *node = NULL;
+
+    int len = 0;
+    _FT_Operand *operands = malloc(sizeof(_FT_Operand) * Vector_Size(collected));
+    for(int i = 0; i < Vector_Size(collected); i++) {
+        FT_FilterNode *operand;
+        Vector_Get(collected, i, &operand);
+
+        int duplicate = 0;
+        for(int j = 0; j < len && !duplicate; j++) {
+            duplicate = operand->t == FT_N_PRED && operands[j].node->t == FT_N_PRED &&
+                        _FT_PredicatesEqual(&operand->pred, &operands[j].node->pred);
+        }
+        if(duplicate) {
+            FilterTree_Free(operand);
+            continue;
+        }
+
+        /* AND short circuits on failure, OR on success,
+         * prefer operands likely to decide for little cost. */
+        double selectivity, cost;
+        FilterTree_Estimate(operand, &selectivity, &cost);
+        double decides = (op == AND) ? 1 - selectivity : selectivity;
+        operands[len].node = operand;
+        operands[len].rank = (decides > 0) ? cost / decides : HUGE_VAL;
+        operands[len].idx = len;
+        len++;
+    }
+    Vector_Free(collected);
+
+    if(op == AND && _FT_ConjunctionContradicts(operands, len)) {
+        for(int i = 0; i < len; i++) FilterTree_Free(operands[i].node);
+        free(operands);
+        return 0;
+    }
+
+    qsort(operands, len, sizeof(_FT_Operand), _FT_Operand_Compare);
+
+    /* Rebuild as a right leaning chain, evaluated in order. */
+    *node = operands[len-1].node;
+    for(int i = len - 2; i >= 0; i--) {
+        FT_FilterNode *cond = CreateCondFilterNode(op);
+        AppendLeftChild(cond, operands[i].node);
+        AppendRightChild(cond, *node);
+        *node = cond;
+    }
+
+    free(operands);
+    return 1;
+}
+
+/* Returns 0 if node can never pass, node is then freed and set to NULL. */
+int _FT_Normalize(FT_FilterNode **node) {
+    FT_FilterNode *root = *node;
+
+    if(root->t == FT_N_PRED) {
+        if(_FT_PredicateContradicts(&root->pred)) {
+            FilterTree_Free(root);
+            *node = NULL;
+            return 0;
+        }
+        return 1;
+    }
+
+    int leftPass = _FT_Normalize(&root->cond.left);
+    int rightPass = _FT_Normalize(&root->cond.right);
+
+    /* Fold operands which can never pass. */
+    if((root->cond.op == AND && !(leftPass && rightPass)) ||
+       (root->cond.op == OR && !(leftPass || rightPass))) {
+        FilterTree_Free(root);
+        *node = NULL;
+        return 0;
+    }
+    if(!leftPass || !rightPass) {
+        *node = leftPass ? root->cond.left : root->cond.right;
+        free(root);
+        return 1;
+    }
+
+    return _FT_NormalizeChain(node);
+}
+
+int FilterTree_Normalize(FT_FilterNode **root) {
+    if(*root == NULL) return FILTER_PASS;
+    return _FT_Normalize(root) ? FILTER_PASS : FILTER_FAIL;
+}
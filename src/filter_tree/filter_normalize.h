@@ -0,0 +1,31 @@
+#ifndef _FILTER_NORMALIZE_H
+#define _FILTER_NORMALIZE_H
+
+#include "filter_tree.h"
+
+/* Estimated fraction of records passing a predicate,
+ * no value statistics are kept, estimates are per relation. */
+#define FT_SELECTIVITY_EQ 0.1
+#define FT_SELECTIVITY_NE 0.9
+#define FT_SELECTIVITY_RANGE 0.33
+
+/* Estimated cost of evaluating a predicate's parts. */
+#define FT_COST_PROPERTY 1.0    /* Property lookup. */
+#define FT_COST_NUMERIC 1.0     /* Numeric comparison. */
+#define FT_COST_STRING 4.0      /* String comparison. */
+#define FT_COST_PARAM 1.5       /* Comparison against a value of unknown type. */
+
+/* Normalizes filter tree:
+ * chains of AND/OR conditions are flattened, duplicate predicates dropped,
+ * conjunctions which can never pass (a.x = 1 AND a.x = 2) are folded away,
+ * and the operands of each chain are rebuilt ordered such that the
+ * cheapest predicates most likely to determine the outcome run first.
+ * Returns FILTER_FAIL if no record can pass the tree,
+ * in which case tree is freed and root set to NULL, FILTER_PASS otherwise. */
+int FilterTree_Normalize(FT_FilterNode **root);
+
+/* Estimates fraction of records passing tree and its average
+ * evaluation cost, taking short circuiting into account. */
+void FilterTree_Estimate(const FT_FilterNode *root, double *selectivity, double *cost);
+
+#endif // _FILTER_NORMALIZE_H
@@ -0,0 +1,238 @@
+#include <assert.h>
+#include <strings.h>
+#include "filter_program.h"
+#include "../parser/grammar.h"
+
+FP_CmpType _FP_CmpType(SIType t) {
+    switch(t) {
+        case T_STRING:
+            return FP_T_STRING;
+        case T_INT32:
+        case T_BOOL:
+            return FP_T_INT;
+        case T_INT64:
+            return FP_T_LONG;
+        case T_UINT:
+            return FP_T_UINT;
+        case T_FLOAT:
+            return FP_T_FLOAT;
+        case T_DOUBLE:
+            return FP_T_DOUBLE;
+        default:
+            return FP_T_UNRESOLVED;
+    }
+}
+
+FP_Relation _FP_Relation(int op) {
+    switch(op) {
+        case EQ:
+            return FP_REL_EQ;
+        case NE:
+            return FP_REL_NE;
+        case GT:
+            return FP_REL_GT;
+        case GE:
+            return FP_REL_GE;
+        case LT:
+            return FP_REL_LT;
+        case LE:
+            return FP_REL_LE;
+        default:
+            /* Op should be enforced by AST. */
+            assert(0);
+            return FP_REL_EQ;
+    }
+}
+
+int _FP_Emit(FilterProgram *program) {
+    if(program->len == program->cap) {
+        program->cap = (program->cap > 0) ? program->cap * 2 : 8;
+        program->insts = realloc(program->insts, sizeof(FP_Inst) * program->cap);
+    }
+    memset(&program->insts[program->len], 0, sizeof(FP_Inst));
+    return program->len++;
+}
+
+void _FP_CompilePredicate(FilterProgram *program, const FT_PredicateNode *pred, const Graph *g) {
+    int idx = _FP_Emit(program);
+    FP_Inst *inst = &program->insts[idx];
+    inst->t = FP_INST_PRED;
+    inst->rel = _FP_Relation(pred->op);
+    inst->lhs.slot = Graph_GetAliasSlot(g, pred->Lop.alias);
+    inst->lhs.property = pred->Lop.property;
+
+    switch(pred->t) {
+        case FT_N_CONSTANT:
+            inst->val = &pred->constVal;
+            inst->opcode = FP_OPCODE(_FP_CmpType(pred->constVal.type), inst->rel);
+            inst->coded = 1;
+            break;
+        case FT_N_PARAM:
+            /* Specialized once a value is bound. */
+            inst->val = &pred->param->value;
+            inst->param = pred->param;
+            inst->rhsType = T_NULL;
+            inst->opcode = FP_OPCODE(FP_T_UNRESOLVED, inst->rel);
+            break;
+        case FT_N_VARYING:
+            /* Specialized by the type of the right side property as read. */
+            inst->rhs.slot = Graph_GetAliasSlot(g, pred->Rop.alias);
+            inst->rhs.property = pred->Rop.property;
+            inst->rhsType = T_NULL;
+            inst->opcode = FP_OPCODE(FP_T_UNRESOLVED, inst->rel);
+            break;
+    }
+}
+
+void _FP_CompileNode(FilterProgram *program, const FT_FilterNode *node, const Graph *g) {
+    if(node->t == FT_N_PRED) {
+        _FP_CompilePredicate(program, &node->pred, g);
+        return;
+    }
+
+    /* Right subtree is skipped once left one determines the outcome,
+     * instructions might move as program grows, refer to jump by index. */
+    _FP_CompileNode(program, node->cond.left, g);
+    int jump = _FP_Emit(program);
+    program->insts[jump].t = (node->cond.op == AND) ? FP_INST_JUMP_IF_FAIL : FP_INST_JUMP_IF_PASS;
+    _FP_CompileNode(program, node->cond.right, g);
+    program->insts[jump].target = program->len;
+}
+
+FilterProgram* FilterProgram_Compile(FT_FilterNode *root, const Graph *g) {
+    FilterProgram *program = calloc(1, sizeof(FilterProgram));
+    program->tree = root;
+    if(root) _FP_CompileNode(program, root, g);
+    return program;
+}
+
+/* Retrieves operand's property, NULL if either entity or property are missing,
+ * the index at which property was last found is checked first. */
+static inline const SIValue *_FP_Operand_Get(FP_Operand *operand, const Graph *g) {
+    if(operand->slot == GRAPH_NO_SLOT) return NULL;
+    GraphEntity *e = Graph_GetEntityBySlot(g, operand->slot);
+    if(e == NULL || e->id == INVALID_ENTITY_ID) return NULL;
+
+    return GraphEntity_Get_PropertyHint(e, operand->property, &operand->propIdx);
+}
+
+static inline int _FP_Relate(int cmp, FP_Relation rel) {
+    switch(rel) {
+        case FP_REL_EQ:
+            return cmp == 0;
+        case FP_REL_NE:
+            return cmp != 0;
+        case FP_REL_GT:
+            return cmp > 0;
+        case FP_REL_GE:
+            return cmp >= 0;
+        case FP_REL_LT:
+            return cmp < 0;
+        case FP_REL_LE:
+            return cmp <= 0;
+        default:
+            return FILTER_FAIL;
+    }
+}
+
+#define FP_NUMERIC_CASES(t, memb)                                              \
+    case FP_OPCODE(t, FP_REL_EQ): return a->memb == b->memb;                   \
+    case FP_OPCODE(t, FP_REL_NE): return a->memb != b->memb;                   \
+    case FP_OPCODE(t, FP_REL_GT): return a->memb > b->memb;                    \
+    case FP_OPCODE(t, FP_REL_GE): return a->memb >= b->memb;                   \
+    case FP_OPCODE(t, FP_REL_LT): return a->memb < b->memb;                    \
+    case FP_OPCODE(t, FP_REL_LE): return a->memb <= b->memb;
+
+static inline int _FP_StringEq(const FP_Inst *inst, const SIValue *a, const SIValue *b) {
+    /* Interned strings are equal only if their codes are. */
+    if(inst->coded && a->code && b->code) return a->code == b->code;
+    return a->stringval.len == b->stringval.len &&
+           strncasecmp(a->stringval.str, b->stringval.str, a->stringval.len) == 0;
+}
+
+/* Compares values of differing types, numbers are compared as doubles,
+ * numbers and strings never relate. */
+static int _FP_EvalMixed(const SIValue *a, const SIValue *b, FP_Relation rel) {
+    double x, y;
+    if(!SIValue_ToDouble((SIValue*)a, &x) || !SIValue_ToDouble((SIValue*)b, &y)) return FILTER_FAIL;
+    return _FP_Relate((x > y) - (x < y), rel);
+}
+
+int _FP_EvalPredicate(FP_Inst *inst, const Graph *g) {
+    const SIValue *a = _FP_Operand_Get(&inst->lhs, g);
+    if(a == NULL) return FILTER_FAIL;
+
+    const SIValue *b = inst->val;
+    if(inst->param) {
+        if(!inst->param->bound) return FILTER_FAIL;
+    } else if(b == NULL) {
+        b = _FP_Operand_Get(&inst->rhs, g);
+        if(b == NULL) return FILTER_FAIL;
+    }
+
+    /* Parameters and varying properties are specialized by the type
+     * of the value read, constants are resolved at compile time. */
+    if((inst->param || inst->val == NULL) && b->type != inst->rhsType) {
+        inst->rhsType = b->type;
+        inst->opcode = FP_OPCODE(_FP_CmpType(b->type), inst->rel);
+    }
+
+    /* Infinite values are ordered regardless of compared type. */
+    if((a->type | b->type) & (T_INF | T_NEGINF)) {
+        int cmp = (a->type == T_INF || b->type == T_NEGINF) ? 1 : -1;
+        return _FP_Relate(cmp, inst->rel);
+    }
+
+    /* Opcode is resolved by b's type, e.g. integral properties against double literals. */
+    if(a->type != b->type && _FP_CmpType(a->type) != _FP_CmpType(b->type)) {
+        return _FP_EvalMixed(a, b, inst->rel);
+    }
+
+    switch(inst->opcode) {
+        FP_NUMERIC_CASES(FP_T_INT, intval)
+        FP_NUMERIC_CASES(FP_T_LONG, longval)
+        FP_NUMERIC_CASES(FP_T_UINT, uintval)
+        FP_NUMERIC_CASES(FP_T_FLOAT, floatval)
+        FP_NUMERIC_CASES(FP_T_DOUBLE, doubleval)
+        case FP_OPCODE(FP_T_STRING, FP_REL_EQ): return _FP_StringEq(inst, a, b);
+        case FP_OPCODE(FP_T_STRING, FP_REL_NE): return !_FP_StringEq(inst, a, b);
+        case FP_OPCODE(FP_T_STRING, FP_REL_GT):
+        case FP_OPCODE(FP_T_STRING, FP_REL_GE):
+        case FP_OPCODE(FP_T_STRING, FP_REL_LT):
+        case FP_OPCODE(FP_T_STRING, FP_REL_LE):
+            return _FP_Relate(cmp_string((void*)a, (void*)b), inst->rel);
+        default:
+            /* Unresolved type. */
+            return FILTER_FAIL;
+    }
+}
+
+int FilterProgram_Apply(FilterProgram *program, const Graph *g) {
+    int pass = FILTER_PASS;
+    int pc = 0;
+
+    while(pc < program->len) {
+        FP_Inst *inst = &program->insts[pc];
+        switch(inst->t) {
+            case FP_INST_PRED:
+                pass = _FP_EvalPredicate(inst, g);
+                pc++;
+                break;
+            case FP_INST_JUMP_IF_FAIL:
+                pc = (pass == FILTER_FAIL) ? inst->target : pc + 1;
+                break;
+            case FP_INST_JUMP_IF_PASS:
+                pc = (pass == FILTER_PASS) ? inst->target : pc + 1;
+                break;
+        }
+    }
+
+    return pass;
+}
+
+void FilterProgram_Free(FilterProgram *program) {
+    if(program == NULL) return;
+    FilterTree_Free(program->tree);
+    free(program->insts);
+    free(program);
+}
@@ -0,0 +1,83 @@
+#ifndef _FILTER_PROGRAM_H
+#define _FILTER_PROGRAM_H
+
+#include "filter_tree.h"
+#include "../graph/graph.h"
+
+/* Relations between compared values. */
+typedef enum {
+    FP_REL_EQ,
+    FP_REL_NE,
+    FP_REL_GT,
+    FP_REL_GE,
+    FP_REL_LT,
+    FP_REL_LE,
+    FP_REL_COUNT,
+} FP_Relation;
+
+/* Compared values types, each has its own comparison routine. */
+typedef enum {
+    FP_T_STRING,
+    FP_T_INT,
+    FP_T_LONG,
+    FP_T_UINT,
+    FP_T_FLOAT,
+    FP_T_DOUBLE,
+    FP_T_COUNT,
+    FP_T_UNRESOLVED = FP_T_COUNT,   /* Type without comparison routine, predicate fails. */
+} FP_CmpType;
+
+/* Comparison opcode, specialized by both compared type and relation. */
+#define FP_OPCODE(t, rel) ((t) * FP_REL_COUNT + (rel))
+
+typedef enum {
+    FP_INST_PRED,           /* Evaluate predicate into pass register. */
+    FP_INST_JUMP_IF_FAIL,   /* Jump to target if pass register is FILTER_FAIL. */
+    FP_INST_JUMP_IF_PASS,   /* Jump to target if pass register is FILTER_PASS. */
+} FP_InstType;
+
+/* Entity property read by a predicate. */
+typedef struct {
+    int slot;               /* Entity binding slot, GRAPH_NO_SLOT if alias is missing. */
+    const char *property;   /* Property name. */
+    int propIdx;            /* Index at which property was last found. */
+} FP_Operand;
+
+typedef struct {
+    FP_InstType t;
+    int opcode;             /* Comparison opcode, predicates only. */
+    FP_Relation rel;        /* Relation, used to specialize parameterized predicates. */
+    FP_Operand lhs;         /* Left side of predicate. */
+    FP_Operand rhs;         /* Right side of varying predicates. */
+    const SIValue *val;     /* Right side of constant and parameterized predicates. */
+    FT_Param *param;        /* Parameter slot, NULL for non parameterized predicates. */
+    SIType rhsType;         /* Right side type opcode was specialized for,
+                             * parameterized and varying predicates. */
+    int coded;              /* Both sides' string codes share lhs' property dictionary. */
+    int target;             /* Jump destination, jump instructions only. */
+} FP_Inst;
+
+/* FilterProgram
+ * Flat form of a filter tree, aliases are resolved to query graph slots,
+ * comparisons to type specialized opcodes and condition nodes
+ * to short circuiting jumps, such that evaluating a record requires
+ * neither recursion nor alias lookups. */
+typedef struct {
+    FP_Inst *insts;
+    int len;
+    int cap;
+    FT_FilterNode *tree;    /* Compiled tree, owned by program. */
+} FilterProgram;
+
+/* Compiles filter tree against query graph g,
+ * program takes ownership of tree, parameter slots must outlive it. */
+FilterProgram* FilterProgram_Compile(FT_FilterNode *root, const Graph *g);
+
+/* Runs program against entities currently bound to query graph g,
+ * returns FILTER_PASS or FILTER_FAIL. */
+int FilterProgram_Apply(FilterProgram *program, const Graph *g);
+
+/* Frees program along with its tree. */
+void FilterProgram_Free(FilterProgram *program);
+
+#endif // _FILTER_PROGRAM_H
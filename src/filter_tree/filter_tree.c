@@ -16,6 +16,10 @@ int static inline IsNodeVaryingPredicate(const FT_FilterNode *node) {
     return (node->t == FT_N_PRED && node->pred.t == FT_N_VARYING);
 }
 
+int static inline IsNodeParamPredicate(const FT_FilterNode *node) {
+    return (node->t == FT_N_PRED && node->pred.t == FT_N_PARAM);
+}
+
 int static inline IsNodePredicate(const FT_FilterNode *node) {
     return node->t == FT_N_PRED;
 }
@@ -57,12 +61,11 @@ FT_FilterNode* CreateVaryingFilterNode(const char *LAlias, const char *LProperty
     return filterNode;
 }
 
-FT_FilterNode* CreateConstFilterNode(const char *alias, const char *property, int op, SIValue val) {
+/* Find out which compare function should we use for given type. */
+CmpFunc _getCompareFunc(SIType t) {
     CmpFunc compareFunc = NULL;
-    FT_FilterNode* filterNode = (FT_FilterNode*)malloc(sizeof(FT_FilterNode));
 
-    // Find out which compare function should we use.
-    switch(val.type) {
+    switch(t) {
         case T_STRING:
             compareFunc = cmp_string;
             break;
@@ -89,12 +92,20 @@ FT_FilterNode* CreateConstFilterNode(const char *alias, const char *property, in
             break;
     }
 
+    return compareFunc;
+}
+
+FT_FilterNode* CreateConstFilterNode(const char *alias, const char *property, int op, SIValue val) {
+    CmpFunc compareFunc = _getCompareFunc(val.type);
+
     // Couldn't figure out which compare function to use.
     if(compareFunc == NULL) {
         // ERROR.
         return NULL;
     }
 
+    FT_FilterNode* filterNode = (FT_FilterNode*)malloc(sizeof(FT_FilterNode));
+
     // Create predicate node
     filterNode->t = FT_N_PRED;
     filterNode->pred.t = FT_N_CONSTANT;
@@ -103,11 +114,49 @@ FT_FilterNode* CreateConstFilterNode(const char *alias, const char *property, in
     filterNode->pred.Lop.property = strdup(property);
 
     filterNode->pred.op = op;
-    filterNode->pred.constVal = val; // Not sure about this assignmeant
+    filterNode->pred.constVal = val; // Value is owned by the AST.
     filterNode->pred.cf = compareFunc;
     return filterNode;
 }
 
+FT_FilterNode* CreateParamFilterNode(const char *alias, const char *property, int op, FT_Param *param) {
+    FT_FilterNode* filterNode = (FT_FilterNode*)malloc(sizeof(FT_FilterNode));
+
+    // Create predicate node,
+    // compare function is determined by bound value type.
+    filterNode->t = FT_N_PRED;
+    filterNode->pred.t = FT_N_PARAM;
+
+    filterNode->pred.Lop.alias = strdup(alias);
+    filterNode->pred.Lop.property = strdup(property);
+
+    filterNode->pred.op = op;
+    filterNode->pred.param = param;
+    filterNode->pred.cf = NULL;
+    return filterNode;
+}
+
+FT_Param* FilterTree_GetParam(TrieMap *params, const char *name) {
+    tm_len_t len = strlen(name);
+    FT_Param *param = TrieMap_Find(params, (char*)name, len);
+
+    if(param == TRIEMAP_NOTFOUND) {
+        param = malloc(sizeof(FT_Param));
+        param->name = strdup(name);
+        param->value = SI_NullVal();
+        param->bound = 0;
+        TrieMap_Add(params, (char*)name, len, param, NULL);
+    }
+
+    return param;
+}
+
+void FilterTree_FreeParam(void *param) {
+    /* Bound values are owned by the caller. */
+    free(((FT_Param*)param)->name);
+    free(param);
+}
+
 FT_FilterNode* CreateCondFilterNode(int op) {
     FT_FilterNode* filterNode = (FT_FilterNode*)malloc(sizeof(FT_FilterNode));
     filterNode->t = FT_N_COND;
@@ -133,9 +182,16 @@ FT_FilterNode* _CreateConstFilterNode(AST_PredicateNode n) {
     return CreateConstFilterNode(n.alias, n.property, n.op, n.constVal);
 }
 
+FT_FilterNode* _CreateParamFilterNode(AST_PredicateNode n, TrieMap *params) {
+    return CreateParamFilterNode(n.alias, n.property, n.op, FilterTree_GetParam(params, n.paramName));
+}
+
 FT_FilterNode* _FilterTree_ClonePredicateNode(const FT_FilterNode *root) {
     if(IsNodeConstantPredicate(root)) {
         return CreateConstFilterNode(root->pred.Lop.alias, root->pred.Lop.property, root->pred.op, SI_Clone(root->pred.constVal));
+    } else if(IsNodeParamPredicate(root)) {
+        /* Clones share the same parameter slot. */
+        return CreateParamFilterNode(root->pred.Lop.alias, root->pred.Lop.property, root->pred.op, root->pred.param);
     } else {
         /* Node is a varying predicate. */
         return CreateVaryingFilterNode(root->pred.Lop.alias, root->pred.Lop.property, root->pred.Rop.alias, root->pred.Rop.property, root->pred.op);
@@ -163,7 +219,7 @@ void _FilterTree_RemovePredNodes(FT_FilterNode **root, const Vector *aliases) {
         return;
     }
 
-    if(IsNodeConstantPredicate(*root)) {
+    if(IsNodeConstantPredicate(*root) || IsNodeParamPredicate(*root)) {
         if(_vectorContains(aliases, (*root)->pred.Lop.alias)) {
             FilterTree_Free(*root);
             *root = NULL;
@@ -193,7 +249,7 @@ void FilterTree_RemoveAllNodesExcept(FT_FilterNode **root, Vector *aliases) {
         return;
     }
 
-    if(IsNodeConstantPredicate(*root)) {
+    if(IsNodeConstantPredicate(*root) || IsNodeParamPredicate(*root)) {
         // Check if current node is not in aliases.
         if(!_vectorContains(aliases, (*root)->pred.Lop.alias)) {
             FilterTree_Free(*root);
@@ -206,6 +262,12 @@ void FilterTree_RemoveAllNodesExcept(FT_FilterNode **root, Vector *aliases) {
     FilterTree_RemoveAllNodesExcept(&(*root)->cond.right, aliases);
 }
 
+/* Replaces condition node with its only remaining child. */
+void _FilterTree_SquashNode(FT_FilterNode **root, FT_FilterNode *child) {
+    free(*root);
+    *root = child;
+}
+
 void FilterTree_Squash(FT_FilterNode **root) {
     if(*root == NULL) {
         return;
@@ -218,15 +280,13 @@ void FilterTree_Squash(FT_FilterNode **root) {
 
     // Left node was removed.
     if((*root)->cond.left == NULL) {
-        // TODO: Free current node.
-        *root = (*root)->cond.right;
+        _FilterTree_SquashNode(root, (*root)->cond.right);
         return FilterTree_Squash(root);
     }
 
     // Right node was removed.
     if((*root)->cond.right == NULL) {
-        // TODO: Free current node.
-        *root = (*root)->cond.left;
+        _FilterTree_SquashNode(root, (*root)->cond.left);
         return FilterTree_Squash(root);
     }
 
@@ -235,14 +295,12 @@ void FilterTree_Squash(FT_FilterNode **root) {
 
     // on return check squashed children
     if((*root)->cond.left == NULL) {
-        // TODO: Free current node.
-        *root = (*root)->cond.right;
+        _FilterTree_SquashNode(root, (*root)->cond.right);
         return;
     }
 
     if((*root)->cond.right == NULL) {
-        // TODO: Free current node.
-        *root = (*root)->cond.left;
+        _FilterTree_SquashNode(root, (*root)->cond.left);
         return;
     }
 }
@@ -255,10 +313,12 @@ FT_FilterNode* FilterTree_MinFilterTree(FT_FilterNode *root, Vector *aliases) {
     return minTree;
 }
 
-FT_FilterNode* BuildFiltersTree(const AST_FilterNode *root) {
+FT_FilterNode* BuildFiltersTree(const AST_FilterNode *root, TrieMap *params) {
     if(root->t == N_PRED) {
         if(root->pn.t == N_CONSTANT) {
             return _CreateConstFilterNode(root->pn);
+        } else if(root->pn.t == N_PARAMETER) {
+            return _CreateParamFilterNode(root->pn, params);
         } else {
             return _CreateVaryingFilterNode(root->pn);
         }
@@ -267,8 +327,8 @@ FT_FilterNode* BuildFiltersTree(const AST_FilterNode *root) {
     // root->t == N_COND
     // Create condition node
     FT_FilterNode* filterNode = CreateCondFilterNode(root->cn.op);
-    AppendLeftChild(filterNode, BuildFiltersTree(root->cn.left));
-    AppendRightChild(filterNode, BuildFiltersTree(root->cn.right));
+    AppendLeftChild(filterNode, BuildFiltersTree(root->cn.left, params));
+    AppendRightChild(filterNode, BuildFiltersTree(root->cn.right, params));
 	return filterNode;
 }
 
@@ -309,9 +369,15 @@ int _applyPredicateFilters(const Graph* g, const FT_FilterNode* root) {
     GraphEntity *entity;
     SIValue *aVal;
     SIValue *bVal;
+    CmpFunc cf = root->pred.cf;
 
     if(IsNodeConstantPredicate(root)) {
         bVal = (SIValue *)&root->pred.constVal;
+    } else if(IsNodeParamPredicate(root)) {
+        if(!root->pred.param->bound) return 0;
+        bVal = &root->pred.param->value;
+        cf = _getCompareFunc(bVal->type);
+        if(cf == NULL) return 0;
     } else {
         entity = Graph_GetEntityByAlias(g, root->pred.Rop.alias);
         if(!entity || entity->id == INVALID_ENTITY_ID) {
@@ -326,7 +392,7 @@ int _applyPredicateFilters(const Graph* g, const FT_FilterNode* root) {
     }
     aVal = GraphEntity_Get_Property(entity, root->pred.Lop.property);
 
-    return _applyFilter(aVal, bVal, root->pred.cf, root->pred.op);
+    return _applyFilter(aVal, bVal, cf, root->pred.op);
 }
 
 int applyFilters(const Graph* g, const FT_FilterNode* root) {
@@ -358,8 +424,8 @@ int FilterTree_ContainsNode(const FT_FilterNode *root, const Vector *aliases) {
     
     // Is this a predicate node?
     if(IsNodePredicate(root)) {
-        // For const predicate nodes, check only left predicate
-        if(IsNodeConstantPredicate(root)) {
+        // For const and parameter predicate nodes, check only left predicate
+        if(IsNodeConstantPredicate(root) || IsNodeParamPredicate(root)) {
             return _vectorContains(aliases, root->pred.Lop.alias);
         }
         
@@ -389,6 +455,15 @@ void _FilterTree_Print(const FT_FilterNode *root, int ident) {
         );
         return;
     }
+    if(IsNodeParamPredicate(root)) {
+        printf("%s.%s %d $%s\n",
+            root->pred.Lop.alias,
+            root->pred.Lop.property,
+            root->pred.op,
+            root->pred.param->name
+        );
+        return;
+    }
     if(IsNodeVaryingPredicate(root)) {
         printf("%s.%s %d %s.%s\n",
             root->pred.Lop.alias,
@@ -426,7 +501,8 @@ void _FreeConstFilterNode(FT_PredicateNode node) {
 }
 
 void _FilterTree_FreePredNode(FT_PredicateNode node) {
-    if(node.t == FT_N_CONSTANT) {
+    /* Parameter slots are owned by the params map. */
+    if(node.t == FT_N_CONSTANT || node.t == FT_N_PARAM) {
         _FreeConstFilterNode(node);
     } else {
         _FreeVaryingFilterNode(node);
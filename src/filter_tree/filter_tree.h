@@ -5,6 +5,7 @@
 #include "../parser/ast.h"
 #include "../graph/graph.h"
 #include "../redismodule.h"
+#include "../util/triemap/triemap.h"
 
 #define FILTER_FAIL 0
 #define FILTER_PASS 1
@@ -18,8 +19,17 @@ typedef enum {
 typedef enum {
 	FT_N_CONSTANT,
 	FT_N_VARYING,
+	FT_N_PARAM,
 } FT_CompareValueType;
 
+/* Query parameter slot, shared by every predicate referring to
+ * the parameter, value is bound right before execution. */
+typedef struct {
+	char *name;			/* Parameter name. */
+	SIValue value;		/* Bound value. */
+	int bound;			/* Was a value bound to this parameter. */
+} FT_Param;
+
 struct FT_FilterNode;
 
 typedef struct {
@@ -34,8 +44,9 @@ typedef struct {
 			char* alias;
 			char* property;
 		} Rop;
+		FT_Param *param;	/* Parameter to compare against. */
 	};
-	FT_CompareValueType t; 	/* Comapred value type, constant/node. */
+	FT_CompareValueType t; 	/* Comapred value type, constant/node/parameter. */
 	CmpFunc cf;				/* Compare function, determins relation between val and element property. */
 } FT_PredicateNode;
 
@@ -57,13 +68,19 @@ struct FT_FilterNode {
 typedef struct FT_FilterNode FT_FilterNode;
 
 /* Given AST's WHERE subtree constructs a filter tree
- * This is done to speed up the filtering process. */
-FT_FilterNode* BuildFiltersTree(const AST_FilterNode *root);
+ * This is done to speed up the filtering process,
+ * parameterized predicates refer to slots within params. */
+FT_FilterNode* BuildFiltersTree(const AST_FilterNode *root, TrieMap *params);
 
 FT_FilterNode* CreateVaryingFilterNode(const char *LAlias, const char *LProperty, const char *RAlias, const char *RProperty, int op);
 FT_FilterNode* CreateConstFilterNode(const char *alias, const char *property, int op, SIValue val);
+FT_FilterNode* CreateParamFilterNode(const char *alias, const char *property, int op, FT_Param *param);
 FT_FilterNode* CreateCondFilterNode(int op);
 
+/* Retrieves parameter slot from params, creates one if missing. */
+FT_Param* FilterTree_GetParam(TrieMap *params, const char *name);
+void FilterTree_FreeParam(void *param);
+
 FT_FilterNode *AppendLeftChild(FT_FilterNode *root, FT_FilterNode *child);
 FT_FilterNode *AppendRightChild(FT_FilterNode *root, FT_FilterNode *child);
 
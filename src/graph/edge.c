@@ -4,11 +4,16 @@
 
 #include "edge.h"
 #include "graph_entity.h"
+#include "../util/slab.h"
+
+static Slab *_edge_slab = NULL;
 
 Edge* NewEdge(long int id, Node *src, Node *dest, const char *relationship) {
 	assert(src && dest);
 
-	Edge* edge = (Edge*)calloc(1, sizeof(Edge));
+	if(!_edge_slab) _edge_slab = NewSlab(sizeof(Edge), SLAB_DEFAULT_CHUNK_OBJECTS);
+
+	Edge* edge = Slab_Calloc(_edge_slab);
 	edge->id = id;
 	edge->src = src;
 	edge->dest = dest;
@@ -36,5 +41,5 @@ void FreeEdge(Edge* edge) {
 		free(edge->relationship);
 	}
 	
-	free(edge);
+	Slab_Release(_edge_slab, edge);
 }
\ No newline at end of file
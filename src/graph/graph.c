@@ -188,6 +188,18 @@ char* Graph_GetEdgeAlias(const Graph *g, const Edge *e) {
     return NULL;
 }
 
+int Graph_GetAliasSlot(const Graph *g, const char *alias) {
+    if(alias == NULL) return GRAPH_NO_SLOT;
+
+    for(int i = 0; i < g->node_count; i++) {
+        if(strcmp(g->node_aliases[i], alias) == 0) return i;
+    }
+    for(int i = 0; i < g->edge_count; i++) {
+        if(strcmp(g->edge_aliases[i], alias) == 0) return g->node_count + i;
+    }
+    return GRAPH_NO_SLOT;
+}
+
 Node** Graph_GetNodeRef(const Graph *g, const Node *n) {
     assert(g && n);
     
@@ -229,10 +241,15 @@ void Graph_Free(Graph* g) {
         FreeNode(n);
     }
 
-    /* TODO: Free edges. */
+    /* Free graph's edges. */
+    for(i = 0; i < g->edge_count; i++) {
+        FreeEdge(g->edges[i]);
+    }
 
-    /* Edges are freed internaly by nodes */
+    /* Aliases are owned by the caller. */
     free(g->nodes);
     free(g->edges);
+    free(g->node_aliases);
+    free(g->edge_aliases);
     free(g);
 }
\ No newline at end of file
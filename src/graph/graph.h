@@ -6,6 +6,10 @@
 #include "../rmutil/vector.h"
 #include "../hexastore/hexastore.h"
 
+/* Query graph entities are addressed by binding slots,
+ * nodes occupy slots [0, node_count), edges follow. */
+#define GRAPH_NO_SLOT -1
+
 typedef struct {
     Node **nodes;
     Edge **edges;
@@ -56,6 +60,22 @@ char* Graph_GetEdgeAlias(const Graph *g, const Edge *e);
 Node** Graph_GetNodeRef(const Graph *g, const Node *n);
 Edge** Graph_GetEdgeRef(const Graph *g, const Edge *e);
 
+/* Looks up the binding slot of given alias, GRAPH_NO_SLOT if missing,
+ * slots are fixed once graph is built, resolve them at plan time. */
+int Graph_GetAliasSlot(const Graph *g, const char *alias);
+
+/* Retrieves entity currently bound to slot. */
+static inline GraphEntity* Graph_GetEntityBySlot(const Graph *g, int slot) {
+    if(slot < g->node_count) return (GraphEntity*)g->nodes[slot];
+    return (GraphEntity*)g->edges[slot - g->node_count];
+}
+
+/* Binds entity to slot. */
+static inline void Graph_SetEntityBySlot(Graph *g, int slot, GraphEntity *e) {
+    if(slot < g->node_count) g->nodes[slot] = (Node*)e;
+    else g->edges[slot - g->node_count] = (Edge*)e;
+}
+
 /* Frees entire graph */
 void Graph_Free(Graph* g);
 
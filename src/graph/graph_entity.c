@@ -27,6 +27,21 @@ SIValue* GraphEntity_Get_Property(const GraphEntity *e, const char* key) {
 	return PROPERTY_NOTFOUND;
 }
 
+SIValue* GraphEntity_Get_PropertyHint(const GraphEntity *e, const char* key, int *hint) {
+	int i = *hint;
+	if(i < e->prop_count && strcmp(key, e->properties[i].name) == 0) {
+		return &e->properties[i].value;
+	}
+
+	for(i = 0; i < e->prop_count; i++) {
+		if(strcmp(key, e->properties[i].name) == 0) {
+			*hint = i;
+			return &e->properties[i].value;
+		}
+	}
+	return PROPERTY_NOTFOUND;
+}
+
 void FreeGraphEntity(GraphEntity *e) {
 	if(e->properties == NULL) {
 		for(int i = 0; i < e->prop_count; i++) {
@@ -29,6 +29,12 @@ void GraphEntity_Add_Properties(GraphEntity *e, int prop_count, char **keys, SIV
  * constant value PROPERTY_NOTFOUND. */
 SIValue* GraphEntity_Get_Property(const GraphEntity *e, const char* key);
 
+/* Retrieves entity's property, checking index hint first,
+ * hint is updated to the index at which key was found.
+ * Entities bound to the same alias tend to share properties layout,
+ * such that most lookups are resolved by a single comparison. */
+SIValue* GraphEntity_Get_PropertyHint(const GraphEntity *e, const char* key, int *hint);
+
 /* Release all memory allocated by entity */
 void FreeGraphEntity(GraphEntity *e);
 
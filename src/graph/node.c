@@ -1,19 +1,37 @@
 #include <stdlib.h>
+#include <limits.h>
 
 #include "node.h"
 #include "edge.h"
 #include "assert.h"
 #include "graph_entity.h"
+#include "../util/slab.h"
+
+/* Nodes are carved out of a slab along with their edge lists,
+ * sparing three allocations per node. */
+typedef struct {
+	Node node;
+	Vector outgoingEdges;
+	Vector incomingEdges;
+} NodeBlock;
+
+static Slab *_node_slab = NULL;
 
 // SIValue* NODE_PROPERTY_NOTFOUND = &SI_StringValC("NOT FOUND");
 
 Node* NewNode(long int id, const char *label) {
-	Node* node = (Node*)calloc(1, sizeof(Node));
-	
+	if(!_node_slab) _node_slab = NewSlab(sizeof(NodeBlock), SLAB_DEFAULT_CHUNK_OBJECTS);
+
+	/* Edge lists start out empty, their buffers are allocated on first push. */
+	NodeBlock *block = Slab_Calloc(_node_slab);
+	block->outgoingEdges.elemSize = sizeof(Edge*);
+	block->incomingEdges.elemSize = sizeof(Edge*);
+
+	Node* node = &block->node;
 	node->id = id;
 	node->prop_count = 0;
-	node->outgoingEdges = NewVector(Edge*, 0);
-	node->incomingEdges = NewVector(Edge*, 0);
+	node->outgoingEdges = &block->outgoingEdges;
+	node->incomingEdges = &block->incomingEdges;
 	
 	if(label != NULL) {
 		node->label = strdup(label);
@@ -26,12 +44,188 @@ int Node_Compare(const Node *a, const Node *b) {
 	return a->id == b->id;
 }
 
+/* Edges missing a type sort ahead of typed ones. */
+static inline int _Node_CompareTypes(const char *a, const char *b) {
+	return strcmp(a ? a : "", b ? b : "");
+}
+
+/* Node e leads to from the node whose edge list it's in. */
+static inline long int _Node_NeighbourID(const Edge *e, int outgoing) {
+	return outgoing ? e->dest->id : e->src->id;
+}
+
+/* Orders edge against (relation, id). */
+static inline int _Node_CompareEdge(const Edge *e, int outgoing, const char *relation, long int id) {
+	int c = _Node_CompareTypes(e->relationship, relation);
+	if(c != 0) return c;
+	long int neighbour = _Node_NeighbourID(e, outgoing);
+	return (neighbour > id) - (neighbour < id);
+}
+
+/* Position of the first edge within [lo, hi) not ordered ahead of (relation, id). */
+static int _Node_Search(Edge **edges, int lo, int hi, int outgoing,
+						const char *relation, long int id) {
+	while(lo < hi) {
+		int mid = lo + (hi - lo) / 2;
+		int c = _Node_CompareEdge(edges[mid], outgoing, relation, id);
+		if(c < 0) lo = mid + 1;
+		else hi = mid;
+	}
+	return lo;
+}
+
+/* Position of the first edge at or past from, within [from, hi),
+ * of type relation leading to a neighbour with an ID no smaller than id.
+ * Probes exponentially growing distances before searching in between,
+ * such that successive probes over a list cost a single pass at most. */
+static int _Node_Gallop(Edge **edges, int from, int hi, int outgoing, const char *relation, long int id) {
+	int lo = from;
+	int bound = from;
+	int step = 1;
+	while(bound < hi && _Node_CompareEdge(edges[bound], outgoing, relation, id) < 0) {
+		lo = bound + 1;
+		bound += step;
+		step <<= 1;
+	}
+	if(bound > hi) bound = hi;
+	return _Node_Search(edges, lo, bound, outgoing, relation, id);
+}
+
+static inline int _Node_CompareEdges(const Edge *a, const Edge *b, int outgoing) {
+	return _Node_CompareEdge(a, outgoing, b->relationship, _Node_NeighbourID(b, outgoing));
+}
+
+/* Merges the sorted runs [0, mid) and [mid, len) of edges using tmp,
+ * ties favour the first run, keeping parallel edges in insertion order. */
+static void _Node_Merge(Edge **edges, int mid, int len, Edge **tmp, int outgoing) {
+	/* Edges connected in order need no merging. */
+	if(mid == 0 || mid == len || _Node_CompareEdges(edges[mid - 1], edges[mid], outgoing) <= 0) return;
+
+	memcpy(tmp, edges, sizeof(Edge*) * len);
+	int i = 0;
+	int j = mid;
+	int k = 0;
+	while(i < mid && j < len) {
+		if(_Node_CompareEdges(tmp[j], tmp[i], outgoing) < 0) edges[k++] = tmp[j++];
+		else edges[k++] = tmp[i++];
+	}
+	while(i < mid) edges[k++] = tmp[i++];
+	while(j < len) edges[k++] = tmp[j++];
+}
+
+static void _Node_MergeSort(Edge **edges, int len, Edge **tmp, int outgoing) {
+	if(len < 2) return;
+	int mid = len / 2;
+	_Node_MergeSort(edges, mid, tmp, outgoing);
+	_Node_MergeSort(edges + mid, len - mid, tmp, outgoing);
+	_Node_Merge(edges, mid, len, tmp, outgoing);
+}
+
+/* Sorts the edges appended past the sorted prefix of edges and merges them in,
+ * such that a batch of connections costs a single pass over the list. */
+static void _Node_SortEdges(Vector *edges, int *sorted, int outgoing) {
+	int len = Vector_Size(edges);
+	if(*sorted == len) return;
+
+	Edge **data = (Edge**)edges->data;
+	Edge **tmp = malloc(sizeof(Edge*) * len);
+	_Node_MergeSort(data + *sorted, len - *sorted, tmp, outgoing);
+	_Node_Merge(data, *sorted, len, tmp, outgoing);
+	free(tmp);
+	*sorted = len;
+}
+
+/* n's outgoing edges if outgoing is set, incoming edges otherwise, sorted. */
+static Vector *_Node_SortedEdges(const Node *n, int outgoing) {
+	/* Sorting leaves n's edges unchanged, only their order. */
+	Node *node = (Node*)n;
+	if(outgoing) _Node_SortEdges(node->outgoingEdges, &node->outgoingSorted, 1);
+	else _Node_SortEdges(node->incomingEdges, &node->incomingSorted, 0);
+	return outgoing ? node->outgoingEdges : node->incomingEdges;
+}
+
+void Node_SortEdges(const Node *n) {
+	_Node_SortedEdges(n, 1);
+	_Node_SortedEdges(n, 0);
+}
+
 void Node_ConnectNode(Node* src, Node* dest, struct Edge* e) {
 	// assert(src && dest && e->src == src && e->dest == dest);
+	/* Appending spares hubs a shift of their edge lists per connection. */
 	Vector_Push(src->outgoingEdges, e);
 	Vector_Push(dest->incomingEdges, e);
 }
 
+/* Removes e from edges, keeping them sorted. */
+static void _Node_RemoveEdge(Vector *edges, int *sorted, Edge *e, int outgoing) {
+	_Node_SortEdges(edges, sorted, outgoing);
+	Edge **data = (Edge**)edges->data;
+	int len = Vector_Size(edges);
+	long int id = _Node_NeighbourID(e, outgoing);
+	int pos = _Node_Search(data, 0, len, outgoing, e->relationship, id);
+
+	/* Parallel edges share a position, look for e among them. */
+	for(; pos < len && _Node_CompareEdge(data[pos], outgoing, e->relationship, id) == 0; pos++) {
+		if(data[pos] != e) continue;
+		memmove(data + pos, data + pos + 1, sizeof(Edge*) * (len - pos - 1));
+		edges->top--;
+		(*sorted)--;
+		return;
+	}
+}
+
+void Node_DisconnectNode(Node* src, Node* dest, struct Edge* e) {
+	_Node_RemoveEdge(src->outgoingEdges, &src->outgoingSorted, e, 1);
+	_Node_RemoveEdge(dest->incomingEdges, &dest->incomingSorted, e, 0);
+}
+
+int Node_EdgeRun(const Node *n, int outgoing, const char *relation, int *first) {
+	Vector *v = _Node_SortedEdges(n, outgoing);
+	Edge **edges = (Edge**)v->data;
+	int len = Vector_Size(v);
+	/* IDs are non negative, (relation, -1) precedes every edge of type relation. */
+	*first = _Node_Search(edges, 0, len, outgoing, relation, -1);
+	int end = _Node_Search(edges, *first, len, outgoing, relation, LONG_MAX);
+	return end - *first;
+}
+
+/* Appends the edges within [from, hi) of type relation
+ * leading to id, returns the position past them. */
+static int _Node_CollectRun(Edge **edges, int from, int hi, int outgoing,
+							const char *relation, long int id, Vector *out, int *count) {
+	int pos = _Node_Gallop(edges, from, hi, outgoing, relation, id);
+	while(pos < hi && _Node_CompareEdge(edges[pos], outgoing, relation, id) == 0) {
+		Edge *e = edges[pos++];
+		Vector_Push(out, e);
+		(*count)++;
+	}
+	return pos;
+}
+
+int Node_GetEdges(const Node *src, const Node *dest, const char *relation, Vector *out) {
+	/* Search the shorter of the two lists. */
+	int outgoing = Vector_Size(src->outgoingEdges) <= Vector_Size(dest->incomingEdges);
+	Vector *v = _Node_SortedEdges(outgoing ? src : dest, outgoing);
+	long int id = outgoing ? dest->id : src->id;
+	Edge **edges = (Edge**)v->data;
+	int len = Vector_Size(v);
+	int count = 0;
+
+	if(relation) {
+		_Node_CollectRun(edges, 0, len, outgoing, relation, id, out, &count);
+		return count;
+	}
+
+	/* Any type, search each type's run in turn. */
+	int pos = 0;
+	while(pos < len) {
+		const char *type = edges[pos]->relationship;
+		pos = _Node_CollectRun(edges, pos, len, outgoing, type, id, out, &count);
+		pos = _Node_Gallop(edges, pos, len, outgoing, type, LONG_MAX);
+	}
+	return count;
+}
+
 int Node_IncomeDegree(const Node *n) {
 	return Vector_Size(n->incomingEdges);
 }
@@ -59,11 +253,11 @@ void FreeNode(Node* node) {
 	 * 	Vector_Get(node->outgoingEdges, i, &e);
 	 * 	FreeEdge(e);
 	 * } */
-	Vector_Free(node->outgoingEdges);
+	free(node->outgoingEdges->data);
 
 	/* There's no need to discard incoming edges.
 	 * these will be freed on another outgoingEdges free. */ 
-	Vector_Free(node->incomingEdges);
-	free(node);
+	free(node->incomingEdges->data);
+	Slab_Release(_node_slab, (NodeBlock*)node);
 	node = NULL;
 }
\ No newline at end of file
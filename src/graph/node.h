@@ -15,8 +15,10 @@ typedef struct {
 		EntityProperty *properties;
 	};
 	char *label;			/* label attached to node */
-	Vector* outgoingEdges;	/* list of incoming edges (ME)<-(SRC) */
-	Vector* incomingEdges;	/* list on outgoing edges (ME)->(DEST) */
+	Vector* outgoingEdges;	/* list of outgoing edges (ME)->(DEST), sorted by type then DEST ID */
+	Vector* incomingEdges;	/* list of incoming edges (ME)<-(SRC), sorted by type then SRC ID */
+	int outgoingSorted;		/* length of outgoingEdges sorted prefix, edges past it await sorting */
+	int incomingSorted;		/* length of incomingEdges sorted prefix, edges past it await sorting */
 } Node;
 
 /* Creates a new node. */
@@ -28,9 +30,26 @@ int Node_Compare(const Node *a, const Node *b);
 /* Returns number of edges pointing into node */
 int Node_IncomeDegree(const Node *n);
 
-/* Connects source node to destination node by edge */
+/* Connects source node to destination node by edge.
+ * The edge is appended to both nodes edge lists, which are
+ * sorted again lazily, once next searched. */
 void Node_ConnectNode(Node* src, Node* dest, struct Edge* e);
 
+/* Removes edge e from src's outgoing edges and from dest's incoming edges. */
+void Node_DisconnectNode(Node* src, Node* dest, struct Edge* e);
+
+/* Sorts n's edge lists, merging edges connected since they were last sorted. */
+void Node_SortEdges(const Node *n);
+
+/* Locates the run of edges of type relation within n's outgoing edges
+ * if outgoing is set, incoming edges otherwise, sorting them if needed.
+ * Sets first to the run's start and returns its length. */
+int Node_EdgeRun(const Node *n, int outgoing, const char *relation, int *first);
+
+/* Appends each edge of type relation (any type if NULL)
+ * connecting src to dest to edges, returns the number of edges appended. */
+int Node_GetEdges(const Node *src, const Node *dest, const char *relation, Vector *edges);
+
 /* Adds a properties to node
  * prop_count - number of new properties to add 
  * keys - array of properties keys 
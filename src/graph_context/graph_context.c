@@ -0,0 +1,804 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "graph_context.h"
+#include "../graph/node.h"
+#include "../graph/edge.h"
+#include "../hexastore/triplet.h"
+#include "../execution_plan/plan_cache.h"
+
+/* declaration of the type for redis registration. */
+RedisModuleType *GraphContextRedisModuleType;
+
+GraphContext *NewGraphContext(const char *name) {
+    GraphContext *gc = malloc(sizeof(GraphContext));
+    gc->name = strdup(name);
+    gc->nodes = NewTrieMap();
+    gc->edges = NewTrieMap();
+    gc->node_table = NULL;
+    gc->node_count = 0;
+    gc->node_cap = 0;
+    gc->label_bitmaps = NewTrieMap();
+    gc->type_stores = NewTrieMap();
+    gc->hexastore = _NewHexaStore();
+    gc->plan_cache = NewPlanCache(PLAN_CACHE_DEFAULT_CAPACITY);
+    gc->edge_stats = NULL;
+    gc->edge_stats_count = 0;
+    gc->edge_stats_cap = 0;
+    gc->node_schema = NewSchema(NULL);
+    gc->edge_schema = NewSchema(NULL);
+    gc->label_schemas = NewTrieMap();
+    gc->type_schemas = NewTrieMap();
+    gc->string_dicts = NewTrieMap();
+    return gc;
+}
+
+GraphContext *GraphContext_Get(RedisModuleCtx *ctx, const char *graph, int create) {
+    GraphContext *gc = NULL;
+
+    RedisModuleString *rmGraph = RedisModule_CreateString(ctx, graph, strlen(graph));
+    /* Only creating a graph writes to its key, readonly commands may get graphs too. */
+    int mode = create ? REDISMODULE_WRITE : REDISMODULE_READ;
+    RedisModuleKey *key = RedisModule_OpenKey(ctx, rmGraph, mode);
+    RedisModule_FreeString(ctx, rmGraph);
+
+    int type = RedisModule_KeyType(key);
+
+    if(type == REDISMODULE_KEYTYPE_EMPTY) {
+        if(create) {
+            gc = NewGraphContext(graph);
+            RedisModule_ModuleTypeSetValue(key, GraphContextRedisModuleType, gc);
+        }
+    } else if(type == REDISMODULE_KEYTYPE_MODULE &&
+              RedisModule_ModuleTypeGetType(key) == GraphContextRedisModuleType) {
+        gc = RedisModule_ModuleTypeGetValue(key);
+    }
+
+    RedisModule_CloseKey(key);
+    return gc;
+}
+
+/* Looks up store under key within stores map,
+ * creates a new store if one does not exists. */
+Store *_GraphContext_GetStore(GraphContext *gc, TrieMap *stores, const char *key) {
+    tm_len_t len = strlen(key);
+    Store *store = TrieMap_Find(stores, (char*)key, len);
+
+    if(store == TRIEMAP_NOTFOUND) {
+        store = NewTrieMap();
+        TrieMap_Add(stores, (char*)key, len, store, NULL);
+        /* Schema changed, cached plans might be outdated. */
+        PlanCache_Clear(gc->plan_cache);
+    }
+
+    return store;
+}
+
+Store *GraphContext_GetStore(GraphContext *gc, StoreType type, const char *label) {
+    if(type == STORE_NODE) {
+        /* Labeled nodes are kept within label bitmaps. */
+        return (label == NULL) ? gc->nodes : NULL;
+    }
+
+    if(label == NULL) return gc->edges;
+    return _GraphContext_GetStore(gc, gc->type_stores, label);
+}
+
+Store *GraphContext_GetTypeStore(const GraphContext *gc, const char *type) {
+    if(type == NULL) return gc->edges;
+    Store *store = TrieMap_Find(gc->type_stores, (char*)type, strlen(type));
+    return (store == TRIEMAP_NOTFOUND) ? NULL : store;
+}
+
+Bitmap *GraphContext_GetLabelBitmap(const GraphContext *gc, const char *label) {
+    Bitmap *bitmap = TrieMap_Find(gc->label_bitmaps, (char*)label, strlen(label));
+    return (bitmap == TRIEMAP_NOTFOUND) ? NULL : bitmap;
+}
+
+/* Looks up label's bitmap, creates a new bitmap if one does not exists,
+ * labels are introduced by node insertions only. */
+Bitmap *_GraphContext_GetLabelBitmap(GraphContext *gc, const char *label) {
+    tm_len_t len = strlen(label);
+    Bitmap *bitmap = TrieMap_Find(gc->label_bitmaps, (char*)label, len);
+
+    if(bitmap == TRIEMAP_NOTFOUND) {
+        bitmap = NewBitmap();
+        TrieMap_Add(gc->label_bitmaps, (char*)label, len, bitmap, NULL);
+        /* Schema changed, cached plans might be outdated. */
+        PlanCache_Clear(gc->plan_cache);
+    }
+
+    return bitmap;
+}
+
+void GraphContext_AddNode(GraphContext *gc, Node *n) {
+    char id[32];
+    snprintf(id, 32, "%ld", n->id);
+    Store_Insert(gc->nodes, id, n);
+
+    if(gc->node_count == gc->node_cap) {
+        gc->node_cap = (gc->node_cap > 0) ? gc->node_cap * 2 : 64;
+        gc->node_table = realloc(gc->node_table, sizeof(Node*) * gc->node_cap);
+    }
+    uint32_t idx = gc->node_count++;
+    gc->node_table[idx] = n;
+
+    if(n->label) Bitmap_Add(_GraphContext_GetLabelBitmap(gc, n->label), idx);
+    GraphContext_UpdateSchema(gc, STORE_NODE, n->label, (GraphEntity*)n);
+    GraphContext_InternProperties(gc, (GraphEntity*)n);
+}
+
+uint64_t GraphContext_LabelCardinality(const GraphContext *gc, const char *label) {
+    if(label == NULL) return gc->node_count;
+    Bitmap *bitmap = GraphContext_GetLabelBitmap(gc, label);
+    return bitmap ? Bitmap_Cardinality(bitmap) : 0;
+}
+
+uint64_t GraphContext_TypeCardinality(const GraphContext *gc, const char *type) {
+    Store *store = GraphContext_GetTypeStore(gc, type);
+    return store ? Store_Cardinality(store) : 0;
+}
+
+Node *GraphContext_GetNodeByIndex(const GraphContext *gc, uint32_t idx) {
+    return gc->node_table[idx];
+}
+
+HexaStore *GraphContext_GetHexaStore(GraphContext *gc) {
+    return gc->hexastore;
+}
+
+/* Compares labels, either of which might be missing. */
+static inline int _GraphContext_LabelEq(const char *a, const char *b) {
+    if(a == NULL || b == NULL) return a == b;
+    return strcmp(a, b) == 0;
+}
+
+void GraphContext_CountEdge(GraphContext *gc, const Edge *e) {
+    /* Label and type combinations are few, a linear search will do. */
+    for(int i = 0; i < gc->edge_stats_count; i++) {
+        EdgeStats *stats = &gc->edge_stats[i];
+        if(_GraphContext_LabelEq(stats->relation, e->relationship) &&
+           _GraphContext_LabelEq(stats->src, e->src->label) &&
+           _GraphContext_LabelEq(stats->dest, e->dest->label)) {
+            stats->count++;
+            return;
+        }
+    }
+
+    if(gc->edge_stats_count == gc->edge_stats_cap) {
+        gc->edge_stats_cap = (gc->edge_stats_cap > 0) ? gc->edge_stats_cap * 2 : 8;
+        gc->edge_stats = realloc(gc->edge_stats, sizeof(EdgeStats) * gc->edge_stats_cap);
+    }
+
+    EdgeStats *stats = &gc->edge_stats[gc->edge_stats_count++];
+    stats->src = e->src->label ? strdup(e->src->label) : NULL;
+    stats->relation = e->relationship ? strdup(e->relationship) : NULL;
+    stats->dest = e->dest->label ? strdup(e->dest->label) : NULL;
+    stats->count = 1;
+}
+
+/* Takes a removed edge out of graph's edge statistics. */
+static void _GraphContext_UncountEdge(GraphContext *gc, const Edge *e) {
+    for(int i = 0; i < gc->edge_stats_count; i++) {
+        EdgeStats *stats = &gc->edge_stats[i];
+        if(_GraphContext_LabelEq(stats->relation, e->relationship) &&
+           _GraphContext_LabelEq(stats->src, e->src->label) &&
+           _GraphContext_LabelEq(stats->dest, e->dest->label)) {
+            stats->count--;
+            return;
+        }
+    }
+}
+
+void GraphContext_AddEdge(GraphContext *gc, Edge *e) {
+    char id[32];
+    snprintf(id, 32, "%ld", e->id);
+
+    Store_Insert(gc->edges, id, e);
+    if(e->relationship) {
+        Store_Insert(GraphContext_GetStore(gc, STORE_EDGE, e->relationship), id, e);
+    }
+    Node_ConnectNode(e->src, e->dest, e);
+    GraphContext_CountEdge(gc, e);
+    GraphContext_UpdateSchema(gc, STORE_EDGE, e->relationship, (GraphEntity*)e);
+    GraphContext_InternProperties(gc, (GraphEntity*)e);
+
+    /* Each of the 6 permutations refers to the edge itself. */
+    HexaStore_InsertAllPerm(gc->hexastore, e);
+}
+
+void GraphContext_RemoveEdge(GraphContext *gc, Edge *e) {
+    char id[32];
+    snprintf(id, 32, "%ld", e->id);
+
+    HexaStore_RemoveAllPerm(gc->hexastore, e);
+    Node_DisconnectNode(e->src, e->dest, e);
+    Store_Remove(gc->edges, id);
+    if(e->relationship) {
+        Store *type_store = GraphContext_GetTypeStore(gc, e->relationship);
+        if(type_store) Store_Remove(type_store, id);
+    }
+    _GraphContext_UncountEdge(gc, e);
+    FreeEdge(e);
+}
+
+long int GraphContext_EdgeCount(const GraphContext *gc, const char *src,
+                                const char *relation, const char *dest) {
+    long int count = 0;
+    for(int i = 0; i < gc->edge_stats_count; i++) {
+        const EdgeStats *stats = &gc->edge_stats[i];
+        if(src && !_GraphContext_LabelEq(stats->src, src)) continue;
+        if(relation && !_GraphContext_LabelEq(stats->relation, relation)) continue;
+        if(dest && !_GraphContext_LabelEq(stats->dest, dest)) continue;
+        count += stats->count;
+    }
+    return count;
+}
+
+/* Looks up schema under key within schemas map,
+ * creates a new schema if one does not exists. */
+Schema *_GraphContext_GetSchema(TrieMap *schemas, const char *key) {
+    tm_len_t len = strlen(key);
+    Schema *s = TrieMap_Find(schemas, (char*)key, len);
+
+    if(s == TRIEMAP_NOTFOUND) {
+        s = NewSchema(key);
+        TrieMap_Add(schemas, (char*)key, len, s, NULL);
+    }
+
+    return s;
+}
+
+void GraphContext_UpdateSchema(GraphContext *gc, StoreType type, const char *label,
+                               const GraphEntity *e) {
+    Schema *all = (type == STORE_NODE) ? gc->node_schema : gc->edge_schema;
+    int introduced = Schema_AddAttributes(all, e);
+
+    if(label) {
+        TrieMap *schemas = (type == STORE_NODE) ? gc->label_schemas : gc->type_schemas;
+        introduced += Schema_AddAttributes(_GraphContext_GetSchema(schemas, label), e);
+    }
+
+    /* Collapsed entities expand to their schema, cached plans might be outdated. */
+    if(introduced) PlanCache_Clear(gc->plan_cache);
+}
+
+Schema *GraphContext_GetSchema(const GraphContext *gc, StoreType type, const char *label) {
+    if(label == NULL) return (type == STORE_NODE) ? gc->node_schema : gc->edge_schema;
+
+    TrieMap *schemas = (type == STORE_NODE) ? gc->label_schemas : gc->type_schemas;
+    Schema *s = TrieMap_Find(schemas, (char*)label, strlen(label));
+    return (s == TRIEMAP_NOTFOUND) ? NULL : s;
+}
+
+/* Returns property's string dictionary, created on demand. */
+StringDict *_GraphContext_GetStringDict(GraphContext *gc, const char *property) {
+    tm_len_t len = strlen(property);
+    StringDict *d = TrieMap_Find(gc->string_dicts, (char*)property, len);
+
+    if(d == TRIEMAP_NOTFOUND) {
+        d = NewStringDict(property);
+        TrieMap_Add(gc->string_dicts, (char*)property, len, d, NULL);
+    }
+
+    return d;
+}
+
+void GraphContext_InternProperties(GraphContext *gc, GraphEntity *e) {
+    for(int i = 0; i < e->prop_count; i++) {
+        EntityProperty *prop = &e->properties[i];
+        if(prop->value.type != T_STRING || prop->value.code) continue;
+        StringDict_Intern(_GraphContext_GetStringDict(gc, prop->name), &prop->value);
+    }
+}
+
+StringDict *GraphContext_GetStringDict(const GraphContext *gc, const char *property) {
+    StringDict *d = TrieMap_Find(gc->string_dicts, (char*)property, strlen(property));
+    return (d == TRIEMAP_NOTFOUND) ? NULL : d;
+}
+
+void _GraphContext_FreeEntity(void *entity) {
+    /* Entities are freed by their own free functions. */
+}
+
+void _GraphContext_FreeStore(void *store) {
+    /* Stored entities are owned by the nodes/edges stores. */
+    Store_Free((Store*)store, _GraphContext_FreeEntity);
+}
+
+void _GraphContext_FreeBitmap(void *bitmap) {
+    Bitmap_Free((Bitmap*)bitmap);
+}
+
+void _GraphContext_FreeSchema(void *schema) {
+    Schema_Free((Schema*)schema);
+}
+
+void _GraphContext_FreeStringDict(void *d) {
+    StringDict_Free((StringDict*)d);
+}
+
+size_t _GraphContext_VectorMemUsage(const Vector *v) {
+    if(v == NULL) return 0;
+    return sizeof(Vector) + v->cap * v->elemSize;
+}
+
+size_t _GraphContext_PropertiesMemUsage(const GraphEntity *e) {
+    size_t size = e->prop_count * sizeof(EntityProperty);
+    for(int i = 0; i < e->prop_count; i++) {
+        EntityProperty *prop = &e->properties[i];
+        size += strlen(prop->name) + 1;
+        /* Interned strings are accounted for by their dictionary. */
+        if(prop->value.type == T_STRING && !prop->value.code) size += prop->value.stringval.len + 1;
+    }
+    return size;
+}
+
+/* Sums the memory used by each bitmap within bitmaps map. */
+size_t _GraphContext_BitmapsMemUsage(TrieMap *bitmaps) {
+    char *key;
+    tm_len_t len;
+    void *bitmap;
+    size_t size = sizeof(TrieMap) + TrieMap_MemUsage(bitmaps);
+
+    TrieMapIterator *it = TrieMap_Iterate(bitmaps, "", 0);
+    while(TrieMapIterator_Next(it, &key, &len, &bitmap)) {
+        size += Bitmap_MemUsage((Bitmap*)bitmap);
+    }
+    TrieMapIterator_Free(it);
+    return size;
+}
+
+/* Sums the memory used by each store within stores map. */
+size_t _GraphContext_StoresMemUsage(TrieMap *stores) {
+    char *key;
+    tm_len_t len;
+    void *store;
+    size_t size = sizeof(TrieMap) + TrieMap_MemUsage(stores);
+
+    TrieMapIterator *it = TrieMap_Iterate(stores, "", 0);
+    while(TrieMapIterator_Next(it, &key, &len, &store)) {
+        size += Store_MemUsage((Store*)store);
+    }
+    TrieMapIterator_Free(it);
+    return size;
+}
+
+/* Sums the memory used by each schema within schemas map. */
+size_t _GraphContext_SchemasMemUsage(TrieMap *schemas) {
+    char *key;
+    tm_len_t len;
+    void *schema;
+    size_t size = sizeof(TrieMap) + TrieMap_MemUsage(schemas);
+
+    TrieMapIterator *it = TrieMap_Iterate(schemas, "", 0);
+    while(TrieMapIterator_Next(it, &key, &len, &schema)) {
+        size += Schema_MemUsage((Schema*)schema);
+    }
+    TrieMapIterator_Free(it);
+    return size;
+}
+
+/* Sums the memory used and saved by each string dictionary. */
+size_t _GraphContext_StringDictsMemUsage(TrieMap *dicts, size_t *savings) {
+    char *key;
+    tm_len_t len;
+    void *d;
+    size_t size = sizeof(TrieMap) + TrieMap_MemUsage(dicts);
+
+    *savings = 0;
+    TrieMapIterator *it = TrieMap_Iterate(dicts, "", 0);
+    while(TrieMapIterator_Next(it, &key, &len, &d)) {
+        size += StringDict_MemUsage((StringDict*)d);
+        *savings += StringDict_Savings((StringDict*)d);
+    }
+    TrieMapIterator_Free(it);
+    return size;
+}
+
+void GraphContext_MemUsage(const GraphContext *gc, GraphMemoryUsage *usage) {
+    char *key;
+    tm_len_t len;
+    void *value;
+
+    memset(usage, 0, sizeof(GraphMemoryUsage));
+
+    StoreIterator *it = Store_Search(gc->nodes, "");
+    while(StoreIterator_Next(it, &key, &len, &value)) {
+        Node *n = (Node*)value;
+        usage->nodes += sizeof(Node);
+        if(n->label) usage->nodes += strlen(n->label) + 1;
+        usage->nodes += _GraphContext_VectorMemUsage(n->outgoingEdges);
+        usage->nodes += _GraphContext_VectorMemUsage(n->incomingEdges);
+        usage->properties += _GraphContext_PropertiesMemUsage((GraphEntity*)n);
+    }
+    StoreIterator_Free(it);
+
+    it = Store_Search(gc->edges, "");
+    while(StoreIterator_Next(it, &key, &len, &value)) {
+        Edge *e = (Edge*)value;
+        usage->edges += sizeof(Edge);
+        if(e->relationship) usage->edges += strlen(e->relationship) + 1;
+        usage->properties += _GraphContext_PropertiesMemUsage((GraphEntity*)e);
+    }
+    StoreIterator_Free(it);
+
+    usage->node_store = Store_MemUsage(gc->nodes) + sizeof(Node*) * gc->node_cap;
+    usage->edge_store = Store_MemUsage(gc->edges);
+    usage->label_bitmaps = _GraphContext_BitmapsMemUsage(gc->label_bitmaps);
+    usage->type_stores = _GraphContext_StoresMemUsage(gc->type_stores);
+    usage->hexastore = HexaStore_MemUsage(gc->hexastore);
+    /* Graphs are not indexed yet. */
+    usage->indexes = 0;
+    usage->schemas = Schema_MemUsage(gc->node_schema) + Schema_MemUsage(gc->edge_schema) +
+                     _GraphContext_SchemasMemUsage(gc->label_schemas) +
+                     _GraphContext_SchemasMemUsage(gc->type_schemas);
+    usage->dictionaries = _GraphContext_StringDictsMemUsage(gc->string_dicts, &usage->dictionary_savings);
+
+    size_t edge_stats = sizeof(EdgeStats) * gc->edge_stats_cap;
+    for(int i = 0; i < gc->edge_stats_count; i++) {
+        EdgeStats *stats = &gc->edge_stats[i];
+        if(stats->src) edge_stats += strlen(stats->src) + 1;
+        if(stats->relation) edge_stats += strlen(stats->relation) + 1;
+        if(stats->dest) edge_stats += strlen(stats->dest) + 1;
+    }
+
+    usage->total = sizeof(GraphContext) + strlen(gc->name) + 1 + edge_stats +
+                   usage->nodes + usage->edges + usage->properties +
+                   usage->node_store + usage->label_bitmaps +
+                   usage->edge_store + usage->type_stores +
+                   usage->hexastore + usage->indexes + usage->schemas +
+                   usage->dictionaries;
+}
+
+void GraphContext_Free(GraphContext *gc) {
+    char *key;
+    tm_len_t len;
+    void *value;
+
+    /* Cached plans refer to the graph's stores. */
+    PlanCache_Free(gc->plan_cache);
+
+    /* Hexastore refers to edges, which are freed along with the edge store. */
+    TrieMap_Free(gc->hexastore, _GraphContext_FreeEntity);
+
+    TrieMap_Free(gc->label_bitmaps, _GraphContext_FreeBitmap);
+    TrieMap_Free(gc->type_stores, _GraphContext_FreeStore);
+
+    StoreIterator *store_it = Store_Search(gc->edges, "");
+    while(StoreIterator_Next(store_it, &key, &len, &value)) {
+        FreeEdge((Edge*)value);
+    }
+    StoreIterator_Free(store_it);
+    Store_Free(gc->edges, _GraphContext_FreeEntity);
+
+    store_it = Store_Search(gc->nodes, "");
+    while(StoreIterator_Next(store_it, &key, &len, &value)) {
+        FreeNode((Node*)value);
+    }
+    StoreIterator_Free(store_it);
+    Store_Free(gc->nodes, _GraphContext_FreeEntity);
+    free(gc->node_table);
+
+    for(int i = 0; i < gc->edge_stats_count; i++) {
+        free(gc->edge_stats[i].src);
+        free(gc->edge_stats[i].relation);
+        free(gc->edge_stats[i].dest);
+    }
+    free(gc->edge_stats);
+
+    TrieMap_Free(gc->label_schemas, _GraphContext_FreeSchema);
+    TrieMap_Free(gc->type_schemas, _GraphContext_FreeSchema);
+    Schema_Free(gc->node_schema);
+    Schema_Free(gc->edge_schema);
+    /* Interned property values point into dictionaries, freed last. */
+    TrieMap_Free(gc->string_dicts, _GraphContext_FreeStringDict);
+
+    free(gc->name);
+    free(gc);
+}
+
+/* Saved in place of a value's type for interned strings, followed by their code. */
+#define GRAPHCONTEXT_INTERNED_STRING 0x10000
+
+/* Serialization of a single property value. */
+void _GraphContextType_SaveValue(RedisModuleIO *rdb, const SIValue *v) {
+    if(v->type == T_STRING && v->code) {
+        RedisModule_SaveUnsigned(rdb, GRAPHCONTEXT_INTERNED_STRING);
+        RedisModule_SaveUnsigned(rdb, v->code);
+        return;
+    }
+
+    RedisModule_SaveUnsigned(rdb, v->type);
+    switch(v->type) {
+        case T_STRING:
+            RedisModule_SaveStringBuffer(rdb, v->stringval.str, v->stringval.len);
+            break;
+        case T_INT32:
+            RedisModule_SaveSigned(rdb, v->intval);
+            break;
+        case T_INT64:
+            RedisModule_SaveSigned(rdb, v->longval);
+            break;
+        case T_UINT:
+            RedisModule_SaveUnsigned(rdb, v->uintval);
+            break;
+        case T_BOOL:
+            RedisModule_SaveSigned(rdb, v->boolval);
+            break;
+        case T_FLOAT:
+            RedisModule_SaveFloat(rdb, v->floatval);
+            break;
+        case T_DOUBLE:
+            RedisModule_SaveDouble(rdb, v->doubleval);
+            break;
+        default:
+            break;
+    }
+}
+
+/* Loads a single property value, interned strings are resolved by
+ * the dictionary of the value's property. */
+SIValue _GraphContextType_LoadValue(RedisModuleIO *rdb, StringDict *d) {
+    uint64_t t = RedisModule_LoadUnsigned(rdb);
+    SIValue v;
+    uint16_t code;
+    size_t len;
+    char *str;
+
+    switch(t) {
+        case GRAPHCONTEXT_INTERNED_STRING:
+            code = RedisModule_LoadUnsigned(rdb);
+            return StringDict_Share(d, code);
+        case T_STRING:
+            /* Copy string, buffer is allocated by redis. */
+            str = RedisModule_LoadStringBuffer(rdb, &len);
+            v = SI_StringVal(SIString_Copy((SIString){.str = str, .len = len}));
+            RedisModule_Free(str);
+            return v;
+        case T_INT32:
+            return SI_IntVal(RedisModule_LoadSigned(rdb));
+        case T_INT64:
+            return SI_LongVal(RedisModule_LoadSigned(rdb));
+        case T_UINT:
+            return SI_UintVal(RedisModule_LoadUnsigned(rdb));
+        case T_BOOL:
+            return SI_BoolVal(RedisModule_LoadSigned(rdb));
+        case T_FLOAT:
+            return SI_FloatVal(RedisModule_LoadFloat(rdb));
+        case T_DOUBLE:
+            return SI_DoubleVal(RedisModule_LoadDouble(rdb));
+        default:
+            return (SIValue){.type = t};
+    }
+}
+
+void _GraphContextType_SaveProperties(RedisModuleIO *rdb, const GraphEntity *e) {
+    RedisModule_SaveUnsigned(rdb, e->prop_count);
+    for(int i = 0; i < e->prop_count; i++) {
+        RedisModule_SaveStringBuffer(rdb, e->properties[i].name, strlen(e->properties[i].name));
+        _GraphContextType_SaveValue(rdb, &e->properties[i].value);
+    }
+}
+
+void _GraphContextType_LoadProperties(RedisModuleIO *rdb, GraphContext *gc, GraphEntity *e) {
+    int prop_count = RedisModule_LoadUnsigned(rdb);
+    if(prop_count == 0) return;
+
+    char **keys = malloc(sizeof(char*) * prop_count);
+    SIValue *values = malloc(sizeof(SIValue) * prop_count);
+
+    for(int i = 0; i < prop_count; i++) {
+        char *key = RedisModule_LoadStringBuffer(rdb, NULL);
+        keys[i] = strdup(key);
+        RedisModule_Free(key);
+        values[i] = _GraphContextType_LoadValue(rdb, GraphContext_GetStringDict(gc, keys[i]));
+    }
+
+    GraphEntity_Add_Properties(e, prop_count, keys, values);
+    free(keys);
+    free(values);
+}
+
+void _GraphContextType_SaveSchema(RedisModuleIO *rdb, const Schema *s) {
+    RedisModule_SaveUnsigned(rdb, s->count);
+    for(int i = 0; i < s->count; i++) {
+        RedisModule_SaveStringBuffer(rdb, s->attributes[i], strlen(s->attributes[i]));
+    }
+}
+
+void _GraphContextType_LoadSchema(RedisModuleIO *rdb, Schema *s) {
+    uint64_t count = RedisModule_LoadUnsigned(rdb);
+    while(count--) {
+        char *attribute = RedisModule_LoadStringBuffer(rdb, NULL);
+        Schema_AddAttribute(s, attribute);
+        RedisModule_Free(attribute);
+    }
+}
+
+/* Saves the schema of all entities followed by each label's (type's) schema. */
+void _GraphContextType_SaveSchemas(RedisModuleIO *rdb, const Schema *all, TrieMap *schemas) {
+    char *key;
+    tm_len_t len;
+    void *s;
+
+    _GraphContextType_SaveSchema(rdb, all);
+    RedisModule_SaveUnsigned(rdb, schemas->cardinality);
+    TrieMapIterator *it = TrieMap_Iterate(schemas, "", 0);
+    while(TrieMapIterator_Next(it, &key, &len, &s)) {
+        RedisModule_SaveStringBuffer(rdb, key, len);
+        _GraphContextType_SaveSchema(rdb, (Schema*)s);
+    }
+    TrieMapIterator_Free(it);
+}
+
+void _GraphContextType_LoadSchemas(RedisModuleIO *rdb, Schema *all, TrieMap *schemas) {
+    _GraphContextType_LoadSchema(rdb, all);
+    uint64_t count = RedisModule_LoadUnsigned(rdb);
+    while(count--) {
+        char *label = RedisModule_LoadStringBuffer(rdb, NULL);
+        _GraphContextType_LoadSchema(rdb, _GraphContext_GetSchema(schemas, label));
+        RedisModule_Free(label);
+    }
+}
+
+/* Saves each dictionary's entries, in order, such that saved codes remain valid. */
+void _GraphContextType_SaveStringDicts(RedisModuleIO *rdb, TrieMap *dicts) {
+    char *key;
+    tm_len_t len;
+    void *value;
+
+    RedisModule_SaveUnsigned(rdb, dicts->cardinality);
+    TrieMapIterator *it = TrieMap_Iterate(dicts, "", 0);
+    while(TrieMapIterator_Next(it, &key, &len, &value)) {
+        StringDict *d = (StringDict*)value;
+        RedisModule_SaveStringBuffer(rdb, key, len);
+        RedisModule_SaveUnsigned(rdb, d->count);
+        for(int i = 0; i < d->count; i++) {
+            RedisModule_SaveStringBuffer(rdb, d->entries[i].str, d->entries[i].len);
+        }
+    }
+    TrieMapIterator_Free(it);
+}
+
+void _GraphContextType_LoadStringDicts(RedisModuleIO *rdb, GraphContext *gc) {
+    uint64_t count = RedisModule_LoadUnsigned(rdb);
+    while(count--) {
+        char *property = RedisModule_LoadStringBuffer(rdb, NULL);
+        StringDict *d = _GraphContext_GetStringDict(gc, property);
+        RedisModule_Free(property);
+
+        uint64_t entries = RedisModule_LoadUnsigned(rdb);
+        while(entries--) {
+            size_t len;
+            char *str = RedisModule_LoadStringBuffer(rdb, &len);
+            SIValue v = SI_StringVal(SIString_Copy((SIString){.str = str, .len = len}));
+            RedisModule_Free(str);
+            StringDict_Intern(d, &v);
+        }
+        /* Entries themselves aren't interned values. */
+        d->interned_bytes = 0;
+    }
+}
+
+void *GraphContextType_RdbLoad(RedisModuleIO *rdb, int encver) {
+    if(encver > GRAPHCONTEXT_TYPE_ENCODING_VERSION) {
+        return NULL;
+    }
+
+    char id[32];
+    char *name = RedisModule_LoadStringBuffer(rdb, NULL);
+    GraphContext *gc = NewGraphContext(name);
+    RedisModule_Free(name);
+
+    /* Schemas are saved ahead of entities, keeping attribute IDs stable,
+     * older encodings rebuild them from the loaded entities. */
+    if(encver >= 2) {
+        _GraphContextType_LoadSchemas(rdb, gc->node_schema, gc->label_schemas);
+        _GraphContextType_LoadSchemas(rdb, gc->edge_schema, gc->type_schemas);
+    }
+    if(encver >= 3) _GraphContextType_LoadStringDicts(rdb, gc);
+
+    /* Nodes. */
+    uint64_t node_count = RedisModule_LoadUnsigned(rdb);
+    while(node_count--) {
+        long int node_id = RedisModule_LoadSigned(rdb);
+        char *label = RedisModule_LoadStringBuffer(rdb, NULL);
+        Node *n = NewNode(node_id, (label[0] != '\0') ? label : NULL);
+        RedisModule_Free(label);
+        _GraphContextType_LoadProperties(rdb, gc, (GraphEntity*)n);
+
+        GraphContext_AddNode(gc, n);
+    }
+
+    /* Edges. */
+    uint64_t edge_count = RedisModule_LoadUnsigned(rdb);
+    while(edge_count--) {
+        long int edge_id = RedisModule_LoadSigned(rdb);
+        long int src_id = RedisModule_LoadSigned(rdb);
+        long int dest_id = RedisModule_LoadSigned(rdb);
+        char *relation = RedisModule_LoadStringBuffer(rdb, NULL);
+
+        snprintf(id, 32, "%ld", src_id);
+        Node *src = Store_Get(gc->nodes, id);
+        snprintf(id, 32, "%ld", dest_id);
+        Node *dest = Store_Get(gc->nodes, id);
+
+        Edge *e = NewEdge(edge_id, src, dest, relation);
+        RedisModule_Free(relation);
+        _GraphContextType_LoadProperties(rdb, gc, (GraphEntity*)e);
+
+        GraphContext_AddEdge(gc, e);
+    }
+
+    return gc;
+}
+
+void GraphContextType_RdbSave(RedisModuleIO *rdb, void *value) {
+    GraphContext *gc = (GraphContext *)value;
+    char *key;
+    tm_len_t len;
+
+    RedisModule_SaveStringBuffer(rdb, gc->name, strlen(gc->name));
+
+    /* Schemas. */
+    _GraphContextType_SaveSchemas(rdb, gc->node_schema, gc->label_schemas);
+    _GraphContextType_SaveSchemas(rdb, gc->edge_schema, gc->type_schemas);
+
+    /* String dictionaries, interned property values are saved by code. */
+    _GraphContextType_SaveStringDicts(rdb, gc->string_dicts);
+
+    /* Nodes. */
+    Node *n;
+    RedisModule_SaveUnsigned(rdb, Store_Cardinality(gc->nodes));
+    StoreIterator *it = Store_Search(gc->nodes, "");
+    while(StoreIterator_Next(it, &key, &len, (void**)&n)) {
+        RedisModule_SaveSigned(rdb, n->id);
+        const char *label = (n->label) ? n->label : "";
+        RedisModule_SaveStringBuffer(rdb, label, strlen(label));
+        _GraphContextType_SaveProperties(rdb, (GraphEntity*)n);
+    }
+    StoreIterator_Free(it);
+
+    /* Edges, saved after nodes as they refer to them. */
+    Edge *e;
+    RedisModule_SaveUnsigned(rdb, Store_Cardinality(gc->edges));
+    it = Store_Search(gc->edges, "");
+    while(StoreIterator_Next(it, &key, &len, (void**)&e)) {
+        RedisModule_SaveSigned(rdb, e->id);
+        RedisModule_SaveSigned(rdb, e->src->id);
+        RedisModule_SaveSigned(rdb, e->dest->id);
+        RedisModule_SaveStringBuffer(rdb, e->relationship, strlen(e->relationship));
+        _GraphContextType_SaveProperties(rdb, (GraphEntity*)e);
+    }
+    StoreIterator_Free(it);
+}
+
+void GraphContextType_AofRewrite(RedisModuleIO *aof, RedisModuleString *key, void *value) {
+    // TODO: implement.
+}
+
+size_t GraphContextType_MemUsage(const void *value) {
+    GraphMemoryUsage usage;
+    GraphContext_MemUsage((const GraphContext *)value, &usage);
+    return usage.total;
+}
+
+void GraphContextType_Free(void *value) {
+    GraphContext_Free((GraphContext *)value);
+}
+
+int GraphContextType_Register(RedisModuleCtx *ctx) {
+    RedisModuleTypeMethods tm = {.version = REDISMODULE_TYPE_METHOD_VERSION,
+                                 .rdb_load = GraphContextType_RdbLoad,
+                                 .rdb_save = GraphContextType_RdbSave,
+                                 .aof_rewrite = GraphContextType_AofRewrite,
+                                 .mem_usage = GraphContextType_MemUsage,
+                                 .free = GraphContextType_Free};
+
+    GraphContextRedisModuleType = RedisModule_CreateDataType(ctx, "graphctx1", GRAPHCONTEXT_TYPE_ENCODING_VERSION, &tm);
+    if(GraphContextRedisModuleType == NULL) {
+        return REDISMODULE_ERR;
+    }
+    return REDISMODULE_OK;
+}
@@ -0,0 +1,162 @@
+#ifndef __GRAPH_CONTEXT_H__
+#define __GRAPH_CONTEXT_H__
+
+#include "../redismodule.h"
+#include "../stores/store.h"
+#include "../hexastore/hexastore.h"
+#include "../util/bitmap.h"
+#include "schema.h"
+#include "string_dict.h"
+#include "../util/triemap/triemap.h"
+
+#define GRAPHCONTEXT_TYPE_ENCODING_VERSION 3
+
+extern RedisModuleType *GraphContextRedisModuleType;
+
+/* EdgeStats
+ * Number of edges of a relationship type connecting nodes of a source label
+ * to nodes of a destination label, NULL labels stand for unlabeled nodes.
+ * Feeds the planner's estimates of expansion fan-outs. */
+typedef struct {
+    char *src;
+    char *relation;
+    char *dest;
+    long int count;
+} EdgeStats;
+
+/* GraphContext
+ * Everything a single graph owns, kept under one redis key
+ * (the graph's name), resolved once per command. */
+typedef struct {
+    char *name;             /* Graph name. */
+    Store *nodes;           /* Every node within the graph. */
+    Store *edges;           /* Every edge within the graph. */
+    Node **node_table;      /* Nodes by their dense index, in order of insertion. */
+    uint32_t node_count;
+    uint32_t node_cap;
+    TrieMap *label_bitmaps; /* Maps label to the bitmap of its nodes' dense indices. */
+    TrieMap *type_stores;   /* Maps relationship type to its edge store. */
+    HexaStore *hexastore;   /* All 6 permutations of each edge. */
+    struct PlanCache *plan_cache;   /* Execution plans of recent queries. */
+    EdgeStats *edge_stats;  /* Edge counts per label, type, label combination. */
+    int edge_stats_count;
+    int edge_stats_cap;
+    Schema *node_schema;    /* Attributes of all nodes. */
+    Schema *edge_schema;    /* Attributes of all edges. */
+    TrieMap *label_schemas; /* Maps label to the attributes of its nodes. */
+    TrieMap *type_schemas;  /* Maps relationship type to the attributes of its edges. */
+    TrieMap *string_dicts;  /* Maps property name to the dictionary of its string values. */
+} GraphContext;
+
+/* GraphMemoryUsage
+ * Bytes held by a graph, broken down by component.
+ * Figures are the sizes requested from the allocator,
+ * allocator overhead is not accounted for. */
+typedef struct {
+    size_t nodes;           /* Node structs, labels and adjacency lists. */
+    size_t edges;           /* Edge structs and relationship types. */
+    size_t properties;      /* Property arrays, names and string values. */
+    size_t node_store;      /* Index of all nodes, by ID and by dense index. */
+    size_t label_bitmaps;   /* Label membership bitmaps, all labels. */
+    size_t edge_store;      /* Index of all edges. */
+    size_t type_stores;     /* Indices of typed edges, all types. */
+    size_t hexastore;       /* Hexastore index. */
+    size_t indexes;         /* Property indices. */
+    size_t schemas;         /* Label and relationship type schemas. */
+    size_t dictionaries;    /* String dictionaries, including interned strings. */
+    size_t total;           /* Sum of the above, plus the context itself. */
+    size_t dictionary_savings;  /* Bytes interned strings would have taken on their own,
+                                 * less their dictionaries' strings, not part of total. */
+} GraphMemoryUsage;
+
+/* Creates a new, empty graph context. */
+GraphContext *NewGraphContext(const char *name);
+
+/* Retrieves graph context stored under graph key,
+ * if key is empty and create is set a new context is created,
+ * the key is opened for writing only when create is set.
+ * Returns NULL if graph does not exists or if key holds a different type. */
+GraphContext *GraphContext_Get(RedisModuleCtx *ctx, const char *graph, int create);
+
+/* Returns either the node store or an edge store for given relationship type,
+ * if type is NULL the store holding all nodes/edges is returned, nodes are
+ * grouped by label within label bitmaps rather than stores.
+ * Type stores are created on demand, introducing a new type
+ * invalidates the graph's cached execution plans. */
+Store *GraphContext_GetStore(GraphContext *gc, StoreType type, const char *label);
+
+/* Returns the store of edges of relationship type, all edges if type is NULL,
+ * NULL if no edge was ever of type type. Unlike GraphContext_GetStore
+ * no store is created, such that reads leave the graph's types unchanged. */
+Store *GraphContext_GetTypeStore(const GraphContext *gc, const char *type);
+
+/* Adds node to graph, indexing it by ID, by dense index and by label. */
+void GraphContext_AddNode(GraphContext *gc, Node *n);
+
+/* Returns the bitmap of the dense indices of nodes labeled label,
+ * NULL if no node was ever labeled label. Bitmaps are created as nodes
+ * are added, introducing a new label invalidates the graph's cached execution plans. */
+Bitmap *GraphContext_GetLabelBitmap(const GraphContext *gc, const char *label);
+
+/* Number of nodes labeled label, all nodes if label is NULL. */
+uint64_t GraphContext_LabelCardinality(const GraphContext *gc, const char *label);
+
+/* Number of edges of relationship type, all edges if type is NULL. */
+uint64_t GraphContext_TypeCardinality(const GraphContext *gc, const char *type);
+
+/* Returns the node at dense index idx. */
+Node *GraphContext_GetNodeByIndex(const GraphContext *gc, uint32_t idx);
+
+/* Returns graph's hexastore. */
+HexaStore *GraphContext_GetHexaStore(GraphContext *gc);
+
+/* Accounts for a newly connected edge within graph's edge statistics. */
+void GraphContext_CountEdge(GraphContext *gc, const Edge *e);
+
+/* Adds edge to graph, indexing it by ID and by relationship type,
+ * connecting its end points, accounting for it within the edge statistics
+ * and the schemas, interning its properties and storing it within the hexastore. */
+void GraphContext_AddEdge(GraphContext *gc, Edge *e);
+
+/* Removes edge from graph, disconnecting its end points, dropping it from
+ * the edge stores, the hexastore and the edge statistics, then frees it. */
+void GraphContext_RemoveEdge(GraphContext *gc, Edge *e);
+
+/* Number of edges of relation type leaving nodes labeled src and
+ * entering nodes labeled dest, NULL matches any label or type. */
+long int GraphContext_EdgeCount(const GraphContext *gc, const char *src,
+                                const char *relation, const char *dest);
+
+/* Adds entity's attributes to the schema of label (relationship type for edges)
+ * and to the schema of all nodes (edges), introducing a new attribute
+ * invalidates the graph's cached execution plans. */
+void GraphContext_UpdateSchema(GraphContext *gc, StoreType type, const char *label,
+                               const GraphEntity *e);
+
+/* Returns the schema of label (relationship type for edges),
+ * the schema of all nodes (edges) if label is NULL,
+ * NULL if no entity was ever added under label. */
+Schema *GraphContext_GetSchema(const GraphContext *gc, StoreType type, const char *label);
+
+/* Interns entity's string properties within their property's dictionary,
+ * dictionaries are created on demand. */
+void GraphContext_InternProperties(GraphContext *gc, GraphEntity *e);
+
+/* Returns the string dictionary of property, NULL if it has none. */
+StringDict *GraphContext_GetStringDict(const GraphContext *gc, const char *property);
+
+/* Computes the memory used by graph, walks every node and edge. */
+void GraphContext_MemUsage(const GraphContext *gc, GraphMemoryUsage *usage);
+
+/* Frees graph context, including every node and edge within it. */
+void GraphContext_Free(GraphContext *gc);
+
+/* Commands related to the redis GraphContextType registration */
+int GraphContextType_Register(RedisModuleCtx *ctx);
+void *GraphContextType_RdbLoad(RedisModuleIO *rdb, int encver);
+void GraphContextType_RdbSave(RedisModuleIO *rdb, void *value);
+void GraphContextType_AofRewrite(RedisModuleIO *aof, RedisModuleString *key, void *value);
+size_t GraphContextType_MemUsage(const void *value);
+void GraphContextType_Free(void *value);
+
+#endif
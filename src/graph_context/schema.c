@@ -0,0 +1,67 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "schema.h"
+
+Schema *NewSchema(const char *name) {
+    Schema *s = malloc(sizeof(Schema));
+    s->name = (name) ? strdup(name) : NULL;
+    s->attributes = NULL;
+    s->count = 0;
+    s->cap = 0;
+    return s;
+}
+
+int Schema_AddAttribute(Schema *s, const char *attribute) {
+    int id = Schema_GetAttributeID(s, attribute);
+    if(id != SCHEMA_NO_ATTRIBUTE) return id;
+
+    if(s->count == s->cap) {
+        s->cap = (s->cap > 0) ? s->cap * 2 : 8;
+        s->attributes = realloc(s->attributes, sizeof(char*) * s->cap);
+    }
+    s->attributes[s->count] = strdup(attribute);
+    return s->count++;
+}
+
+int Schema_AddAttributes(Schema *s, const GraphEntity *e) {
+    int count = s->count;
+    for(int i = 0; i < e->prop_count; i++) {
+        Schema_AddAttribute(s, e->properties[i].name);
+    }
+    return s->count - count;
+}
+
+int Schema_GetAttributeID(const Schema *s, const char *attribute) {
+    /* Labels carry a handful of attributes, a linear search will do. */
+    for(int i = 0; i < s->count; i++) {
+        if(strcmp(s->attributes[i], attribute) == 0) return i;
+    }
+    return SCHEMA_NO_ATTRIBUTE;
+}
+
+const char *Schema_GetAttribute(const Schema *s, int id) {
+    return s->attributes[id];
+}
+
+int Schema_AttributeCount(const Schema *s) {
+    return s->count;
+}
+
+size_t Schema_MemUsage(const Schema *s) {
+    size_t size = sizeof(Schema) + sizeof(char*) * s->cap;
+    if(s->name) size += strlen(s->name) + 1;
+    for(int i = 0; i < s->count; i++) {
+        size += strlen(s->attributes[i]) + 1;
+    }
+    return size;
+}
+
+void Schema_Free(Schema *s) {
+    for(int i = 0; i < s->count; i++) {
+        free(s->attributes[i]);
+    }
+    free(s->attributes);
+    free(s->name);
+    free(s);
+}
@@ -0,0 +1,44 @@
+#ifndef __SCHEMA_H__
+#define __SCHEMA_H__
+
+#include <stddef.h>
+#include "../graph/graph_entity.h"
+
+#define SCHEMA_NO_ATTRIBUTE -1
+
+/* Schema
+ * Attributes seen on entities of a single label or relationship type,
+ * in order of first appearance, an attribute's ID is its position.
+ * Schemas only grow, removing an entity leaves its attributes in place. */
+typedef struct {
+    char *name;             /* Label or relationship type, NULL for all entities. */
+    char **attributes;      /* Attribute names. */
+    int count;
+    int cap;
+} Schema;
+
+/* Creates a new, empty schema. */
+Schema *NewSchema(const char *name);
+
+/* Adds attribute to schema, returns its ID. */
+int Schema_AddAttribute(Schema *s, const char *attribute);
+
+/* Adds each of entity's attributes to schema,
+ * returns the number of attributes introduced. */
+int Schema_AddAttributes(Schema *s, const GraphEntity *e);
+
+/* Returns attribute's ID, SCHEMA_NO_ATTRIBUTE if schema lacks it. */
+int Schema_GetAttributeID(const Schema *s, const char *attribute);
+
+/* Returns the name of attribute id. */
+const char *Schema_GetAttribute(const Schema *s, int id);
+
+/* Number of attributes within schema. */
+int Schema_AttributeCount(const Schema *s);
+
+/* Bytes used by schema, including the struct itself. */
+size_t Schema_MemUsage(const Schema *s);
+
+void Schema_Free(Schema *s);
+
+#endif
@@ -0,0 +1,108 @@
+#include <ctype.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "string_dict.h"
+
+StringDict *NewStringDict(const char *property) {
+    StringDict *d = malloc(sizeof(StringDict));
+    d->property = strdup(property);
+    d->entries = NULL;
+    d->count = 0;
+    d->cap = 0;
+    d->index = NewTrieMap();
+    d->interned_bytes = 0;
+    return d;
+}
+
+/* Lower cases len bytes of str into buf. */
+static inline void _StringDict_Fold(const char *str, size_t len, char *buf) {
+    for(size_t i = 0; i < len; i++) buf[i] = tolower((unsigned char)str[i]);
+}
+
+uint16_t StringDict_Lookup(const StringDict *d, const char *str, size_t len) {
+    if(len > STRING_DICT_MAX_LEN) return 0;
+
+    char key[STRING_DICT_MAX_LEN];
+    _StringDict_Fold(str, len, key);
+    void *code = TrieMap_Find(d->index, key, len);
+    return (code == TRIEMAP_NOTFOUND) ? 0 : (uint16_t)(uintptr_t)code;
+}
+
+uint16_t StringDict_Intern(StringDict *d, SIValue *v) {
+    if(v->type != T_STRING || v->code) return v->code;
+
+    SIString s = v->stringval;
+    uint16_t code = StringDict_Lookup(d, s.str, s.len);
+    if(code) {
+        /* Same string under a different case, keep it as is. */
+        SIString entry = d->entries[code - 1];
+        if(memcmp(entry.str, s.str, s.len) != 0) return 0;
+        free(s.str);
+        v->stringval = entry;
+    } else {
+        if(s.len > STRING_DICT_MAX_LEN || d->count == STRING_DICT_MAX_ENTRIES) return 0;
+
+        if(d->count == d->cap) {
+            d->cap = (d->cap > 0) ? d->cap * 2 : 16;
+            d->entries = realloc(d->entries, sizeof(SIString) * d->cap);
+        }
+        /* Entry adopts v's string. */
+        d->entries[d->count] = s;
+        code = ++d->count;
+
+        char key[STRING_DICT_MAX_LEN];
+        _StringDict_Fold(s.str, s.len, key);
+        TrieMap_Add(d->index, key, s.len, (void*)(uintptr_t)code, NULL);
+    }
+
+    d->interned_bytes += s.len + 1;
+    v->code = code;
+    return code;
+}
+
+SIString StringDict_Get(const StringDict *d, uint16_t code) {
+    return d->entries[code - 1];
+}
+
+SIValue StringDict_Share(StringDict *d, uint16_t code) {
+    SIValue v = SI_StringVal(StringDict_Get(d, code));
+    v.code = code;
+    d->interned_bytes += v.stringval.len + 1;
+    return v;
+}
+
+int StringDict_Count(const StringDict *d) {
+    return d->count;
+}
+
+/* Bytes held by entries' strings. */
+static size_t _StringDict_EntriesBytes(const StringDict *d) {
+    size_t size = 0;
+    for(int i = 0; i < d->count; i++) size += d->entries[i].len + 1;
+    return size;
+}
+
+size_t StringDict_MemUsage(const StringDict *d) {
+    return sizeof(StringDict) + strlen(d->property) + 1 +
+           sizeof(SIString) * d->cap + _StringDict_EntriesBytes(d) +
+           sizeof(TrieMap) + TrieMap_MemUsage((TrieMap*)d->index);
+}
+
+size_t StringDict_Savings(const StringDict *d) {
+    /* Entries no longer held by any value save nothing. */
+    size_t entries = _StringDict_EntriesBytes(d);
+    return (d->interned_bytes > entries) ? d->interned_bytes - entries : 0;
+}
+
+void _StringDict_FreeCode(void *code) {
+    /* Codes are not allocated. */
+}
+
+void StringDict_Free(StringDict *d) {
+    for(int i = 0; i < d->count; i++) free(d->entries[i].str);
+    free(d->entries);
+    TrieMap_Free(d->index, _StringDict_FreeCode);
+    free(d->property);
+    free(d);
+}
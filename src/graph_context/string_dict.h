@@ -0,0 +1,58 @@
+#ifndef __STRING_DICT_H__
+#define __STRING_DICT_H__
+
+#include <stddef.h>
+#include <stdint.h>
+#include "../value.h"
+#include "../util/triemap/triemap.h"
+
+/* Property values beyond these limits are never interned,
+ * dictionaries are meant for low cardinality attributes. */
+#define STRING_DICT_MAX_ENTRIES 4096
+#define STRING_DICT_MAX_LEN 128
+
+/* StringDict
+ * Distinct string values of a single property, each stored once.
+ * Interned values point at their entry's string and carry its code,
+ * 1 based position within entries.
+ * Entries are distinct regardless of case, values differing from
+ * an entry by case only are not interned, such that equal codes
+ * mean equal strings, both case sensitively and insensitively. */
+typedef struct {
+    char *property;         /* Property name. */
+    SIString *entries;      /* Entry strings, in order of first appearance. */
+    int count;
+    int cap;
+    TrieMap *index;         /* Maps lower cased entry to its code. */
+    size_t interned_bytes;  /* Bytes interned values would have taken on their own. */
+} StringDict;
+
+StringDict *NewStringDict(const char *property);
+
+/* Interns string value v, replacing its string by the entry's, v's own string
+ * is either adopted by a new entry or freed.
+ * Returns v's code, 0 if v was left as is. */
+uint16_t StringDict_Intern(StringDict *d, SIValue *v);
+
+/* Returns the entry of code as an interned value, accounted for
+ * as held by one more entity, e.g. a value loaded by code. */
+SIValue StringDict_Share(StringDict *d, uint16_t code);
+
+/* Code of the entry equal to str ignoring case, 0 if there's none. */
+uint16_t StringDict_Lookup(const StringDict *d, const char *str, size_t len);
+
+/* Returns the entry of code. */
+SIString StringDict_Get(const StringDict *d, uint16_t code);
+
+/* Number of entries within dictionary. */
+int StringDict_Count(const StringDict *d);
+
+/* Bytes used by dictionary, including the struct itself. */
+size_t StringDict_MemUsage(const StringDict *d);
+
+/* Bytes saved by storing each distinct value once. */
+size_t StringDict_Savings(const StringDict *d);
+
+void StringDict_Free(StringDict *d);
+
+#endif
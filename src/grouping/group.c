@@ -1,6 +1,7 @@
 #include <stdio.h>
 #include "group.h"
 #include "../redismodule.h"
+#include "../aggregate/aggregate.h"
 
 // Creates a new group
 // arguments specify group's key.
@@ -14,7 +15,16 @@ Group* NewGroup(Vector* keys, Vector* funcs) {
 void FreeGroup(Group* group) {
     if(group == NULL) return;
     
-    // Vector_Free(group->keys);
-    // Vector_Free(group->aggregationFunctions);
+    // Keys point at graph entities properties, which are not owned by the group.
+    Vector_Free(group->keys);
+
+    if(group->aggregationFunctions) {
+        for(int i = 0; i < Vector_Size(group->aggregationFunctions); i++) {
+            AggCtx *agg_ctx;
+            Vector_Get(group->aggregationFunctions, i, &agg_ctx);
+            AggCtx_Free(agg_ctx);
+        }
+        Vector_Free(group->aggregationFunctions);
+    }
     free(group);
 }
\ No newline at end of file
@@ -24,8 +24,7 @@ void FreeGroupCache() {
 
 // Returns an iterator to scan entire group cache
 CacheGroupIterator* CacheGroupIter() {
-    char* prefix = strdup("");
-	return TrieMap_Iterate(__groupCache, prefix, strlen(prefix));
+	return TrieMap_Iterate(__groupCache, "", 0);
 }
 
 // Advance iterator and returns key & value in current position.
@@ -36,4 +35,8 @@ int CacheGroupIterNext(CacheGroupIterator *iter, char **key, Group **group) {
         *group = NULL;
     }
     return res;
-}
\ No newline at end of file
+}
+
+void CacheGroupIterator_Free(CacheGroupIterator *iter) {
+    TrieMapIterator_Free(iter);
+}
@@ -25,4 +25,6 @@ CacheGroupIterator* CacheGroupIter();
 // Advance iterator and returns key & value in current position.
 int CacheGroupIterNext(CacheGroupIterator *iter, char **key, Group **group);
 
+void CacheGroupIterator_Free(CacheGroupIterator *iter);
+
 #endif
\ No newline at end of file
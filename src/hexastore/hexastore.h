@@ -6,18 +6,21 @@
 #include "../util/triemap/triemap.h"
 #include "triplet.h"
 
-// TODO: find a suiteable place to store hexastores.
 typedef TrieMap HexaStore;
 
 HexaStore *_NewHexaStore();
 
-HexaStore *GetHexaStore(RedisModuleCtx *ctx, const char *id);
+/* Indexes edge under all 6 permutations of (src, edge, dest),
+ * each permutation maps to the edge itself. */
+void HexaStore_InsertAllPerm(HexaStore* hexaStore, Edge *e);
 
-/* Create all 6 triplets from given triplet. */
-void HexaStore_InsertAllPerm(HexaStore* hexaStore, Triplet *t);
+/* Removes all 6 permutations of edge, edge is left intact. */
+void HexaStore_RemoveAllPerm(HexaStore *hexaStore, const Edge *e);
 
-void HexaStore_RemoveAllPerm(HexaStore *hexaStore, const Triplet *t);
+/* Bytes used by the hexastore index, edges are accounted by their stores. */
+size_t HexaStore_MemUsage(HexaStore *hexaStore);
 
+/* Prefix must outlive the returned iterator. */
 TripletIterator *HexaStore_Search(HexaStore* hexaStore, const char *prefix);
 
 void HexaStore_Search_Iterator(HexaStore* hexastore, sds prefix, TripletIterator *it);
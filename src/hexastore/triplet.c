@@ -119,12 +119,12 @@ void FreeTriplet(Triplet* triplet) {
 	triplet = NULL;
 }
 
-/* Returns the next triplet from the cursor
+/* Returns the next edge from the cursor
  * or NULL when cursor is depleted. */
-int TripletIterator_Next(TripletIterator* iterator, Triplet** triplet) {
+int TripletIterator_Next(TripletIterator* iterator, Edge** edge) {
 	char *key = NULL;
 	tm_len_t len = 0;
-	return TrieMapIterator_Next(iterator, &key, &len, (void**)triplet);
+	return TrieMapIterator_Next(iterator, &key, &len, (void**)edge);
 }
 
 void TripletIterator_Free(TripletIterator* iterator) {
@@ -41,8 +41,8 @@ void FreeTriplet(Triplet *triplet);
 
 // -------------Triplet cursor-------------
 
-// Returns the next triplet from the cursor.
-int TripletIterator_Next(TripletIterator* iterator, Triplet** triplet);
+// Returns the next edge from the cursor.
+int TripletIterator_Next(TripletIterator* iterator, Edge** edge);
 
 void TripletIterator_Free(TripletIterator *cursor);
 
@@ -24,6 +24,7 @@
 #include "parser/parser_common.h"
 
 #include "stores/store.h"
+#include "graph_context/graph_context.h"
 
 #include "grouping/group_cache.h"
 #include "aggregate/agg_funcs.h"
@@ -33,7 +34,10 @@
 #include "resultset/record.h"
 #include "resultset/resultset.h"
 
+#include "algorithms/shortest_path.h"
+
 #include "execution_plan/execution_plan.h"
+#include "execution_plan/plan_cache.h"
 
 /* Creates a new node
  * Args:
@@ -61,6 +65,11 @@ int MGraph_CreateNode(RedisModuleCtx *ctx, RedisModuleString **argv, int argc) {
     const char *graph;
     RMUtil_ParseArgs(argv, argc, 1, "c", &graph);
 
+    GraphContext *gc = GraphContext_Get(ctx, graph, 1);
+    if(gc == NULL) {
+        return RedisModule_ReplyWithError(ctx, REDISMODULE_ERRORMSG_WRONGTYPE);
+    }
+
     RedisModuleString **properties = argv+propStartIdx;
     char *nodeID;
 
@@ -79,25 +88,13 @@ int MGraph_CreateNode(RedisModuleCtx *ctx, RedisModuleString **argv, int argc) {
     long int id = get_new_id();
     asprintf(&nodeID, "%ld", id);
 
-    Node *n = NewNode(id, NULL);
+    /* Set node's label. */
+    const char *strLabel = (labelSpecified) ? RedisModule_StringPtrLen(argv[2], NULL) : NULL;
+    Node *n = NewNode(id, strLabel);
     Node_Add_Properties(n, propCount, propKeys, propValues);
     
-    /* Place node id within node store. */
-    Store *store = GetStore(ctx, STORE_NODE, graph, NULL);
-    Store_Insert(store, nodeID, n);
-
-    /* Place node id within labeled node store. */
-    if(labelSpecified) {
-        RedisModuleString *label = argv[2];
-
-        /* Set node's label. */
-        const char *strLabel = RedisModule_StringPtrLen(label, NULL);
-        n->label = strdup(strLabel);
-
-        /* Store node within label store. */
-        store = GetStore(ctx, STORE_NODE, graph, strLabel);
-        Store_Insert(store, nodeID, n);
-    }
+    /* Place node within node store and its label's bitmap. */
+    GraphContext_AddNode(gc, n);
     
     RedisModule_ReplyWithSimpleString(ctx, nodeID);
     free(nodeID);
@@ -126,8 +123,15 @@ int MGraph_AddEdge(RedisModuleCtx *ctx, RedisModuleString **argv, int argc) {
 
     RMUtil_ParseArgs(argv, argc, 1, "cccc", &graph, &src, &edge_type, &dest);
     
+    GraphContext *gc = GraphContext_Get(ctx, graph, 0);
+    if(gc == NULL) {
+        /* Linking none-existing node(s). */
+        RedisModule_ReplyWithSimpleString(ctx, "Error, missing node(s)");
+        return REDISMODULE_OK;
+    }
+
     /* Retreive source and dest nodes from node store. */
-    Store *node_store = GetStore(ctx, STORE_NODE, graph, NULL);
+    Store *node_store = GraphContext_GetStore(gc, STORE_NODE, NULL);
     Node *src_node = Store_Get(node_store, src);
     Node *dest_node = Store_Get(node_store, dest);
 
@@ -161,21 +165,8 @@ int MGraph_AddEdge(RedisModuleCtx *ctx, RedisModuleString **argv, int argc) {
         free(prop_keys);
     }
 
-    /* Place edge within edge store(s). */
-    Store *edge_store = GetStore(ctx, STORE_EDGE, graph, NULL);
-    Store_Insert(edge_store, edge_id, edge);
-    
-    edge_store = GetStore(ctx, STORE_EDGE, graph, edge_type);
-    Store_Insert(edge_store, edge_id, edge);
-    Node_ConnectNode(src_node, dest_node, edge);
-    
-    /* Store relation within hexastore
-    * one triplet is used as key, this one contains the 
-    * edge lable and id, while the other triplet
-    * stored as the value does contains only IDs, no labels */
-    Triplet *triplet = NewTriplet(src_node, edge, dest_node);
-    HexaStore *hexastore = GetHexaStore(ctx, graph);
-    HexaStore_InsertAllPerm(hexastore, triplet);
+    /* Place edge within edge stores, end points and hexastore. */
+    GraphContext_AddEdge(gc, edge);
 
     RedisModule_ReplyWithSimpleString(ctx, edge_id);    
     free(edge_id);
@@ -187,7 +178,8 @@ int MGraph_AddEdge(RedisModuleCtx *ctx, RedisModuleString **argv, int argc) {
  * argv[1] graph name
  * argv[2] edge id
  * removes all 6 triplets representing
- * the connection (predicate) between subject and object */
+ * the connection (predicate) between subject and object,
+ * along with the edge itself from its end points and stores */
 int MGraph_RemoveEdge(RedisModuleCtx *ctx, RedisModuleString **argv, int argc) {
     if(argc != 2) {
         return RedisModule_WrongArity(ctx);
@@ -198,8 +190,14 @@ int MGraph_RemoveEdge(RedisModuleCtx *ctx, RedisModuleString **argv, int argc) {
 
     RMUtil_ParseArgs(argv, argc, 1, "cc", &graph, &edge_id);
     
-    /* Retreive source and dest nodes from node store. */
-    Store *edge_store = GetStore(ctx, STORE_EDGE, graph, NULL);
+    GraphContext *gc = GraphContext_Get(ctx, graph, 0);
+    if(gc == NULL) {
+        RedisModule_ReplyWithSimpleString(ctx, "Error, missing edge");
+        return REDISMODULE_OK;
+    }
+
+    /* Retreive edge from edge store. */
+    Store *edge_store = GraphContext_GetStore(gc, STORE_EDGE, NULL);
     Edge *edge = Store_Get(edge_store, edge_id);
 
     /* Make sure edge exists. */
@@ -208,12 +206,7 @@ int MGraph_RemoveEdge(RedisModuleCtx *ctx, RedisModuleString **argv, int argc) {
         return REDISMODULE_OK;
     }
 
-    Triplet *t = TripletFromEdge(edge);
-
-    HexaStore *hexa_store = GetHexaStore(ctx, graph);
-    HexaStore_RemoveAllPerm(hexa_store, t);
-
-    FreeTriplet(t);
+    GraphContext_RemoveEdge(gc, edge);
 
     RedisModule_ReplyWithSimpleString(ctx, "OK");
     return REDISMODULE_OK;
@@ -222,82 +215,77 @@ int MGraph_RemoveEdge(RedisModuleCtx *ctx, RedisModuleString **argv, int argc) {
 /* Removes given graph.
  * Args:
  * argv[1] graph name
- * sorted set holding graph name is deleted */
+ * graph key is deleted, freeing every store,
+ * node and edge held by the graph context. */
 int MGraph_DeleteGraph(RedisModuleCtx *ctx, RedisModuleString **argv, int argc) {
     if(argc != 2) {
         return RedisModule_WrongArity(ctx);
     }
 
-    RedisModuleKey *key;
-    char *graph;
-    char *storeId;
-    RMUtil_ParseArgs(argv, argc, 1, "c", &graph);
-    
-    Store *store = GetStore(ctx, STORE_NODE, graph, NULL);
-    StoreIterator *it = Store_Search(store, "");
-    
-    char *nodeId;
-    tm_len_t nodeIdLen;
-    Node *node;
-
-    while(StoreIterator_Next(it, &nodeId, &nodeIdLen, (void**)&node)) {
-        RedisModuleString* strKey = RedisModule_CreateString(ctx, nodeId, nodeIdLen);
-        key = RedisModule_OpenKey(ctx, strKey, REDISMODULE_WRITE);
-        RedisModule_FreeString(ctx, strKey);
-        RedisModule_DeleteKey(key);
+    RedisModuleKey *key = RedisModule_OpenKey(ctx, argv[1], REDISMODULE_WRITE);
+    if(RedisModule_KeyType(key) != REDISMODULE_KEYTYPE_EMPTY &&
+       RedisModule_ModuleTypeGetType(key) != GraphContextRedisModuleType) {
         RedisModule_CloseKey(key);
+        return RedisModule_ReplyWithError(ctx, REDISMODULE_ERRORMSG_WRONGTYPE);
     }
-    StoreIterator_Free(it);
-    
-    int storeIdLen = Store_ID(&storeId, STORE_NODE, graph, NULL);
-    RedisModuleString *rmStoreId = RedisModule_CreateString(ctx, storeId, storeIdLen);
-    free(storeId);
-    key = RedisModule_OpenKey(ctx, rmStoreId, REDISMODULE_WRITE);
-    RedisModule_FreeString(ctx, rmStoreId);
-    
-    /* Deletes the actual store + each stored node. */
+
     RedisModule_DeleteKey(key);
     RedisModule_CloseKey(key);
 
-    /* TODO: delete store key. */
-    store = GetStore(ctx, STORE_EDGE, graph, NULL);
-    it = Store_Search(store, "");
-    char *edgeId;
-    tm_len_t edgeIdLen;
-    Edge *edge;
-
-    while(StoreIterator_Next(it, &edgeId, &edgeIdLen, (void**)&edge)) {
-        RedisModuleString* strKey = RedisModule_CreateString(ctx, edgeId, edgeIdLen);
-        key = RedisModule_OpenKey(ctx, strKey, REDISMODULE_WRITE);
-        RedisModule_FreeString(ctx, strKey);
-        RedisModule_DeleteKey(key);
-        RedisModule_CloseKey(key);
+    RedisModule_ReplyWithSimpleString(ctx, "OK");
+    return REDISMODULE_OK;
+}
+
+/* Binds query parameters given as name value pairs to plan,
+ * replies with an error and returns REDISMODULE_ERR if a parameter
+ * referred to by the query is missing. */
+int _MGraph_BindParams(RedisModuleCtx *ctx, ExecutionPlan *plan, RedisModuleString **params, int count) {
+    for(int i = 0; i < count; i += 2) {
+        const char *name = RedisModule_StringPtrLen(params[i], NULL);
+        /* Allow parameter names to be specified with their leading '$'. */
+        if(name[0] == '$') name++;
+
+        size_t len;
+        const char *strValue = RedisModule_StringPtrLen(params[i+1], &len);
+        SIValue value;
+        SIValue_FromString(&value, (char*)strValue, len);
+        ExecutionPlan_BindParam(plan, name, value);
+    }
+
+    const char *unbound = ExecutionPlan_UnboundParam(plan);
+    if(unbound) {
+        char *err;
+        asprintf(&err, "Missing value for parameter $%s", unbound);
+        RedisModule_ReplyWithError(ctx, err);
+        free(err);
+        return REDISMODULE_ERR;
     }
-    StoreIterator_Free(it);
 
-    storeIdLen = Store_ID(&storeId, STORE_EDGE, graph, NULL);
-    rmStoreId = RedisModule_CreateString(ctx, storeId, storeIdLen);
-    free(storeId);
-    key = RedisModule_OpenKey(ctx, rmStoreId, REDISMODULE_WRITE);
-    RedisModule_FreeString(ctx, rmStoreId);
-    
-    /* Deletes the actual store + each stored edge. */
-    RedisModule_DeleteKey(key);
-    RedisModule_CloseKey(key);
-    
-    /* TODO: delete store key.
-     * TODO: Delete label stores... */
-    RedisModule_ReplyWithSimpleString(ctx, "OK");
     return REDISMODULE_OK;
 }
 
 /* Queries graph
  * Args:
  * argv[1] graph name
- * argv[2] query to execute */
+ * argv[2] query to execute
+ * argv[3] PARAMS (optional)
+ * argv[I] parameter name
+ * argv[I+1] parameter value */
 int MGraph_Query(RedisModuleCtx *ctx, RedisModuleString **argv, int argc) {
     if (argc < 2) return RedisModule_WrongArity(ctx);
 
+    /* Query parameters. */
+    RedisModuleString **params = NULL;
+    int paramCount = 0;
+    if(argc > 3) {
+        const char *keyword = RedisModule_StringPtrLen(argv[3], NULL);
+        if(strcasecmp(keyword, "PARAMS") != 0 || (argc - 4) % 2 != 0) {
+            return RedisModule_WrongArity(ctx);
+        }
+        params = argv + 4;
+        paramCount = argc - 4;
+    }
+
     /* Time query execution */
     clock_t start = clock();
     clock_t end;
@@ -305,32 +293,63 @@ int MGraph_Query(RedisModuleCtx *ctx, RedisModuleString **argv, int argc) {
     const char *graphName;
     const char *query;
     RMUtil_ParseArgs(argv, argc, 1, "cc", &graphName, &query);
-    
-    /* Parse query, get AST. */
-    char *errMsg = NULL;
-    AST_QueryExpressionNode* ast = ParseQuery(query, strlen(query), &errMsg);
-    
-    if (!ast) {
-        RedisModule_Log(ctx, "debug", "Error parsing query: %s", errMsg);
-        RedisModule_ReplyWithError(ctx, errMsg);
-        free(errMsg);
+
+    GraphContext *gc = GraphContext_Get(ctx, graphName, 0);
+    if(gc == NULL) {
+        RedisModule_ReplyWithError(ctx, "Graph does not exists.");
         return REDISMODULE_OK;
     }
     
-    /* Modify AST */
-    if(ReturnClause_ContainsCollapsedNodes(ast->returnNode) == 1) {
-        /* Expend collapsed nodes. */
-        ReturnClause_ExpandCollapsedNodes(ctx, ast, graphName);
+    /* Reuse cached plan, skipping both parser and planner. */
+    char *normalizedQuery = PlanCache_NormalizeQuery(query);
+    ExecutionPlan *plan = PlanCache_Get(gc->plan_cache, normalizedQuery);
+
+    /* Plans costed against a considerably smaller or larger graph are rebuilt. */
+    if(plan && ExecutionPlan_Outdated(plan, gc)) {
+        PlanCache_Remove(gc->plan_cache, normalizedQuery);
+        plan = NULL;
+    }
+    int cached = (plan != NULL);
+
+    if(plan) {
+        ExecutionPlan_Reset(plan, ctx);
+    } else {
+        /* Parse query, get AST. */
+        char *errMsg = NULL;
+        AST_QueryExpressionNode* ast = ParseQuery(query, strlen(query), &errMsg);
+        
+        if (!ast) {
+            RedisModule_Log(ctx, "debug", "Error parsing query: %s", errMsg);
+            RedisModule_ReplyWithError(ctx, errMsg);
+            free(errMsg);
+            free(normalizedQuery);
+            return REDISMODULE_OK;
+        }
+        
+        /* Modify AST */
+        if(ReturnClause_ContainsCollapsedNodes(ast->returnNode) == 1) {
+            /* Expend collapsed nodes. */
+            ReturnClause_ExpandCollapsedNodes(ctx, ast, gc);
+        }
+
+        plan = NewExecutionPlan(ctx, gc, ast);
+        cached = PlanCache_Add(gc->plan_cache, normalizedQuery, plan);
+    }
+    free(normalizedQuery);
+
+    if(_MGraph_BindParams(ctx, plan, params, paramCount) != REDISMODULE_OK) {
+        if(!cached) ExecutionPlanFree(plan);
+        return REDISMODULE_OK;
     }
 
-    ExecutionPlan *plan = NewExecutionPlan(ctx, graphName, ast);
     ResultSet* resultSet = ExecutionPlan_Execute(plan);
     
     /* Send result-set back to client. */
     ResultSet_Replay(ctx, resultSet);
     ResultSet_Free(ctx, resultSet);
-    /* TODO: free execution plan.
-     * ExecutionPlanFree(plan); */
+
+    /* Cached plans are owned by the graph's plan cache. */
+    if(!cached) ExecutionPlanFree(plan);
 
     /* Report execution timing. */
     end = clock();
@@ -340,9 +359,6 @@ int MGraph_Query(RedisModuleCtx *ctx, RedisModuleString **argv, int argc) {
     asprintf(&strElapsed, "Query internal execution time: %f milliseconds", elapsedMS);
     RedisModule_ReplyWithStringBuffer(ctx, strElapsed, strlen(strElapsed));
     free(strElapsed);
-    
-    /* TODO: free AST
-     * FreeQueryExpressionNode(ast); */
     return REDISMODULE_OK;
 }
 
@@ -358,6 +374,12 @@ int MGraph_Explain(RedisModuleCtx *ctx, RedisModuleString **argv, int argc) {
     const char *query;
     RMUtil_ParseArgs(argv, argc, 1, "cc", &graphName, &query);
 
+    GraphContext *gc = GraphContext_Get(ctx, graphName, 0);
+    if(gc == NULL) {
+        RedisModule_ReplyWithError(ctx, "Graph does not exists.");
+        return REDISMODULE_OK;
+    }
+
     /* Parse query, get AST. */
     char *errMsg = NULL;
     AST_QueryExpressionNode *ast = ParseQuery(query, strlen(query), &errMsg);
@@ -369,16 +391,178 @@ int MGraph_Explain(RedisModuleCtx *ctx, RedisModuleString **argv, int argc) {
         return REDISMODULE_OK;
     }
     
-    ExecutionPlan *plan = NewExecutionPlan(ctx, graphName, ast);
+    ExecutionPlan *plan = NewExecutionPlan(ctx, gc, ast);
     char* strPlan = ExecutionPlanPrint(plan);
-    /* TODO: free execution plan.
-     * ExecutionPlanFree(plan); */
+    ExecutionPlanFree(plan);
 
     RedisModule_ReplyWithStringBuffer(ctx, strPlan, strlen(strPlan));
     free(strPlan);
-    
-    /* TODO: free AST
-     * FreeQueryExpressionNode(ast); */
+    return REDISMODULE_OK;
+}
+
+/* Replies with the node and edge ids along path, alternately. */
+void _MGraph_ReplyWithPath(RedisModuleCtx *ctx, const Node *src, Edge **path, int len) {
+    RedisModule_ReplyWithArray(ctx, len * 2 + 1);
+    RedisModule_ReplyWithLongLong(ctx, src->id);
+    for(int i = 0; i < len; i++) {
+        RedisModule_ReplyWithLongLong(ctx, path[i]->id);
+        RedisModule_ReplyWithLongLong(ctx, path[i]->dest->id);
+    }
+}
+
+/* Finds a shortest path between two nodes.
+ * Args:
+ * argv[1] graph name
+ * argv[2] source node
+ * argv[3] destination node
+ * [TYPE relation] follow only edges of given type
+ * [MAXHOPS n] maximum path length
+ * [WEIGHT property] minimize total edge weight rather than hops
+ * [MAXCOST c] maximum total weight
+ * replies with the path's node and edge ids, alternately,
+ * starting at source node, or null if there's no such path,
+ * weighted searches reply with the path's cost followed by the path. */
+int MGraph_ShortestPath(RedisModuleCtx *ctx, RedisModuleString **argv, int argc) {
+    if(argc < 4) return RedisModule_WrongArity(ctx);
+
+    char *graph;
+    char *src;
+    char *dest;
+    char *relation = NULL;
+    char *weightProp = NULL;
+    long long maxHops = SHORTEST_PATH_UNBOUNDED;
+    double maxCost = SHORTEST_PATH_UNBOUNDED;
+
+    RMUtil_ParseArgs(argv, argc, 1, "ccc", &graph, &src, &dest);
+    RMUtil_ParseArgsAfter("TYPE", argv, argc, "c", &relation);
+    RMUtil_ParseArgsAfter("WEIGHT", argv, argc, "c", &weightProp);
+    if(RMUtil_ArgExists("MAXHOPS", argv, argc, 4) &&
+       (RMUtil_ParseArgsAfter("MAXHOPS", argv, argc, "l", &maxHops) != REDISMODULE_OK || maxHops < 0)) {
+        return RedisModule_ReplyWithError(ctx, "MAXHOPS must be a non negative integer");
+    }
+    if(RMUtil_ArgExists("MAXCOST", argv, argc, 4) &&
+       (RMUtil_ParseArgsAfter("MAXCOST", argv, argc, "d", &maxCost) != REDISMODULE_OK || maxCost < 0)) {
+        return RedisModule_ReplyWithError(ctx, "MAXCOST must be a non negative number");
+    }
+    if(weightProp == NULL && maxCost != SHORTEST_PATH_UNBOUNDED) {
+        return RedisModule_ReplyWithError(ctx, "MAXCOST requires WEIGHT");
+    }
+    if(weightProp && maxHops != SHORTEST_PATH_UNBOUNDED) {
+        return RedisModule_ReplyWithError(ctx, "MAXHOPS can not be combined with WEIGHT");
+    }
+
+    GraphContext *gc = GraphContext_Get(ctx, graph, 0);
+    if(gc == NULL) {
+        RedisModule_ReplyWithError(ctx, "Graph does not exists.");
+        return REDISMODULE_OK;
+    }
+
+    Store *node_store = GraphContext_GetStore(gc, STORE_NODE, NULL);
+    Node *src_node = Store_Get(node_store, src);
+    Node *dest_node = Store_Get(node_store, dest);
+    if(src_node == NULL || dest_node == NULL) {
+        RedisModule_ReplyWithError(ctx, "Error, missing node(s)");
+        return REDISMODULE_OK;
+    }
+
+    int len;
+    Edge **path;
+    if(weightProp) {
+        double cost;
+        len = WeightedShortestPath(src_node, dest_node, relation, weightProp, maxCost, &cost, &path);
+        if(len >= 0) {
+            RedisModule_ReplyWithArray(ctx, 2);
+            RedisModule_ReplyWithDouble(ctx, cost);
+            _MGraph_ReplyWithPath(ctx, src_node, path, len);
+        }
+    } else {
+        len = ShortestPath(src_node, dest_node, relation, (int)maxHops, &path);
+        if(len >= 0) _MGraph_ReplyWithPath(ctx, src_node, path, len);
+    }
+
+    if(len < 0) RedisModule_ReplyWithNull(ctx);
+    free(path);
+    return REDISMODULE_OK;
+}
+
+/* Replies with a name, bytes pair for each bitmap within bitmaps map. */
+void _MGraph_ReplyWithBitmapsMemUsage(RedisModuleCtx *ctx, TrieMap *bitmaps) {
+    char *label;
+    tm_len_t len;
+    void *bitmap;
+
+    RedisModule_ReplyWithArray(ctx, bitmaps->cardinality * 2);
+    TrieMapIterator *it = TrieMap_Iterate(bitmaps, "", 0);
+    while(TrieMapIterator_Next(it, &label, &len, &bitmap)) {
+        RedisModule_ReplyWithStringBuffer(ctx, label, len);
+        RedisModule_ReplyWithLongLong(ctx, Bitmap_MemUsage((Bitmap*)bitmap));
+    }
+    TrieMapIterator_Free(it);
+}
+
+/* Replies with a name, bytes pair for each store within stores map. */
+void _MGraph_ReplyWithStoresMemUsage(RedisModuleCtx *ctx, TrieMap *stores) {
+    char *label;
+    tm_len_t len;
+    void *store;
+
+    RedisModule_ReplyWithArray(ctx, stores->cardinality * 2);
+    TrieMapIterator *it = TrieMap_Iterate(stores, "", 0);
+    while(TrieMapIterator_Next(it, &label, &len, &store)) {
+        RedisModule_ReplyWithStringBuffer(ctx, label, len);
+        RedisModule_ReplyWithLongLong(ctx, Store_MemUsage((Store*)store));
+    }
+    TrieMapIterator_Free(it);
+}
+
+/* Reports memory used by graph, broken down by component,
+ * replies with a flat list of name, bytes pairs.
+ * Args:
+ * argv[1] graph name */
+int MGraph_Memory(RedisModuleCtx *ctx, RedisModuleString **argv, int argc) {
+    if(argc != 2) return RedisModule_WrongArity(ctx);
+
+    const char *graphName = RedisModule_StringPtrLen(argv[1], NULL);
+    GraphContext *gc = GraphContext_Get(ctx, graphName, 0);
+    if(gc == NULL) {
+        RedisModule_ReplyWithError(ctx, "Graph does not exists.");
+        return REDISMODULE_OK;
+    }
+
+    GraphMemoryUsage usage;
+    GraphContext_MemUsage(gc, &usage);
+
+    RedisModule_ReplyWithArray(ctx, 30);
+    RedisModule_ReplyWithSimpleString(ctx, "total");
+    RedisModule_ReplyWithLongLong(ctx, usage.total);
+    RedisModule_ReplyWithSimpleString(ctx, "nodes");
+    RedisModule_ReplyWithLongLong(ctx, usage.nodes);
+    RedisModule_ReplyWithSimpleString(ctx, "edges");
+    RedisModule_ReplyWithLongLong(ctx, usage.edges);
+    RedisModule_ReplyWithSimpleString(ctx, "properties");
+    RedisModule_ReplyWithLongLong(ctx, usage.properties);
+    RedisModule_ReplyWithSimpleString(ctx, "node_store");
+    RedisModule_ReplyWithLongLong(ctx, usage.node_store);
+    RedisModule_ReplyWithSimpleString(ctx, "label_bitmaps");
+    RedisModule_ReplyWithLongLong(ctx, usage.label_bitmaps);
+    RedisModule_ReplyWithSimpleString(ctx, "label_bitmaps_by_label");
+    _MGraph_ReplyWithBitmapsMemUsage(ctx, gc->label_bitmaps);
+    RedisModule_ReplyWithSimpleString(ctx, "edge_store");
+    RedisModule_ReplyWithLongLong(ctx, usage.edge_store);
+    RedisModule_ReplyWithSimpleString(ctx, "type_stores");
+    RedisModule_ReplyWithLongLong(ctx, usage.type_stores);
+    RedisModule_ReplyWithSimpleString(ctx, "type_stores_by_type");
+    _MGraph_ReplyWithStoresMemUsage(ctx, gc->type_stores);
+    RedisModule_ReplyWithSimpleString(ctx, "hexastore");
+    RedisModule_ReplyWithLongLong(ctx, usage.hexastore);
+    RedisModule_ReplyWithSimpleString(ctx, "indexes");
+    RedisModule_ReplyWithLongLong(ctx, usage.indexes);
+    RedisModule_ReplyWithSimpleString(ctx, "schemas");
+    RedisModule_ReplyWithLongLong(ctx, usage.schemas);
+    RedisModule_ReplyWithSimpleString(ctx, "dictionaries");
+    RedisModule_ReplyWithLongLong(ctx, usage.dictionaries);
+    RedisModule_ReplyWithSimpleString(ctx, "dictionary_savings");
+    RedisModule_ReplyWithLongLong(ctx, usage.dictionary_savings);
     return REDISMODULE_OK;
 }
 
@@ -400,6 +584,11 @@ int RedisModule_OnLoad(RedisModuleCtx *ctx, RedisModuleString **argv, int argc)
         return REDISMODULE_ERR;
     }
 
+    if(GraphContextType_Register(ctx) == REDISMODULE_ERR) {
+        printf("Failed to register graphcontexttype\n");
+        return REDISMODULE_ERR;
+    }
+
     if(RedisModule_CreateCommand(ctx, "graph.CREATENODE", MGraph_CreateNode, "write", 1, 1, 1) == REDISMODULE_ERR) {
         return REDISMODULE_ERR;
     }
@@ -425,5 +614,13 @@ int RedisModule_OnLoad(RedisModuleCtx *ctx, RedisModuleString **argv, int argc)
         return REDISMODULE_ERR;
     }
 
+    if(RedisModule_CreateCommand(ctx, "graph.SHORTESTPATH", MGraph_ShortestPath, "readonly", 1, 1, 1) == REDISMODULE_ERR) {
+        return REDISMODULE_ERR;
+    }
+
+    if(RedisModule_CreateCommand(ctx, "graph.MEMORY", MGraph_Memory, "readonly", 1, 1, 1) == REDISMODULE_ERR) {
+        return REDISMODULE_ERR;
+    }
+
     return REDISMODULE_OK;
 }
\ No newline at end of file
@@ -38,6 +38,18 @@ AST_FilterNode* New_AST_ConstantPredicateNode(const char* alias, const char* pro
 	return n;
 }
 
+AST_FilterNode* New_AST_ParameterPredicateNode(const char* alias, const char* property, int op, const char* paramName) {
+	AST_FilterNode *n = malloc(sizeof(AST_FilterNode));
+	n->t = N_PRED;
+
+	n->pn.t = N_PARAMETER;
+	n->pn.alias = strdup(alias);
+	n->pn.property = strdup(property);
+	n->pn.paramName = strdup(paramName);
+	n->pn.op = op;
+
+	return n;
+}
 
 AST_FilterNode *New_AST_ConditionNode(AST_FilterNode *left, int op, AST_FilterNode *right) {
   AST_FilterNode *n = malloc(sizeof(AST_FilterNode));
@@ -70,7 +82,13 @@ void FreePredicateNode(AST_PredicateNode* predicateNode) {
 		}
 	}
 
-	// TODO: Should I free constVal?
+	if(predicateNode->t == N_PARAMETER) {
+		free(predicateNode->paramName);
+	}
+
+	if(predicateNode->t == N_CONSTANT) {
+		SIValue_Free(&predicateNode->constVal);
+	}
 }
 
 
@@ -87,6 +105,11 @@ void Free_AST_FilterNode(AST_FilterNode* filterNode) {
 			Free_AST_FilterNode(filterNode->cn.right);
 			break;
 	}
+	free(filterNode);
+}
+
+int AST_LinkEntity_FixedLength(const AST_LinkEntity *link) {
+	return link->length.minHops == 1 && link->length.maxHops == 1;
 }
 
 AST_LinkEntity* New_AST_LinkEntity(char *alias, char *label, Vector *properties, AST_LinkDirection dir) {
@@ -94,6 +117,8 @@ AST_LinkEntity* New_AST_LinkEntity(char *alias, char *label, Vector *properties,
 	le->direction = dir;
 	le->ge.t = N_LINK;
 	le->ge.properties = properties;
+	le->length.minHops = 1;
+	le->length.maxHops = 1;
 	
 	if(label != NULL) {
 		le->ge.label = strdup(label);
@@ -148,9 +173,9 @@ AST_MatchNode* New_AST_MatchNode(Vector *elements) {
 
 void Free_AST_MatchNode(AST_MatchNode *matchNode) {
 	for(int i = 0; i < Vector_Size(matchNode->graphEntities); i++) {
-		GraphEntity *ge;
+		AST_GraphEntity *ge;
 		Vector_Get(matchNode->graphEntities, i, &ge);
-		FreeGraphEntity(ge);
+		Free_AST_GraphEntity(ge);
 	}
 
 	Vector_Free(matchNode->graphEntities);
@@ -198,6 +223,7 @@ AST_ReturnElementNode* New_AST_ReturnElementNode(AST_ReturnElementType type, AST
 	returnElementNode->variable = variable;
 	returnElementNode->func = NULL;
 	returnElementNode->alias = NULL;
+	returnElementNode->nullable = 0;
 
 	if(type == N_AGG_FUNC) {
 		returnElementNode->func = strdup(aggFunc);
@@ -245,6 +271,7 @@ void Free_AST_QueryExpressionNode(AST_QueryExpressionNode *queryExpressionNode)
 	Free_AST_WhereNode(queryExpressionNode->whereNode);
 	Free_AST_ReturnNode(queryExpressionNode->returnNode);
 	Free_AST_OrderNode(queryExpressionNode->orderNode);
+	Free_AST_LimitNode(queryExpressionNode->limitNode);
 	free(queryExpressionNode);
 }
 
@@ -23,6 +23,7 @@ typedef enum {
 typedef enum {
 	N_CONSTANT,
 	N_VARYING,
+	N_PARAMETER,
 } AST_CompareValueType;
 
 typedef enum {
@@ -52,9 +53,19 @@ typedef struct {
 
 typedef AST_GraphEntity AST_NodeEntity;
 
+#define AST_LINK_UNBOUNDED -1
+
+/* Number of hops a link spans, a variable length link
+ * -[*min..max]-> spans anywhere between min and max hops. */
+typedef struct {
+	int minHops;
+	int maxHops;	// AST_LINK_UNBOUNDED if link has no upper bound.
+} AST_LinkLength;
+
 typedef struct {
 	AST_GraphEntity ge;
 	AST_LinkDirection direction;
+	AST_LinkLength length;
 } AST_LinkEntity;
 
 typedef struct {
@@ -64,8 +75,9 @@ typedef struct {
 			char *alias;
 			char *property;
 		} nodeVal;
+		char *paramName;	// Query parameter name, without leading '$'
 	};
-	AST_CompareValueType t; // Comapred value type, constant/node
+	AST_CompareValueType t; // Comapred value type, constant/node/parameter
 	char *alias;		// Node alias
 	char *property; 	// Node property
 	int op;				// Type of comparison
@@ -112,6 +124,7 @@ typedef struct {
 	char *func;			// Aggregation function
 	char *alias; 		// Alias given to this return element (using the AS keyword)
 	AST_ReturnElementType type;
+	int nullable;		// Entities missing the property yield NULL rather than being dropped
 } AST_ReturnElementNode;
 
 typedef struct {
@@ -136,8 +149,11 @@ typedef struct {
 AST_NodeEntity* New_AST_NodeEntity(char *alias, char *label, Vector *properties);
 AST_LinkEntity* New_AST_LinkEntity(char *alias, char *relationship, Vector *properties, AST_LinkDirection dir);
 AST_MatchNode* New_AST_MatchNode(Vector *elements);
+/* Checks if link spans a single hop. */
+int AST_LinkEntity_FixedLength(const AST_LinkEntity *link);
 AST_FilterNode* New_AST_ConstantPredicateNode(const char *alias, const char *property, int op, SIValue value);
 AST_FilterNode* New_AST_VaryingPredicateNode(const char *lAlias, const char *lProperty, int op, const char *rAlias, const char *rProperty);
+AST_FilterNode* New_AST_ParameterPredicateNode(const char *alias, const char *property, int op, const char *paramName);
 AST_FilterNode* New_AST_ConditionNode(AST_FilterNode *left, int op, AST_FilterNode *right);
 AST_WhereNode* New_AST_WhereNode(AST_FilterNode *filters);
 AST_ReturnElementNode* New_AST_ReturnElementNode(AST_ReturnElementType type, AST_Variable *variable, const char *aggFunc, const char *alias);
@@ -96,27 +96,28 @@
 #endif
 /************* Begin control #defines *****************************************/
 #define YYCODETYPE unsigned char
-#define YYNOCODE 60
-#define YYACTIONTYPE unsigned char
+#define YYNOCODE 65
+#define YYACTIONTYPE unsigned short int
 #define ParseTOKENTYPE Token
 typedef union {
   int yyinit;
   ParseTOKENTYPE yy0;
-  AST_ReturnNode* yy6;
-  AST_ReturnElementNode* yy7;
-  AST_MatchNode* yy11;
-  SIValue yy18;
-  AST_LinkEntity* yy19;
-  AST_QueryExpressionNode* yy38;
-  AST_WhereNode* yy43;
-  AST_FilterNode* yy46;
-  Vector* yy54;
-  AST_NodeEntity* yy61;
-  AST_OrderNode* yy76;
-  AST_Variable* yy94;
-  AST_ColumnNode* yy98;
-  AST_LimitNode* yy105;
-  int yy110;
+  AST_FilterNode* yy2;
+  AST_MatchNode* yy21;
+  AST_OrderNode* yy36;
+  AST_ColumnNode* yy38;
+  AST_WhereNode* yy51;
+  AST_Variable* yy52;
+  AST_ReturnElementNode* yy58;
+  AST_QueryExpressionNode* yy78;
+  AST_LimitNode* yy79;
+  int yy92;
+  AST_ReturnNode* yy96;
+  AST_NodeEntity* yy101;
+  SIValue yy102;
+  AST_LinkEntity* yy109;
+  Vector* yy114;
+  AST_LinkLength yy116;
 } YYMINORTYPE;
 #ifndef YYSTACKDEPTH
 #define YYSTACKDEPTH 100
@@ -125,16 +126,16 @@ typedef union {
 #define ParseARG_PDECL , parseCtx *ctx 
 #define ParseARG_FETCH  parseCtx *ctx  = yypParser->ctx 
 #define ParseARG_STORE yypParser->ctx  = ctx 
-#define YYNSTATE             72
-#define YYNRULE              58
-#define YY_MAX_SHIFT         71
-#define YY_MIN_SHIFTREDUCE   114
-#define YY_MAX_SHIFTREDUCE   171
-#define YY_MIN_REDUCE        172
-#define YY_MAX_REDUCE        229
-#define YY_ERROR_ACTION      230
-#define YY_ACCEPT_ACTION     231
-#define YY_NO_ACTION         232
+#define YYNSTATE             88
+#define YYNRULE              71
+#define YY_MAX_SHIFT         87
+#define YY_MIN_SHIFTREDUCE   135
+#define YY_MAX_SHIFTREDUCE   205
+#define YY_MIN_REDUCE        206
+#define YY_MAX_REDUCE        276
+#define YY_ERROR_ACTION      277
+#define YY_ACCEPT_ACTION     278
+#define YY_NO_ACTION         279
 /************* End control #defines *******************************************/
 
 /* Define the yytestcase() macro to be a no-op if is not already defined
@@ -206,74 +207,82 @@ typedef union {
 **  yy_default[]       Default action for each state.
 **
 *********** Begin parsing tables **********************************************/
-#define YY_ACTTAB_COUNT (150)
+#define YY_ACTTAB_COUNT (173)
 static const YYACTIONTYPE yy_action[] = {
- /*     0 */   140,  141,  144,  142,  143,   71,  231,   32,  147,  153,
- /*    10 */    65,  157,   56,   66,  154,   65,  157,   14,  117,   22,
- /*    20 */   145,   19,  146,  148,  149,  150,  146,  148,  149,  150,
- /*    30 */    59,  154,   65,  157,  168,   36,   34,  167,   12,   39,
- /*    40 */    13,   47,   15,   17,    6,   41,   25,  168,   25,   53,
- /*    50 */   166,   28,   25,  137,    2,    5,   25,  164,  165,   16,
- /*    60 */    58,   15,   17,   36,   67,   68,   11,    9,   49,  136,
- /*    70 */    43,   54,   33,   45,   42,   10,   48,   27,   50,   25,
- /*    80 */    63,  118,   38,  138,   35,   37,   40,   70,   44,   69,
- /*    90 */    46,    1,  115,  132,   51,   52,   29,   30,   18,  124,
- /*   100 */   127,   62,   31,   20,  128,   21,  126,  125,  123,  122,
- /*   110 */   120,   23,  121,    8,   26,  119,   24,   17,  130,  135,
- /*   120 */     7,   60,  161,  172,  156,   61,  159,   55,   57,   67,
- /*   130 */   174,    3,  174,  174,  174,  174,  174,  174,   64,  174,
- /*   140 */   174,  174,  171,  174,  174,  174,  174,  174,  174,    4,
+ /*     0 */    68,  170,  171,  174,  172,  173,   87,  278,   38,  176,
+ /*    10 */     3,  177,   65,   13,  140,  166,   64,  178,  179,  180,
+ /*    20 */   176,   82,  184,   81,  187,  175,   32,   44,  178,  179,
+ /*    30 */   180,   71,  184,   81,  187,  183,   81,  187,  202,    7,
+ /*    40 */    40,  201,   14,   47,   15,   58,   17,   19,    2,   44,
+ /*    50 */    41,   16,  140,  202,   52,   32,  200,   29,  167,   22,
+ /*    60 */    43,   41,   18,   70,   50,   48,  198,  199,   74,   17,
+ /*    70 */    19,   79,   21,   12,  165,   84,   60,    8,   28,   56,
+ /*    80 */    27,   45,   34,   83,   77,   59,   11,   83,   32,   41,
+ /*    90 */    61,   66,   39,  168,   23,   42,  147,   46,   51,  141,
+ /*   100 */    20,   25,   53,   86,   54,   85,   55,   57,    1,  161,
+ /*   110 */    63,   62,  150,  136,   24,  156,   37,   35,   36,  155,
+ /*   120 */   151,   49,   26,  149,  148,  146,  145,  143,   30,  144,
+ /*   130 */    31,   10,  159,  142,   33,    6,   19,   67,  164,    9,
+ /*   140 */    69,    4,  195,   73,  191,  206,  208,  193,   76,  186,
+ /*   150 */   189,   72,  208,  208,   83,   75,  208,   78,   80,  208,
+ /*   160 */   205,  208,  208,  208,  208,  208,  208,  208,  208,  208,
+ /*   170 */   208,  208,    5,
 };
 static const YYCODETYPE yy_lookahead[] = {
- /*     0 */     3,    4,    5,    6,    7,   37,   38,   39,   10,   54,
- /*    10 */    55,   56,   10,   53,   54,   55,   56,   44,   45,   13,
- /*    20 */    23,   15,   24,   25,   26,   27,   24,   25,   26,   27,
- /*    30 */    53,   54,   55,   56,   55,   10,   57,   58,   10,   11,
- /*    40 */    10,   11,    1,    2,   20,   11,   18,   55,   18,   11,
- /*    50 */    58,    9,   18,   12,   29,    8,   18,   33,   34,    9,
- /*    60 */    10,    1,    2,   10,   22,   10,    9,   52,   50,   50,
- /*    70 */    47,   51,   51,   47,   47,   16,   47,   46,   10,   18,
- /*    80 */    10,   45,   47,   51,   51,   48,   47,   35,   48,   31,
- /*    90 */    47,   28,   43,   49,   49,   47,   42,   41,   21,   13,
- /*   100 */    17,   55,   40,   10,   17,   10,   17,   17,   14,   12,
- /*   110 */    12,   10,   12,   11,   10,   12,   20,    2,   19,   10,
- /*   120 */    10,   30,   10,    0,   10,   12,   10,   22,   22,   22,
- /*   130 */    59,   20,   59,   59,   59,   59,   59,   59,   30,   59,
- /*   140 */    59,   59,   24,   59,   59,   59,   59,   59,   59,   32,
+ /*     0 */    11,    3,    4,    5,    6,    7,   40,   41,   42,   20,
+ /*    10 */     8,   11,   47,   48,   49,   26,   12,   28,   29,   30,
+ /*    20 */    20,   58,   59,   60,   61,   27,   22,   11,   28,   29,
+ /*    30 */    30,   58,   59,   60,   61,   59,   60,   61,   60,    9,
+ /*    40 */    62,   63,   11,   12,   11,   12,    1,    2,   32,   11,
+ /*    50 */    19,   48,   49,   60,   12,   22,   63,   14,   13,   16,
+ /*    60 */    11,   19,   10,   11,   20,   21,   36,   37,   19,    1,
+ /*    70 */     2,   13,   10,   10,   55,   11,   55,   57,   53,   51,
+ /*    80 */    53,   52,   50,   25,   60,   51,   17,   25,   22,   19,
+ /*    90 */    11,   56,   56,   56,   53,   56,   14,   51,   51,   49,
+ /*   100 */    24,   53,   51,   38,   51,   34,   52,   51,   31,   54,
+ /*   110 */    51,   54,   18,   46,   11,   20,   43,   45,   44,   20,
+ /*   120 */    18,   21,   11,   18,   18,   15,   13,   13,   11,   13,
+ /*   130 */     9,   12,   23,   13,   11,    9,    2,   25,   11,   11,
+ /*   140 */    25,    9,   11,   13,   11,    0,   64,   11,   13,   11,
+ /*   150 */    11,   33,   64,   64,   25,   33,   64,   33,   33,   64,
+ /*   160 */    20,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+ /*   170 */    64,   64,   35,
 };
-#define YY_SHIFT_USE_DFLT (150)
-#define YY_SHIFT_COUNT    (71)
-#define YY_SHIFT_MIN      (-3)
-#define YY_SHIFT_MAX      (123)
+#define YY_SHIFT_USE_DFLT (173)
+#define YY_SHIFT_COUNT    (87)
+#define YY_SHIFT_MIN      (-11)
+#define YY_SHIFT_MAX      (145)
 static const short yy_shift_ofst[] = {
- /*     0 */    47,   25,   53,   53,   55,   57,   55,   -3,   -2,    2,
- /*    10 */    28,   30,   34,   38,    6,   50,   50,   50,   50,   59,
- /*    20 */    61,   61,   59,   61,   68,   68,   61,   57,   70,   52,
- /*    30 */    58,   63,   77,   41,   24,   60,   42,   86,   83,   93,
- /*    40 */    87,   95,   89,   90,   94,   97,   98,  101,  100,   96,
- /*    50 */   102,   99,  103,  104,  115,  109,  105,  110,  106,  111,
- /*    60 */   112,   91,  113,  107,  114,  108,  111,  116,  107,  117,
- /*    70 */   118,  123,
+ /*     0 */     2,   16,   38,   63,   38,   64,   63,   64,  -11,   -2,
+ /*    10 */     0,   31,   33,   43,   42,    4,   43,   52,   52,   52,
+ /*    20 */    52,   49,   69,   66,   70,   66,   70,   66,   66,   69,
+ /*    30 */    66,   79,   79,   66,   63,   65,   71,   77,   76,   45,
+ /*    40 */    30,   44,   68,   58,   62,   82,   94,  103,   95,   99,
+ /*    50 */   100,  102,  111,  105,  106,  110,  113,  114,  117,  116,
+ /*    60 */   121,  119,  109,  120,  123,  126,  134,  127,  112,  128,
+ /*    70 */   115,  132,  131,  118,  130,  133,  122,  135,  136,  124,
+ /*    80 */   138,  125,  132,  139,  129,  137,  140,  145,
 };
-#define YY_REDUCE_USE_DFLT (-46)
-#define YY_REDUCE_COUNT (32)
-#define YY_REDUCE_MIN   (-45)
-#define YY_REDUCE_MAX   (62)
+#define YY_REDUCE_USE_DFLT (-38)
+#define YY_REDUCE_COUNT (38)
+#define YY_REDUCE_MIN   (-37)
+#define YY_REDUCE_MAX   (74)
 static const signed char yy_reduce_ofst[] = {
- /*     0 */   -32,  -40,  -23,  -45,  -21,  -27,   -8,   15,   18,   19,
- /*    10 */    23,   26,   27,   29,   31,   20,   21,   32,   33,   37,
- /*    20 */    35,   39,   40,   43,   44,   45,   48,   36,   46,   49,
- /*    30 */    54,   56,   62,
+ /*     0 */   -34,  -37,  -27,  -35,  -24,  -22,    3,   -7,   19,   20,
+ /*    10 */    21,   25,   28,   32,   27,   34,   32,   35,   36,   37,
+ /*    20 */    39,   24,   29,   46,   41,   47,   48,   51,   53,   54,
+ /*    30 */    56,   55,   57,   59,   50,   67,   72,   74,   73,
 };
 static const YYACTIONTYPE yy_default[] = {
- /*     0 */   230,  230,  230,  230,  230,  230,  230,  230,  230,  230,
- /*    10 */   187,  187,  187,  187,  174,  230,  230,  230,  230,  230,
- /*    20 */   187,  187,  230,  187,  230,  230,  187,  230,  230,  228,
- /*    30 */   220,  230,  191,  230,  221,  192,  216,  230,  230,  230,
- /*    40 */   230,  230,  230,  230,  230,  230,  230,  230,  230,  189,
- /*    50 */   230,  230,  230,  230,  197,  230,  205,  230,  230,  210,
- /*    60 */   230,  218,  230,  230,  230,  213,  209,  230,  227,  230,
- /*    70 */   230,  230,
+ /*     0 */   277,  277,  277,  277,  277,  277,  277,  277,  277,  277,
+ /*    10 */   277,  223,  229,  209,  223,  229,  210,  277,  277,  277,
+ /*    20 */   277,  277,  277,  229,  223,  229,  223,  229,  229,  277,
+ /*    30 */   229,  277,  277,  229,  277,  275,  267,  277,  233,  277,
+ /*    40 */   268,  224,  234,  277,  259,  277,  277,  277,  277,  228,
+ /*    50 */   225,  277,  277,  277,  277,  277,  277,  277,  277,  277,
+ /*    60 */   231,  277,  277,  277,  277,  208,  240,  277,  248,  277,
+ /*    70 */   277,  253,  277,  265,  277,  277,  261,  277,  277,  263,
+ /*    80 */   277,  256,  252,  277,  274,  277,  277,  277,
 };
 /********** End of lemon-generated parsing tables *****************************/
 
@@ -380,19 +389,20 @@ void ParseTrace(FILE *TraceFILE, char *zTracePrompt){
 static const char *const yyTokenName[] = { 
   "$",             "OR",            "AND",           "EQ",          
   "GT",            "GE",            "LT",            "LE",          
-  "MATCH",         "LEFT_PARENTHESIS",  "STRING",        "COLON",       
-  "RIGHT_PARENTHESIS",  "DASH",          "RIGHT_ARROW",   "LEFT_ARROW",  
-  "LEFT_BRACKET",  "RIGHT_BRACKET",  "LEFT_CURLY_BRACKET",  "RIGHT_CURLY_BRACKET",
-  "COMMA",         "WHERE",         "DOT",           "NE",          
-  "INTEGER",       "FLOAT",         "TRUE",          "FALSE",       
-  "RETURN",        "DISTINCT",      "AS",            "ORDER",       
-  "BY",            "ASC",           "DESC",          "LIMIT",       
-  "error",         "expr",          "query",         "matchClause", 
-  "whereClause",   "returnClause",  "orderClause",   "limitClause", 
+  "MATCH",         "COMMA",         "LEFT_PARENTHESIS",  "STRING",      
+  "COLON",         "RIGHT_PARENTHESIS",  "DASH",          "RIGHT_ARROW", 
+  "LEFT_ARROW",    "LEFT_BRACKET",  "RIGHT_BRACKET",  "STAR",        
+  "INTEGER",       "DOTDOT",        "LEFT_CURLY_BRACKET",  "RIGHT_CURLY_BRACKET",
+  "WHERE",         "DOT",           "PARAMETER",     "NE",          
+  "FLOAT",         "TRUE",          "FALSE",         "RETURN",      
+  "DISTINCT",      "AS",            "ORDER",         "BY",          
+  "ASC",           "DESC",          "LIMIT",         "error",       
+  "expr",          "query",         "matchClause",   "whereClause", 
+  "returnClause",  "orderClause",   "limitClause",   "chains",      
   "chain",         "node",          "link",          "properties",  
-  "edge",          "mapLiteral",    "value",         "cond",        
-  "op",            "returnElements",  "returnElement",  "variable",    
-  "aggFunc",       "columnNameList",  "columnName",  
+  "edge",          "hops",          "mapLiteral",    "value",       
+  "cond",          "op",            "returnElements",  "returnElement",
+  "variable",      "aggFunc",       "columnNameList",  "columnName",  
 };
 #endif /* NDEBUG */
 
@@ -402,62 +412,75 @@ static const char *const yyTokenName[] = {
 static const char *const yyRuleName[] = {
  /*   0 */ "query ::= expr",
  /*   1 */ "expr ::= matchClause whereClause returnClause orderClause limitClause",
- /*   2 */ "matchClause ::= MATCH chain",
- /*   3 */ "chain ::= node",
- /*   4 */ "chain ::= chain link node",
- /*   5 */ "node ::= LEFT_PARENTHESIS STRING COLON STRING properties RIGHT_PARENTHESIS",
- /*   6 */ "node ::= LEFT_PARENTHESIS COLON STRING properties RIGHT_PARENTHESIS",
- /*   7 */ "node ::= LEFT_PARENTHESIS STRING properties RIGHT_PARENTHESIS",
- /*   8 */ "node ::= LEFT_PARENTHESIS properties RIGHT_PARENTHESIS",
- /*   9 */ "link ::= DASH edge RIGHT_ARROW",
- /*  10 */ "link ::= LEFT_ARROW edge DASH",
- /*  11 */ "edge ::= LEFT_BRACKET properties RIGHT_BRACKET",
- /*  12 */ "edge ::= LEFT_BRACKET STRING properties RIGHT_BRACKET",
- /*  13 */ "edge ::= LEFT_BRACKET COLON STRING properties RIGHT_BRACKET",
- /*  14 */ "edge ::= LEFT_BRACKET STRING COLON STRING properties RIGHT_BRACKET",
- /*  15 */ "properties ::=",
- /*  16 */ "properties ::= LEFT_CURLY_BRACKET mapLiteral RIGHT_CURLY_BRACKET",
- /*  17 */ "mapLiteral ::= STRING COLON value",
- /*  18 */ "mapLiteral ::= STRING COLON value COMMA mapLiteral",
- /*  19 */ "whereClause ::=",
- /*  20 */ "whereClause ::= WHERE cond",
- /*  21 */ "cond ::= STRING DOT STRING op STRING DOT STRING",
- /*  22 */ "cond ::= STRING DOT STRING op value",
- /*  23 */ "cond ::= LEFT_PARENTHESIS cond RIGHT_PARENTHESIS",
- /*  24 */ "cond ::= cond AND cond",
- /*  25 */ "cond ::= cond OR cond",
- /*  26 */ "op ::= EQ",
- /*  27 */ "op ::= GT",
- /*  28 */ "op ::= LT",
- /*  29 */ "op ::= LE",
- /*  30 */ "op ::= GE",
- /*  31 */ "op ::= NE",
- /*  32 */ "value ::= INTEGER",
- /*  33 */ "value ::= STRING",
- /*  34 */ "value ::= FLOAT",
- /*  35 */ "value ::= TRUE",
- /*  36 */ "value ::= FALSE",
- /*  37 */ "returnClause ::= RETURN returnElements",
- /*  38 */ "returnClause ::= RETURN DISTINCT returnElements",
- /*  39 */ "returnElements ::= returnElements COMMA returnElement",
- /*  40 */ "returnElements ::= returnElement",
- /*  41 */ "returnElement ::= variable",
- /*  42 */ "returnElement ::= variable AS STRING",
- /*  43 */ "returnElement ::= aggFunc",
- /*  44 */ "returnElement ::= STRING",
- /*  45 */ "variable ::= STRING DOT STRING",
- /*  46 */ "aggFunc ::= STRING LEFT_PARENTHESIS variable RIGHT_PARENTHESIS",
- /*  47 */ "aggFunc ::= STRING LEFT_PARENTHESIS variable RIGHT_PARENTHESIS AS STRING",
- /*  48 */ "orderClause ::=",
- /*  49 */ "orderClause ::= ORDER BY columnNameList",
- /*  50 */ "orderClause ::= ORDER BY columnNameList ASC",
- /*  51 */ "orderClause ::= ORDER BY columnNameList DESC",
- /*  52 */ "columnNameList ::= columnNameList COMMA columnName",
- /*  53 */ "columnNameList ::= columnName",
- /*  54 */ "columnName ::= variable",
- /*  55 */ "columnName ::= STRING",
- /*  56 */ "limitClause ::=",
- /*  57 */ "limitClause ::= LIMIT INTEGER",
+ /*   2 */ "matchClause ::= MATCH chains",
+ /*   3 */ "chains ::= chain",
+ /*   4 */ "chains ::= chains COMMA chain",
+ /*   5 */ "chain ::= node",
+ /*   6 */ "chain ::= chain link node",
+ /*   7 */ "node ::= LEFT_PARENTHESIS STRING COLON STRING properties RIGHT_PARENTHESIS",
+ /*   8 */ "node ::= LEFT_PARENTHESIS COLON STRING properties RIGHT_PARENTHESIS",
+ /*   9 */ "node ::= LEFT_PARENTHESIS STRING properties RIGHT_PARENTHESIS",
+ /*  10 */ "node ::= LEFT_PARENTHESIS properties RIGHT_PARENTHESIS",
+ /*  11 */ "link ::= DASH edge RIGHT_ARROW",
+ /*  12 */ "link ::= LEFT_ARROW edge DASH",
+ /*  13 */ "edge ::= LEFT_BRACKET hops properties RIGHT_BRACKET",
+ /*  14 */ "edge ::= LEFT_BRACKET STRING hops properties RIGHT_BRACKET",
+ /*  15 */ "edge ::= LEFT_BRACKET COLON STRING hops properties RIGHT_BRACKET",
+ /*  16 */ "edge ::= LEFT_BRACKET STRING COLON STRING hops properties RIGHT_BRACKET",
+ /*  17 */ "hops ::=",
+ /*  18 */ "hops ::= STAR",
+ /*  19 */ "hops ::= STAR INTEGER",
+ /*  20 */ "hops ::= STAR INTEGER DOTDOT INTEGER",
+ /*  21 */ "hops ::= STAR DOTDOT INTEGER",
+ /*  22 */ "hops ::= STAR INTEGER DOTDOT",
+ /*  23 */ "properties ::=",
+ /*  24 */ "properties ::= LEFT_CURLY_BRACKET mapLiteral RIGHT_CURLY_BRACKET",
+ /*  25 */ "mapLiteral ::= STRING COLON value",
+ /*  26 */ "mapLiteral ::= STRING COLON value COMMA mapLiteral",
+ /*  27 */ "whereClause ::=",
+ /*  28 */ "whereClause ::= WHERE cond",
+ /*  29 */ "cond ::= STRING DOT STRING op STRING DOT STRING",
+ /*  30 */ "cond ::= STRING DOT STRING op value",
+ /*  31 */ "cond ::= STRING DOT STRING op PARAMETER",
+ /*  32 */ "cond ::= LEFT_PARENTHESIS cond RIGHT_PARENTHESIS",
+ /*  33 */ "cond ::= cond AND cond",
+ /*  34 */ "cond ::= cond OR cond",
+ /*  35 */ "op ::= EQ",
+ /*  36 */ "op ::= GT",
+ /*  37 */ "op ::= LT",
+ /*  38 */ "op ::= LE",
+ /*  39 */ "op ::= GE",
+ /*  40 */ "op ::= NE",
+ /*  41 */ "value ::= INTEGER",
+ /*  42 */ "value ::= STRING",
+ /*  43 */ "value ::= FLOAT",
+ /*  44 */ "value ::= TRUE",
+ /*  45 */ "value ::= FALSE",
+ /*  46 */ "returnClause ::= RETURN returnElements",
+ /*  47 */ "returnClause ::= RETURN DISTINCT returnElements",
+ /*  48 */ "returnElements ::= returnElements COMMA returnElement",
+ /*  49 */ "returnElements ::= returnElement",
+ /*  50 */ "returnElement ::= variable",
+ /*  51 */ "returnElement ::= variable AS STRING",
+ /*  52 */ "returnElement ::= aggFunc",
+ /*  53 */ "returnElement ::= STRING",
+ /*  54 */ "variable ::= STRING DOT STRING",
+ /*  55 */ "aggFunc ::= STRING LEFT_PARENTHESIS variable RIGHT_PARENTHESIS",
+ /*  56 */ "aggFunc ::= STRING LEFT_PARENTHESIS variable RIGHT_PARENTHESIS AS STRING",
+ /*  57 */ "aggFunc ::= STRING LEFT_PARENTHESIS STRING RIGHT_PARENTHESIS",
+ /*  58 */ "aggFunc ::= STRING LEFT_PARENTHESIS STRING RIGHT_PARENTHESIS AS STRING",
+ /*  59 */ "aggFunc ::= STRING LEFT_PARENTHESIS STAR RIGHT_PARENTHESIS",
+ /*  60 */ "aggFunc ::= STRING LEFT_PARENTHESIS STAR RIGHT_PARENTHESIS AS STRING",
+ /*  61 */ "orderClause ::=",
+ /*  62 */ "orderClause ::= ORDER BY columnNameList",
+ /*  63 */ "orderClause ::= ORDER BY columnNameList ASC",
+ /*  64 */ "orderClause ::= ORDER BY columnNameList DESC",
+ /*  65 */ "columnNameList ::= columnNameList COMMA columnName",
+ /*  66 */ "columnNameList ::= columnName",
+ /*  67 */ "columnName ::= variable",
+ /*  68 */ "columnName ::= STRING",
+ /*  69 */ "limitClause ::=",
+ /*  70 */ "limitClause ::= LIMIT INTEGER",
 };
 #endif /* NDEBUG */
 
@@ -567,11 +590,11 @@ static void yy_destructor(
     ** inside the C code.
     */
 /********* Begin destructor definitions ***************************************/
-    case 51: /* cond */
+    case 56: /* cond */
 {
-#line 165 "grammar.y"
- Free_AST_FilterNode((yypminor->yy46)); 
-#line 575 "grammar.c"
+#line 223 "grammar.y"
+ Free_AST_FilterNode((yypminor->yy2)); 
+#line 598 "grammar.c"
 }
       break;
 /********* End destructor definitions *****************************************/
@@ -813,64 +836,77 @@ static const struct {
   YYCODETYPE lhs;         /* Symbol on the left-hand side of the rule */
   unsigned char nrhs;     /* Number of right-hand side symbols in the rule */
 } yyRuleInfo[] = {
-  { 38, 1 },
-  { 37, 5 },
-  { 39, 2 },
-  { 44, 1 },
-  { 44, 3 },
-  { 45, 6 },
-  { 45, 5 },
-  { 45, 4 },
-  { 45, 3 },
-  { 46, 3 },
-  { 46, 3 },
-  { 48, 3 },
-  { 48, 4 },
-  { 48, 5 },
-  { 48, 6 },
-  { 47, 0 },
+  { 41, 1 },
+  { 40, 5 },
+  { 42, 2 },
+  { 47, 1 },
   { 47, 3 },
-  { 49, 3 },
+  { 48, 1 },
+  { 48, 3 },
+  { 49, 6 },
   { 49, 5 },
-  { 40, 0 },
-  { 40, 2 },
-  { 51, 7 },
-  { 51, 5 },
-  { 51, 3 },
-  { 51, 3 },
-  { 51, 3 },
-  { 52, 1 },
-  { 52, 1 },
-  { 52, 1 },
-  { 52, 1 },
-  { 52, 1 },
-  { 52, 1 },
-  { 50, 1 },
-  { 50, 1 },
-  { 50, 1 },
-  { 50, 1 },
-  { 50, 1 },
-  { 41, 2 },
-  { 41, 3 },
-  { 53, 3 },
+  { 49, 4 },
+  { 49, 3 },
+  { 50, 3 },
+  { 50, 3 },
+  { 52, 4 },
+  { 52, 5 },
+  { 52, 6 },
+  { 52, 7 },
+  { 53, 0 },
   { 53, 1 },
-  { 54, 1 },
+  { 53, 2 },
+  { 53, 4 },
+  { 53, 3 },
+  { 53, 3 },
+  { 51, 0 },
+  { 51, 3 },
   { 54, 3 },
-  { 54, 1 },
-  { 54, 1 },
-  { 55, 3 },
-  { 56, 4 },
-  { 56, 6 },
-  { 42, 0 },
-  { 42, 3 },
-  { 42, 4 },
-  { 42, 4 },
-  { 57, 3 },
-  { 57, 1 },
-  { 58, 1 },
-  { 58, 1 },
+  { 54, 5 },
   { 43, 0 },
   { 43, 2 },
+  { 56, 7 },
+  { 56, 5 },
+  { 56, 5 },
+  { 56, 3 },
+  { 56, 3 },
+  { 56, 3 },
+  { 57, 1 },
+  { 57, 1 },
+  { 57, 1 },
+  { 57, 1 },
+  { 57, 1 },
+  { 57, 1 },
+  { 55, 1 },
+  { 55, 1 },
+  { 55, 1 },
+  { 55, 1 },
+  { 55, 1 },
+  { 44, 2 },
+  { 44, 3 },
+  { 58, 3 },
+  { 58, 1 },
+  { 59, 1 },
+  { 59, 3 },
+  { 59, 1 },
+  { 59, 1 },
+  { 60, 3 },
+  { 61, 4 },
+  { 61, 6 },
+  { 61, 4 },
+  { 61, 6 },
+  { 61, 4 },
+  { 61, 6 },
+  { 45, 0 },
+  { 45, 3 },
+  { 45, 4 },
+  { 45, 4 },
+  { 62, 3 },
+  { 62, 1 },
+  { 63, 1 },
+  { 63, 1 },
+  { 46, 0 },
+  { 46, 2 },
 };
 
 static void yy_accept(yyParser*);  /* Forward Declaration */
@@ -936,427 +972,538 @@ static void yy_reduce(
         YYMINORTYPE yylhsminor;
       case 0: /* query ::= expr */
 #line 33 "grammar.y"
-{ ctx->root = yymsp[0].minor.yy38; }
-#line 941 "grammar.c"
+{ ctx->root = yymsp[0].minor.yy78; }
+#line 977 "grammar.c"
         break;
       case 1: /* expr ::= matchClause whereClause returnClause orderClause limitClause */
 #line 35 "grammar.y"
 {
-	yylhsminor.yy38 = New_AST_QueryExpressionNode(yymsp[-4].minor.yy11, yymsp[-3].minor.yy43, yymsp[-2].minor.yy6, yymsp[-1].minor.yy76, yymsp[0].minor.yy105);
+	yylhsminor.yy78 = New_AST_QueryExpressionNode(yymsp[-4].minor.yy21, yymsp[-3].minor.yy51, yymsp[-2].minor.yy96, yymsp[-1].minor.yy36, yymsp[0].minor.yy79);
 }
-#line 948 "grammar.c"
-  yymsp[-4].minor.yy38 = yylhsminor.yy38;
+#line 984 "grammar.c"
+  yymsp[-4].minor.yy78 = yylhsminor.yy78;
         break;
-      case 2: /* matchClause ::= MATCH chain */
+      case 2: /* matchClause ::= MATCH chains */
 #line 42 "grammar.y"
 {
-	yymsp[-1].minor.yy11 = New_AST_MatchNode(yymsp[0].minor.yy54);
+	yymsp[-1].minor.yy21 = New_AST_MatchNode(yymsp[0].minor.yy114);
 }
-#line 956 "grammar.c"
+#line 992 "grammar.c"
         break;
-      case 3: /* chain ::= node */
-#line 49 "grammar.y"
+      case 3: /* chains ::= chain */
+#line 50 "grammar.y"
 {
-	yylhsminor.yy54 = NewVector(AST_GraphEntity*, 1);
-	Vector_Push(yylhsminor.yy54, yymsp[0].minor.yy61);
+	yylhsminor.yy114 = yymsp[0].minor.yy114;
 }
-#line 964 "grammar.c"
-  yymsp[0].minor.yy54 = yylhsminor.yy54;
+#line 999 "grammar.c"
+  yymsp[0].minor.yy114 = yylhsminor.yy114;
         break;
-      case 4: /* chain ::= chain link node */
+      case 4: /* chains ::= chains COMMA chain */
 #line 54 "grammar.y"
 {
-	Vector_Push(yymsp[-2].minor.yy54, yymsp[-1].minor.yy19);
-	Vector_Push(yymsp[-2].minor.yy54, yymsp[0].minor.yy61);
-	yylhsminor.yy54 = yymsp[-2].minor.yy54;
+	for(int i = 0; i < Vector_Size(yymsp[0].minor.yy114); i++) {
+		AST_GraphEntity *ge;
+		Vector_Get(yymsp[0].minor.yy114, i, &ge);
+		Vector_Push(yymsp[-2].minor.yy114, ge);
+	}
+	Vector_Free(yymsp[0].minor.yy114);
+	yylhsminor.yy114 = yymsp[-2].minor.yy114;
+}
+#line 1013 "grammar.c"
+  yymsp[-2].minor.yy114 = yylhsminor.yy114;
+        break;
+      case 5: /* chain ::= node */
+#line 67 "grammar.y"
+{
+	yylhsminor.yy114 = NewVector(AST_GraphEntity*, 1);
+	Vector_Push(yylhsminor.yy114, yymsp[0].minor.yy101);
 }
-#line 974 "grammar.c"
-  yymsp[-2].minor.yy54 = yylhsminor.yy54;
+#line 1022 "grammar.c"
+  yymsp[0].minor.yy114 = yylhsminor.yy114;
         break;
-      case 5: /* node ::= LEFT_PARENTHESIS STRING COLON STRING properties RIGHT_PARENTHESIS */
-#line 64 "grammar.y"
+      case 6: /* chain ::= chain link node */
+#line 72 "grammar.y"
 {
-	yymsp[-5].minor.yy61 = New_AST_NodeEntity(yymsp[-4].minor.yy0.strval, yymsp[-2].minor.yy0.strval, yymsp[-1].minor.yy54);
+	Vector_Push(yymsp[-2].minor.yy114, yymsp[-1].minor.yy109);
+	Vector_Push(yymsp[-2].minor.yy114, yymsp[0].minor.yy101);
+	yylhsminor.yy114 = yymsp[-2].minor.yy114;
 }
-#line 982 "grammar.c"
+#line 1032 "grammar.c"
+  yymsp[-2].minor.yy114 = yylhsminor.yy114;
         break;
-      case 6: /* node ::= LEFT_PARENTHESIS COLON STRING properties RIGHT_PARENTHESIS */
-#line 69 "grammar.y"
+      case 7: /* node ::= LEFT_PARENTHESIS STRING COLON STRING properties RIGHT_PARENTHESIS */
+#line 82 "grammar.y"
 {
-	yymsp[-4].minor.yy61 = New_AST_NodeEntity(NULL, yymsp[-2].minor.yy0.strval, yymsp[-1].minor.yy54);
+	yymsp[-5].minor.yy101 = New_AST_NodeEntity(yymsp[-4].minor.yy0.strval, yymsp[-2].minor.yy0.strval, yymsp[-1].minor.yy114);
 }
-#line 989 "grammar.c"
+#line 1040 "grammar.c"
         break;
-      case 7: /* node ::= LEFT_PARENTHESIS STRING properties RIGHT_PARENTHESIS */
-#line 74 "grammar.y"
+      case 8: /* node ::= LEFT_PARENTHESIS COLON STRING properties RIGHT_PARENTHESIS */
+#line 87 "grammar.y"
 {
-	yymsp[-3].minor.yy61 = New_AST_NodeEntity(yymsp[-2].minor.yy0.strval, NULL, yymsp[-1].minor.yy54);
+	yymsp[-4].minor.yy101 = New_AST_NodeEntity(NULL, yymsp[-2].minor.yy0.strval, yymsp[-1].minor.yy114);
 }
-#line 996 "grammar.c"
+#line 1047 "grammar.c"
         break;
-      case 8: /* node ::= LEFT_PARENTHESIS properties RIGHT_PARENTHESIS */
-#line 79 "grammar.y"
+      case 9: /* node ::= LEFT_PARENTHESIS STRING properties RIGHT_PARENTHESIS */
+#line 92 "grammar.y"
 {
-	yymsp[-2].minor.yy61 = New_AST_NodeEntity(NULL, NULL, yymsp[-1].minor.yy54);
+	yymsp[-3].minor.yy101 = New_AST_NodeEntity(yymsp[-2].minor.yy0.strval, NULL, yymsp[-1].minor.yy114);
 }
-#line 1003 "grammar.c"
+#line 1054 "grammar.c"
         break;
-      case 9: /* link ::= DASH edge RIGHT_ARROW */
-#line 86 "grammar.y"
+      case 10: /* node ::= LEFT_PARENTHESIS properties RIGHT_PARENTHESIS */
+#line 97 "grammar.y"
 {
-	yymsp[-2].minor.yy19 = yymsp[-1].minor.yy19;
-	yymsp[-2].minor.yy19->direction = N_LEFT_TO_RIGHT;
+	yymsp[-2].minor.yy101 = New_AST_NodeEntity(NULL, NULL, yymsp[-1].minor.yy114);
 }
-#line 1011 "grammar.c"
+#line 1061 "grammar.c"
         break;
-      case 10: /* link ::= LEFT_ARROW edge DASH */
-#line 92 "grammar.y"
+      case 11: /* link ::= DASH edge RIGHT_ARROW */
+#line 104 "grammar.y"
+{
+	yymsp[-2].minor.yy109 = yymsp[-1].minor.yy109;
+	yymsp[-2].minor.yy109->direction = N_LEFT_TO_RIGHT;
+}
+#line 1069 "grammar.c"
+        break;
+      case 12: /* link ::= LEFT_ARROW edge DASH */
+#line 110 "grammar.y"
 {
-	yymsp[-2].minor.yy19 = yymsp[-1].minor.yy19;
-	yymsp[-2].minor.yy19->direction = N_RIGHT_TO_LEFT;
+	yymsp[-2].minor.yy109 = yymsp[-1].minor.yy109;
+	yymsp[-2].minor.yy109->direction = N_RIGHT_TO_LEFT;
 }
-#line 1019 "grammar.c"
+#line 1077 "grammar.c"
         break;
-      case 11: /* edge ::= LEFT_BRACKET properties RIGHT_BRACKET */
-#line 99 "grammar.y"
+      case 13: /* edge ::= LEFT_BRACKET hops properties RIGHT_BRACKET */
+#line 117 "grammar.y"
 { 
-	yymsp[-2].minor.yy19 = New_AST_LinkEntity(NULL, NULL, yymsp[-1].minor.yy54, N_DIR_UNKNOWN);
+	yymsp[-3].minor.yy109 = New_AST_LinkEntity(NULL, NULL, yymsp[-1].minor.yy114, N_DIR_UNKNOWN);
+	yymsp[-3].minor.yy109->length = yymsp[-2].minor.yy116;
 }
-#line 1026 "grammar.c"
+#line 1085 "grammar.c"
         break;
-      case 12: /* edge ::= LEFT_BRACKET STRING properties RIGHT_BRACKET */
-#line 104 "grammar.y"
+      case 14: /* edge ::= LEFT_BRACKET STRING hops properties RIGHT_BRACKET */
+#line 123 "grammar.y"
 { 
-	yymsp[-3].minor.yy19 = New_AST_LinkEntity(yymsp[-2].minor.yy0.strval, NULL, yymsp[-1].minor.yy54, N_DIR_UNKNOWN);
+	yymsp[-4].minor.yy109 = New_AST_LinkEntity(yymsp[-3].minor.yy0.strval, NULL, yymsp[-1].minor.yy114, N_DIR_UNKNOWN);
+	yymsp[-4].minor.yy109->length = yymsp[-2].minor.yy116;
 }
-#line 1033 "grammar.c"
+#line 1093 "grammar.c"
         break;
-      case 13: /* edge ::= LEFT_BRACKET COLON STRING properties RIGHT_BRACKET */
-#line 109 "grammar.y"
+      case 15: /* edge ::= LEFT_BRACKET COLON STRING hops properties RIGHT_BRACKET */
+#line 129 "grammar.y"
 { 
-	yymsp[-4].minor.yy19 = New_AST_LinkEntity(NULL, yymsp[-2].minor.yy0.strval, yymsp[-1].minor.yy54, N_DIR_UNKNOWN);
+	yymsp[-5].minor.yy109 = New_AST_LinkEntity(NULL, yymsp[-3].minor.yy0.strval, yymsp[-1].minor.yy114, N_DIR_UNKNOWN);
+	yymsp[-5].minor.yy109->length = yymsp[-2].minor.yy116;
 }
-#line 1040 "grammar.c"
+#line 1101 "grammar.c"
         break;
-      case 14: /* edge ::= LEFT_BRACKET STRING COLON STRING properties RIGHT_BRACKET */
-#line 114 "grammar.y"
+      case 16: /* edge ::= LEFT_BRACKET STRING COLON STRING hops properties RIGHT_BRACKET */
+#line 135 "grammar.y"
 { 
-	yymsp[-5].minor.yy19 = New_AST_LinkEntity(yymsp[-4].minor.yy0.strval, yymsp[-2].minor.yy0.strval, yymsp[-1].minor.yy54, N_DIR_UNKNOWN);
+	yymsp[-6].minor.yy109 = New_AST_LinkEntity(yymsp[-5].minor.yy0.strval, yymsp[-3].minor.yy0.strval, yymsp[-1].minor.yy114, N_DIR_UNKNOWN);
+	yymsp[-6].minor.yy109->length = yymsp[-2].minor.yy116;
 }
-#line 1047 "grammar.c"
+#line 1109 "grammar.c"
         break;
-      case 15: /* properties ::= */
-#line 120 "grammar.y"
+      case 17: /* hops ::= */
+#line 142 "grammar.y"
 {
-	yymsp[1].minor.yy54 = NULL;
+	yymsp[1].minor.yy116.minHops = 1;
+	yymsp[1].minor.yy116.maxHops = 1;
 }
-#line 1054 "grammar.c"
+#line 1117 "grammar.c"
         break;
-      case 16: /* properties ::= LEFT_CURLY_BRACKET mapLiteral RIGHT_CURLY_BRACKET */
-#line 124 "grammar.y"
+      case 18: /* hops ::= STAR */
+#line 148 "grammar.y"
 {
-	yymsp[-2].minor.yy54 = yymsp[-1].minor.yy54;
+	yymsp[0].minor.yy116.minHops = 1;
+	yymsp[0].minor.yy116.maxHops = AST_LINK_UNBOUNDED;
 }
-#line 1061 "grammar.c"
+#line 1125 "grammar.c"
         break;
-      case 17: /* mapLiteral ::= STRING COLON value */
-#line 129 "grammar.y"
+      case 19: /* hops ::= STAR INTEGER */
+#line 154 "grammar.y"
+{
+	yymsp[-1].minor.yy116.minHops = yymsp[0].minor.yy0.intval;
+	yymsp[-1].minor.yy116.maxHops = yymsp[0].minor.yy0.intval;
+}
+#line 1133 "grammar.c"
+        break;
+      case 20: /* hops ::= STAR INTEGER DOTDOT INTEGER */
+#line 160 "grammar.y"
+{
+	yymsp[-3].minor.yy116.minHops = yymsp[-2].minor.yy0.intval;
+	yymsp[-3].minor.yy116.maxHops = yymsp[0].minor.yy0.intval;
+}
+#line 1141 "grammar.c"
+        break;
+      case 21: /* hops ::= STAR DOTDOT INTEGER */
+#line 166 "grammar.y"
+{
+	yymsp[-2].minor.yy116.minHops = 1;
+	yymsp[-2].minor.yy116.maxHops = yymsp[0].minor.yy0.intval;
+}
+#line 1149 "grammar.c"
+        break;
+      case 22: /* hops ::= STAR INTEGER DOTDOT */
+#line 172 "grammar.y"
+{
+	yymsp[-2].minor.yy116.minHops = yymsp[-1].minor.yy0.intval;
+	yymsp[-2].minor.yy116.maxHops = AST_LINK_UNBOUNDED;
+}
+#line 1157 "grammar.c"
+        break;
+      case 23: /* properties ::= */
+#line 179 "grammar.y"
 {
-	yylhsminor.yy54 = NewVector(SIValue*, 2);
+	yymsp[1].minor.yy114 = NULL;
+}
+#line 1164 "grammar.c"
+        break;
+      case 24: /* properties ::= LEFT_CURLY_BRACKET mapLiteral RIGHT_CURLY_BRACKET */
+#line 183 "grammar.y"
+{
+	yymsp[-2].minor.yy114 = yymsp[-1].minor.yy114;
+}
+#line 1171 "grammar.c"
+        break;
+      case 25: /* mapLiteral ::= STRING COLON value */
+#line 188 "grammar.y"
+{
+	yylhsminor.yy114 = NewVector(SIValue*, 2);
 
 	SIValue *key = malloc(sizeof(SIValue));
 	*key = SI_StringValC(strdup(yymsp[-2].minor.yy0.strval));
-	Vector_Push(yylhsminor.yy54, key);
+	Vector_Push(yylhsminor.yy114, key);
 
 	SIValue *val = malloc(sizeof(SIValue));
-	*val = yymsp[0].minor.yy18;
-	Vector_Push(yylhsminor.yy54, val);
+	*val = yymsp[0].minor.yy102;
+	Vector_Push(yylhsminor.yy114, val);
 }
-#line 1076 "grammar.c"
-  yymsp[-2].minor.yy54 = yylhsminor.yy54;
+#line 1186 "grammar.c"
+  yymsp[-2].minor.yy114 = yylhsminor.yy114;
         break;
-      case 18: /* mapLiteral ::= STRING COLON value COMMA mapLiteral */
-#line 141 "grammar.y"
+      case 26: /* mapLiteral ::= STRING COLON value COMMA mapLiteral */
+#line 200 "grammar.y"
 {
 	SIValue *key = malloc(sizeof(SIValue));
 	*key = SI_StringValC(strdup(yymsp[-4].minor.yy0.strval));
-	Vector_Push(yymsp[0].minor.yy54, key);
+	Vector_Push(yymsp[0].minor.yy114, key);
 
 	SIValue *val = malloc(sizeof(SIValue));
-	*val = yymsp[-2].minor.yy18;
-	Vector_Push(yymsp[0].minor.yy54, val);
+	*val = yymsp[-2].minor.yy102;
+	Vector_Push(yymsp[0].minor.yy114, val);
 	
-	yylhsminor.yy54 = yymsp[0].minor.yy54;
+	yylhsminor.yy114 = yymsp[0].minor.yy114;
 }
-#line 1092 "grammar.c"
-  yymsp[-4].minor.yy54 = yylhsminor.yy54;
+#line 1202 "grammar.c"
+  yymsp[-4].minor.yy114 = yylhsminor.yy114;
         break;
-      case 19: /* whereClause ::= */
-#line 155 "grammar.y"
+      case 27: /* whereClause ::= */
+#line 214 "grammar.y"
 { 
-	yymsp[1].minor.yy43 = NULL;
+	yymsp[1].minor.yy51 = NULL;
 }
-#line 1100 "grammar.c"
+#line 1210 "grammar.c"
         break;
-      case 20: /* whereClause ::= WHERE cond */
-#line 158 "grammar.y"
+      case 28: /* whereClause ::= WHERE cond */
+#line 217 "grammar.y"
 {
-	//printf("where clause\n");
-	yymsp[-1].minor.yy43 = New_AST_WhereNode(yymsp[0].minor.yy46);
-}
-#line 1108 "grammar.c"
-        break;
-      case 21: /* cond ::= STRING DOT STRING op STRING DOT STRING */
-#line 167 "grammar.y"
-{ yylhsminor.yy46 = New_AST_VaryingPredicateNode(yymsp[-6].minor.yy0.strval, yymsp[-4].minor.yy0.strval, yymsp[-3].minor.yy110, yymsp[-2].minor.yy0.strval, yymsp[0].minor.yy0.strval); }
-#line 1113 "grammar.c"
-  yymsp[-6].minor.yy46 = yylhsminor.yy46;
-        break;
-      case 22: /* cond ::= STRING DOT STRING op value */
-#line 168 "grammar.y"
-{ yylhsminor.yy46 = New_AST_ConstantPredicateNode(yymsp[-4].minor.yy0.strval, yymsp[-2].minor.yy0.strval, yymsp[-1].minor.yy110, yymsp[0].minor.yy18); }
-#line 1119 "grammar.c"
-  yymsp[-4].minor.yy46 = yylhsminor.yy46;
-        break;
-      case 23: /* cond ::= LEFT_PARENTHESIS cond RIGHT_PARENTHESIS */
-#line 169 "grammar.y"
-{ yymsp[-2].minor.yy46 = yymsp[-1].minor.yy46; }
-#line 1125 "grammar.c"
+	yymsp[-1].minor.yy51 = New_AST_WhereNode(yymsp[0].minor.yy2);
+}
+#line 1217 "grammar.c"
         break;
-      case 24: /* cond ::= cond AND cond */
-#line 170 "grammar.y"
-{ yylhsminor.yy46 = New_AST_ConditionNode(yymsp[-2].minor.yy46, AND, yymsp[0].minor.yy46); }
-#line 1130 "grammar.c"
-  yymsp[-2].minor.yy46 = yylhsminor.yy46;
-        break;
-      case 25: /* cond ::= cond OR cond */
-#line 171 "grammar.y"
-{ yylhsminor.yy46 = New_AST_ConditionNode(yymsp[-2].minor.yy46, OR, yymsp[0].minor.yy46); }
-#line 1136 "grammar.c"
-  yymsp[-2].minor.yy46 = yylhsminor.yy46;
-        break;
-      case 26: /* op ::= EQ */
-#line 175 "grammar.y"
-{ yymsp[0].minor.yy110 = EQ; }
-#line 1142 "grammar.c"
-        break;
-      case 27: /* op ::= GT */
-#line 176 "grammar.y"
-{ yymsp[0].minor.yy110 = GT; }
-#line 1147 "grammar.c"
-        break;
-      case 28: /* op ::= LT */
-#line 177 "grammar.y"
-{ yymsp[0].minor.yy110 = LT; }
-#line 1152 "grammar.c"
-        break;
-      case 29: /* op ::= LE */
-#line 178 "grammar.y"
-{ yymsp[0].minor.yy110 = LE; }
-#line 1157 "grammar.c"
+      case 29: /* cond ::= STRING DOT STRING op STRING DOT STRING */
+#line 225 "grammar.y"
+{ yylhsminor.yy2 = New_AST_VaryingPredicateNode(yymsp[-6].minor.yy0.strval, yymsp[-4].minor.yy0.strval, yymsp[-3].minor.yy92, yymsp[-2].minor.yy0.strval, yymsp[0].minor.yy0.strval); }
+#line 1222 "grammar.c"
+  yymsp[-6].minor.yy2 = yylhsminor.yy2;
         break;
-      case 30: /* op ::= GE */
-#line 179 "grammar.y"
-{ yymsp[0].minor.yy110 = GE; }
-#line 1162 "grammar.c"
-        break;
-      case 31: /* op ::= NE */
-#line 180 "grammar.y"
-{ yymsp[0].minor.yy110 = NE; }
-#line 1167 "grammar.c"
-        break;
-      case 32: /* value ::= INTEGER */
-#line 186 "grammar.y"
-{  yylhsminor.yy18 = SI_DoubleVal(yymsp[0].minor.yy0.intval); }
-#line 1172 "grammar.c"
-  yymsp[0].minor.yy18 = yylhsminor.yy18;
-        break;
-      case 33: /* value ::= STRING */
-#line 187 "grammar.y"
-{  yylhsminor.yy18 = SI_StringValC(strdup(yymsp[0].minor.yy0.strval)); }
-#line 1178 "grammar.c"
-  yymsp[0].minor.yy18 = yylhsminor.yy18;
-        break;
-      case 34: /* value ::= FLOAT */
-#line 188 "grammar.y"
-{  yylhsminor.yy18 = SI_DoubleVal(yymsp[0].minor.yy0.dval); }
-#line 1184 "grammar.c"
-  yymsp[0].minor.yy18 = yylhsminor.yy18;
-        break;
-      case 35: /* value ::= TRUE */
-#line 189 "grammar.y"
-{ yymsp[0].minor.yy18 = SI_BoolVal(1); }
-#line 1190 "grammar.c"
-        break;
-      case 36: /* value ::= FALSE */
-#line 190 "grammar.y"
-{ yymsp[0].minor.yy18 = SI_BoolVal(0); }
-#line 1195 "grammar.c"
-        break;
-      case 37: /* returnClause ::= RETURN returnElements */
-#line 194 "grammar.y"
+      case 30: /* cond ::= STRING DOT STRING op value */
+#line 226 "grammar.y"
+{ yylhsminor.yy2 = New_AST_ConstantPredicateNode(yymsp[-4].minor.yy0.strval, yymsp[-2].minor.yy0.strval, yymsp[-1].minor.yy92, yymsp[0].minor.yy102); }
+#line 1228 "grammar.c"
+  yymsp[-4].minor.yy2 = yylhsminor.yy2;
+        break;
+      case 31: /* cond ::= STRING DOT STRING op PARAMETER */
+#line 227 "grammar.y"
+{ yylhsminor.yy2 = New_AST_ParameterPredicateNode(yymsp[-4].minor.yy0.strval, yymsp[-2].minor.yy0.strval, yymsp[-1].minor.yy92, yymsp[0].minor.yy0.strval); }
+#line 1234 "grammar.c"
+  yymsp[-4].minor.yy2 = yylhsminor.yy2;
+        break;
+      case 32: /* cond ::= LEFT_PARENTHESIS cond RIGHT_PARENTHESIS */
+#line 228 "grammar.y"
+{ yymsp[-2].minor.yy2 = yymsp[-1].minor.yy2; }
+#line 1240 "grammar.c"
+        break;
+      case 33: /* cond ::= cond AND cond */
+#line 229 "grammar.y"
+{ yylhsminor.yy2 = New_AST_ConditionNode(yymsp[-2].minor.yy2, AND, yymsp[0].minor.yy2); }
+#line 1245 "grammar.c"
+  yymsp[-2].minor.yy2 = yylhsminor.yy2;
+        break;
+      case 34: /* cond ::= cond OR cond */
+#line 230 "grammar.y"
+{ yylhsminor.yy2 = New_AST_ConditionNode(yymsp[-2].minor.yy2, OR, yymsp[0].minor.yy2); }
+#line 1251 "grammar.c"
+  yymsp[-2].minor.yy2 = yylhsminor.yy2;
+        break;
+      case 35: /* op ::= EQ */
+#line 234 "grammar.y"
+{ yymsp[0].minor.yy92 = EQ; }
+#line 1257 "grammar.c"
+        break;
+      case 36: /* op ::= GT */
+#line 235 "grammar.y"
+{ yymsp[0].minor.yy92 = GT; }
+#line 1262 "grammar.c"
+        break;
+      case 37: /* op ::= LT */
+#line 236 "grammar.y"
+{ yymsp[0].minor.yy92 = LT; }
+#line 1267 "grammar.c"
+        break;
+      case 38: /* op ::= LE */
+#line 237 "grammar.y"
+{ yymsp[0].minor.yy92 = LE; }
+#line 1272 "grammar.c"
+        break;
+      case 39: /* op ::= GE */
+#line 238 "grammar.y"
+{ yymsp[0].minor.yy92 = GE; }
+#line 1277 "grammar.c"
+        break;
+      case 40: /* op ::= NE */
+#line 239 "grammar.y"
+{ yymsp[0].minor.yy92 = NE; }
+#line 1282 "grammar.c"
+        break;
+      case 41: /* value ::= INTEGER */
+#line 245 "grammar.y"
+{  yylhsminor.yy102 = SI_LongVal(yymsp[0].minor.yy0.intval); }
+#line 1287 "grammar.c"
+  yymsp[0].minor.yy102 = yylhsminor.yy102;
+        break;
+      case 42: /* value ::= STRING */
+#line 246 "grammar.y"
+{  yylhsminor.yy102 = SI_StringValC(strdup(yymsp[0].minor.yy0.strval)); }
+#line 1293 "grammar.c"
+  yymsp[0].minor.yy102 = yylhsminor.yy102;
+        break;
+      case 43: /* value ::= FLOAT */
+#line 247 "grammar.y"
+{  yylhsminor.yy102 = SI_DoubleVal(yymsp[0].minor.yy0.dval); }
+#line 1299 "grammar.c"
+  yymsp[0].minor.yy102 = yylhsminor.yy102;
+        break;
+      case 44: /* value ::= TRUE */
+#line 248 "grammar.y"
+{ yymsp[0].minor.yy102 = SI_BoolVal(1); }
+#line 1305 "grammar.c"
+        break;
+      case 45: /* value ::= FALSE */
+#line 249 "grammar.y"
+{ yymsp[0].minor.yy102 = SI_BoolVal(0); }
+#line 1310 "grammar.c"
+        break;
+      case 46: /* returnClause ::= RETURN returnElements */
+#line 253 "grammar.y"
 {
-	yymsp[-1].minor.yy6 = New_AST_ReturnNode(yymsp[0].minor.yy54, 0);
+	yymsp[-1].minor.yy96 = New_AST_ReturnNode(yymsp[0].minor.yy114, 0);
 }
-#line 1202 "grammar.c"
+#line 1317 "grammar.c"
         break;
-      case 38: /* returnClause ::= RETURN DISTINCT returnElements */
-#line 197 "grammar.y"
+      case 47: /* returnClause ::= RETURN DISTINCT returnElements */
+#line 256 "grammar.y"
 {
-	yymsp[-2].minor.yy6 = New_AST_ReturnNode(yymsp[0].minor.yy54, 1);
+	yymsp[-2].minor.yy96 = New_AST_ReturnNode(yymsp[0].minor.yy114, 1);
 }
-#line 1209 "grammar.c"
+#line 1324 "grammar.c"
         break;
-      case 39: /* returnElements ::= returnElements COMMA returnElement */
-#line 204 "grammar.y"
+      case 48: /* returnElements ::= returnElements COMMA returnElement */
+#line 263 "grammar.y"
 {
-	Vector_Push(yymsp[-2].minor.yy54, yymsp[0].minor.yy7);
-	yylhsminor.yy54 = yymsp[-2].minor.yy54;
+	Vector_Push(yymsp[-2].minor.yy114, yymsp[0].minor.yy58);
+	yylhsminor.yy114 = yymsp[-2].minor.yy114;
 }
-#line 1217 "grammar.c"
-  yymsp[-2].minor.yy54 = yylhsminor.yy54;
+#line 1332 "grammar.c"
+  yymsp[-2].minor.yy114 = yylhsminor.yy114;
         break;
-      case 40: /* returnElements ::= returnElement */
-#line 209 "grammar.y"
+      case 49: /* returnElements ::= returnElement */
+#line 268 "grammar.y"
 {
-	yylhsminor.yy54 = NewVector(AST_ReturnElementNode*, 1);
-	Vector_Push(yylhsminor.yy54, yymsp[0].minor.yy7);
+	yylhsminor.yy114 = NewVector(AST_ReturnElementNode*, 1);
+	Vector_Push(yylhsminor.yy114, yymsp[0].minor.yy58);
 }
-#line 1226 "grammar.c"
-  yymsp[0].minor.yy54 = yylhsminor.yy54;
+#line 1341 "grammar.c"
+  yymsp[0].minor.yy114 = yylhsminor.yy114;
         break;
-      case 41: /* returnElement ::= variable */
-#line 216 "grammar.y"
+      case 50: /* returnElement ::= variable */
+#line 275 "grammar.y"
 {
-	yylhsminor.yy7 = New_AST_ReturnElementNode(N_PROP, yymsp[0].minor.yy94, NULL, NULL);
+	yylhsminor.yy58 = New_AST_ReturnElementNode(N_PROP, yymsp[0].minor.yy52, NULL, NULL);
 }
-#line 1234 "grammar.c"
-  yymsp[0].minor.yy7 = yylhsminor.yy7;
+#line 1349 "grammar.c"
+  yymsp[0].minor.yy58 = yylhsminor.yy58;
         break;
-      case 42: /* returnElement ::= variable AS STRING */
-#line 219 "grammar.y"
+      case 51: /* returnElement ::= variable AS STRING */
+#line 278 "grammar.y"
 {
-	yylhsminor.yy7 = New_AST_ReturnElementNode(N_PROP, yymsp[-2].minor.yy94, NULL, yymsp[0].minor.yy0.strval);
+	yylhsminor.yy58 = New_AST_ReturnElementNode(N_PROP, yymsp[-2].minor.yy52, NULL, yymsp[0].minor.yy0.strval);
 }
-#line 1242 "grammar.c"
-  yymsp[-2].minor.yy7 = yylhsminor.yy7;
+#line 1357 "grammar.c"
+  yymsp[-2].minor.yy58 = yylhsminor.yy58;
         break;
-      case 43: /* returnElement ::= aggFunc */
-#line 222 "grammar.y"
+      case 52: /* returnElement ::= aggFunc */
+#line 281 "grammar.y"
 {
-	yylhsminor.yy7 = yymsp[0].minor.yy7;
+	yylhsminor.yy58 = yymsp[0].minor.yy58;
 }
-#line 1250 "grammar.c"
-  yymsp[0].minor.yy7 = yylhsminor.yy7;
+#line 1365 "grammar.c"
+  yymsp[0].minor.yy58 = yylhsminor.yy58;
         break;
-      case 44: /* returnElement ::= STRING */
-#line 225 "grammar.y"
+      case 53: /* returnElement ::= STRING */
+#line 284 "grammar.y"
 {
-	yylhsminor.yy7 = New_AST_ReturnElementNode(N_NODE, New_AST_Variable(yymsp[0].minor.yy0.strval, NULL), NULL, NULL);
+	yylhsminor.yy58 = New_AST_ReturnElementNode(N_NODE, New_AST_Variable(yymsp[0].minor.yy0.strval, NULL), NULL, NULL);
 }
-#line 1258 "grammar.c"
-  yymsp[0].minor.yy7 = yylhsminor.yy7;
+#line 1373 "grammar.c"
+  yymsp[0].minor.yy58 = yylhsminor.yy58;
         break;
-      case 45: /* variable ::= STRING DOT STRING */
-#line 231 "grammar.y"
+      case 54: /* variable ::= STRING DOT STRING */
+#line 290 "grammar.y"
 {
-	yylhsminor.yy94 = New_AST_Variable(yymsp[-2].minor.yy0.strval, yymsp[0].minor.yy0.strval);
+	yylhsminor.yy52 = New_AST_Variable(yymsp[-2].minor.yy0.strval, yymsp[0].minor.yy0.strval);
 }
-#line 1266 "grammar.c"
-  yymsp[-2].minor.yy94 = yylhsminor.yy94;
+#line 1381 "grammar.c"
+  yymsp[-2].minor.yy52 = yylhsminor.yy52;
         break;
-      case 46: /* aggFunc ::= STRING LEFT_PARENTHESIS variable RIGHT_PARENTHESIS */
-#line 237 "grammar.y"
+      case 55: /* aggFunc ::= STRING LEFT_PARENTHESIS variable RIGHT_PARENTHESIS */
+#line 296 "grammar.y"
 {
-	yylhsminor.yy7 = New_AST_ReturnElementNode(N_AGG_FUNC, yymsp[-1].minor.yy94, yymsp[-3].minor.yy0.strval, NULL);
+	yylhsminor.yy58 = New_AST_ReturnElementNode(N_AGG_FUNC, yymsp[-1].minor.yy52, yymsp[-3].minor.yy0.strval, NULL);
 }
-#line 1274 "grammar.c"
-  yymsp[-3].minor.yy7 = yylhsminor.yy7;
+#line 1389 "grammar.c"
+  yymsp[-3].minor.yy58 = yylhsminor.yy58;
         break;
-      case 47: /* aggFunc ::= STRING LEFT_PARENTHESIS variable RIGHT_PARENTHESIS AS STRING */
-#line 240 "grammar.y"
+      case 56: /* aggFunc ::= STRING LEFT_PARENTHESIS variable RIGHT_PARENTHESIS AS STRING */
+#line 299 "grammar.y"
 {
-	yylhsminor.yy7 = New_AST_ReturnElementNode(N_AGG_FUNC, yymsp[-3].minor.yy94, yymsp[-5].minor.yy0.strval, yymsp[0].minor.yy0.strval);
+	yylhsminor.yy58 = New_AST_ReturnElementNode(N_AGG_FUNC, yymsp[-3].minor.yy52, yymsp[-5].minor.yy0.strval, yymsp[0].minor.yy0.strval);
 }
-#line 1282 "grammar.c"
-  yymsp[-5].minor.yy7 = yylhsminor.yy7;
+#line 1397 "grammar.c"
+  yymsp[-5].minor.yy58 = yylhsminor.yy58;
         break;
-      case 48: /* orderClause ::= */
-#line 246 "grammar.y"
+      case 57: /* aggFunc ::= STRING LEFT_PARENTHESIS STRING RIGHT_PARENTHESIS */
+#line 304 "grammar.y"
 {
-	yymsp[1].minor.yy76 = NULL;
+	yylhsminor.yy58 = New_AST_ReturnElementNode(N_AGG_FUNC, New_AST_Variable(yymsp[-1].minor.yy0.strval, NULL), yymsp[-3].minor.yy0.strval, NULL);
 }
-#line 1290 "grammar.c"
+#line 1405 "grammar.c"
+  yymsp[-3].minor.yy58 = yylhsminor.yy58;
         break;
-      case 49: /* orderClause ::= ORDER BY columnNameList */
-#line 249 "grammar.y"
+      case 58: /* aggFunc ::= STRING LEFT_PARENTHESIS STRING RIGHT_PARENTHESIS AS STRING */
+#line 307 "grammar.y"
+{
+	yylhsminor.yy58 = New_AST_ReturnElementNode(N_AGG_FUNC, New_AST_Variable(yymsp[-3].minor.yy0.strval, NULL), yymsp[-5].minor.yy0.strval, yymsp[0].minor.yy0.strval);
+}
+#line 1413 "grammar.c"
+  yymsp[-5].minor.yy58 = yylhsminor.yy58;
+        break;
+      case 59: /* aggFunc ::= STRING LEFT_PARENTHESIS STAR RIGHT_PARENTHESIS */
+#line 312 "grammar.y"
+{
+	yylhsminor.yy58 = New_AST_ReturnElementNode(N_AGG_FUNC, NULL, yymsp[-3].minor.yy0.strval, NULL);
+}
+#line 1421 "grammar.c"
+  yymsp[-3].minor.yy58 = yylhsminor.yy58;
+        break;
+      case 60: /* aggFunc ::= STRING LEFT_PARENTHESIS STAR RIGHT_PARENTHESIS AS STRING */
+#line 315 "grammar.y"
+{
+	yylhsminor.yy58 = New_AST_ReturnElementNode(N_AGG_FUNC, NULL, yymsp[-5].minor.yy0.strval, yymsp[0].minor.yy0.strval);
+}
+#line 1429 "grammar.c"
+  yymsp[-5].minor.yy58 = yylhsminor.yy58;
+        break;
+      case 61: /* orderClause ::= */
+#line 321 "grammar.y"
+{
+	yymsp[1].minor.yy36 = NULL;
+}
+#line 1437 "grammar.c"
+        break;
+      case 62: /* orderClause ::= ORDER BY columnNameList */
+#line 324 "grammar.y"
 {
-	yymsp[-2].minor.yy76 = New_AST_OrderNode(yymsp[0].minor.yy54, ORDER_DIR_ASC);
+	yymsp[-2].minor.yy36 = New_AST_OrderNode(yymsp[0].minor.yy114, ORDER_DIR_ASC);
 }
-#line 1297 "grammar.c"
+#line 1444 "grammar.c"
         break;
-      case 50: /* orderClause ::= ORDER BY columnNameList ASC */
-#line 252 "grammar.y"
+      case 63: /* orderClause ::= ORDER BY columnNameList ASC */
+#line 327 "grammar.y"
 {
-	yymsp[-3].minor.yy76 = New_AST_OrderNode(yymsp[-1].minor.yy54, ORDER_DIR_ASC);
+	yymsp[-3].minor.yy36 = New_AST_OrderNode(yymsp[-1].minor.yy114, ORDER_DIR_ASC);
 }
-#line 1304 "grammar.c"
+#line 1451 "grammar.c"
         break;
-      case 51: /* orderClause ::= ORDER BY columnNameList DESC */
-#line 255 "grammar.y"
+      case 64: /* orderClause ::= ORDER BY columnNameList DESC */
+#line 330 "grammar.y"
 {
-	yymsp[-3].minor.yy76 = New_AST_OrderNode(yymsp[-1].minor.yy54, ORDER_DIR_DESC);
+	yymsp[-3].minor.yy36 = New_AST_OrderNode(yymsp[-1].minor.yy114, ORDER_DIR_DESC);
 }
-#line 1311 "grammar.c"
+#line 1458 "grammar.c"
         break;
-      case 52: /* columnNameList ::= columnNameList COMMA columnName */
-#line 260 "grammar.y"
+      case 65: /* columnNameList ::= columnNameList COMMA columnName */
+#line 335 "grammar.y"
 {
-	Vector_Push(yymsp[-2].minor.yy54, yymsp[0].minor.yy98);
-	yylhsminor.yy54 = yymsp[-2].minor.yy54;
+	Vector_Push(yymsp[-2].minor.yy114, yymsp[0].minor.yy38);
+	yylhsminor.yy114 = yymsp[-2].minor.yy114;
 }
-#line 1319 "grammar.c"
-  yymsp[-2].minor.yy54 = yylhsminor.yy54;
+#line 1466 "grammar.c"
+  yymsp[-2].minor.yy114 = yylhsminor.yy114;
         break;
-      case 53: /* columnNameList ::= columnName */
-#line 264 "grammar.y"
+      case 66: /* columnNameList ::= columnName */
+#line 339 "grammar.y"
 {
-	yylhsminor.yy54 = NewVector(AST_ColumnNode*, 1);
-	Vector_Push(yylhsminor.yy54, yymsp[0].minor.yy98);
+	yylhsminor.yy114 = NewVector(AST_ColumnNode*, 1);
+	Vector_Push(yylhsminor.yy114, yymsp[0].minor.yy38);
 }
-#line 1328 "grammar.c"
-  yymsp[0].minor.yy54 = yylhsminor.yy54;
+#line 1475 "grammar.c"
+  yymsp[0].minor.yy114 = yylhsminor.yy114;
         break;
-      case 54: /* columnName ::= variable */
-#line 270 "grammar.y"
+      case 67: /* columnName ::= variable */
+#line 345 "grammar.y"
 {
-	yylhsminor.yy98 = AST_ColumnNodeFromVariable(yymsp[0].minor.yy94);
-	Free_AST_Variable(yymsp[0].minor.yy94);
+	yylhsminor.yy38 = AST_ColumnNodeFromVariable(yymsp[0].minor.yy52);
+	Free_AST_Variable(yymsp[0].minor.yy52);
 }
-#line 1337 "grammar.c"
-  yymsp[0].minor.yy98 = yylhsminor.yy98;
+#line 1484 "grammar.c"
+  yymsp[0].minor.yy38 = yylhsminor.yy38;
         break;
-      case 55: /* columnName ::= STRING */
-#line 274 "grammar.y"
+      case 68: /* columnName ::= STRING */
+#line 349 "grammar.y"
 {
-	yylhsminor.yy98 = AST_ColumnNodeFromAlias(yymsp[0].minor.yy0.strval);
+	yylhsminor.yy38 = AST_ColumnNodeFromAlias(yymsp[0].minor.yy0.strval);
 }
-#line 1345 "grammar.c"
-  yymsp[0].minor.yy98 = yylhsminor.yy98;
+#line 1492 "grammar.c"
+  yymsp[0].minor.yy38 = yylhsminor.yy38;
         break;
-      case 56: /* limitClause ::= */
-#line 280 "grammar.y"
+      case 69: /* limitClause ::= */
+#line 355 "grammar.y"
 {
-	yymsp[1].minor.yy105 = NULL;
+	yymsp[1].minor.yy79 = NULL;
 }
-#line 1353 "grammar.c"
+#line 1500 "grammar.c"
         break;
-      case 57: /* limitClause ::= LIMIT INTEGER */
-#line 283 "grammar.y"
+      case 70: /* limitClause ::= LIMIT INTEGER */
+#line 358 "grammar.y"
 {
-	yymsp[-1].minor.yy105 = New_AST_LimitNode(yymsp[0].minor.yy0.intval);
+	yymsp[-1].minor.yy79 = New_AST_LimitNode(yymsp[0].minor.yy0.intval);
 }
-#line 1360 "grammar.c"
+#line 1507 "grammar.c"
         break;
       default:
         break;
@@ -1422,7 +1569,7 @@ static void yy_syntax_error(
 
 	ctx->ok = 0;
 	ctx->errorMsg = strdup(buf);
-#line 1426 "grammar.c"
+#line 1573 "grammar.c"
 /************ End %syntax_error code ******************************************/
   ParseARG_STORE; /* Suppress warning about unused %extra_argument variable */
 }
@@ -1625,7 +1772,7 @@ void Parse(
 #endif
   return;
 }
-#line 287 "grammar.y"
+#line 362 "grammar.y"
 
 
 	/* Definitions of flex stuff */
@@ -1633,13 +1780,15 @@ void Parse(
 	int             yylex( void );
 	YY_BUFFER_STATE yy_scan_string( const char * );
   	YY_BUFFER_STATE yy_scan_bytes( const char *, size_t );
+	void            yy_delete_buffer( YY_BUFFER_STATE );
   	extern int yylineno;
   	extern char *yytext;
 	extern int yycolumn;
 
 	AST_QueryExpressionNode *Query_Parse(const char *q, size_t len, char **err) {
 		yycolumn = 1;	// Reset lexer's token tracking position
-		yy_scan_bytes(q, len);
+		tokenArena = NewArena(ARENA_DEFAULT_BLOCK_SIZE);
+		YY_BUFFER_STATE buf = yy_scan_bytes(q, len);
   		void* pParser = ParseAlloc(malloc);
   		int t = 0;
 
@@ -1652,9 +1801,13 @@ void Parse(
 			Parse(pParser, 0, tok, &ctx);
   		}
 		ParseFree(pParser, free);
+		yy_delete_buffer(buf);
+		/* AST nodes hold copies of token strings. */
+		Arena_Free(tokenArena);
+		tokenArena = NULL;
 		if (err) {
 			*err = ctx.errorMsg;
 		}
 		return ctx.root;
 	}
-#line 1661 "grammar.c"
+#line 1814 "grammar.c"
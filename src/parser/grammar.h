@@ -6,30 +6,33 @@
 #define LT                               6
 #define LE                               7
 #define MATCH                            8
-#define LEFT_PARENTHESIS                 9
-#define STRING                          10
-#define COLON                           11
-#define RIGHT_PARENTHESIS               12
-#define DASH                            13
-#define RIGHT_ARROW                     14
-#define LEFT_ARROW                      15
-#define LEFT_BRACKET                    16
-#define RIGHT_BRACKET                   17
-#define LEFT_CURLY_BRACKET              18
-#define RIGHT_CURLY_BRACKET             19
-#define COMMA                           20
-#define WHERE                           21
-#define DOT                             22
-#define NE                              23
-#define INTEGER                         24
-#define FLOAT                           25
-#define TRUE                            26
-#define FALSE                           27
-#define RETURN                          28
-#define DISTINCT                        29
-#define AS                              30
-#define ORDER                           31
-#define BY                              32
-#define ASC                             33
-#define DESC                            34
-#define LIMIT                           35
+#define COMMA                            9
+#define LEFT_PARENTHESIS                10
+#define STRING                          11
+#define COLON                           12
+#define RIGHT_PARENTHESIS               13
+#define DASH                            14
+#define RIGHT_ARROW                     15
+#define LEFT_ARROW                      16
+#define LEFT_BRACKET                    17
+#define RIGHT_BRACKET                   18
+#define STAR                            19
+#define INTEGER                         20
+#define DOTDOT                          21
+#define LEFT_CURLY_BRACKET              22
+#define RIGHT_CURLY_BRACKET             23
+#define WHERE                           24
+#define DOT                             25
+#define PARAMETER                       26
+#define NE                              27
+#define FLOAT                           28
+#define TRUE                            29
+#define FALSE                           30
+#define RETURN                          31
+#define DISTINCT                        32
+#define AS                              33
+#define ORDER                           34
+#define BY                              35
+#define ASC                             36
+#define DESC                            37
+#define LIMIT                           38
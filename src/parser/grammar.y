@@ -39,10 +39,28 @@ expr(A) ::= matchClause(B) whereClause(C) returnClause(D) orderClause(E) limitCl
 
 %type matchClause { AST_MatchNode* }
 
-matchClause(A) ::= MATCH chain(B). {
+matchClause(A) ::= MATCH chains(B). {
 	A = New_AST_MatchNode(B);
 }
 
+%type chains {Vector*}
+
+/* Comma separated patterns are kept within a single vector,
+ * a node following a node starts a new pattern. */
+chains(A) ::= chain(B). {
+	A = B;
+}
+
+chains(A) ::= chains(B) COMMA chain(C). {
+	for(int i = 0; i < Vector_Size(C); i++) {
+		AST_GraphEntity *ge;
+		Vector_Get(C, i, &ge);
+		Vector_Push(B, ge);
+	}
+	Vector_Free(C);
+	A = B;
+}
+
 
 %type chain {Vector*}
 
@@ -96,23 +114,64 @@ link(A) ::= LEFT_ARROW edge(B) DASH . {
 
 %type edge {AST_LinkEntity*}
 // Empty edge []
-edge(A) ::= LEFT_BRACKET properties(B) RIGHT_BRACKET . { 
+edge(A) ::= LEFT_BRACKET hops(H) properties(B) RIGHT_BRACKET . { 
 	A = New_AST_LinkEntity(NULL, NULL, B, N_DIR_UNKNOWN);
+	A->length = H;
 }
 
 // Edge with an alias [alias]
-edge(A) ::= LEFT_BRACKET STRING(B) properties(C) RIGHT_BRACKET . { 
+edge(A) ::= LEFT_BRACKET STRING(B) hops(H) properties(C) RIGHT_BRACKET . { 
 	A = New_AST_LinkEntity(B.strval, NULL, C, N_DIR_UNKNOWN);
+	A->length = H;
 }
 
 // Edge with an alias [:label]
-edge(A) ::= LEFT_BRACKET COLON STRING(B) properties(C) RIGHT_BRACKET . { 
+edge(A) ::= LEFT_BRACKET COLON STRING(B) hops(H) properties(C) RIGHT_BRACKET . { 
 	A = New_AST_LinkEntity(NULL, B.strval, C, N_DIR_UNKNOWN);
+	A->length = H;
 }
 
 // Edge with an alias and label [alias:label]
-edge(A) ::= LEFT_BRACKET STRING(B) COLON STRING(C) properties(D) RIGHT_BRACKET . { 
+edge(A) ::= LEFT_BRACKET STRING(B) COLON STRING(C) hops(H) properties(D) RIGHT_BRACKET . { 
 	A = New_AST_LinkEntity(B.strval, C.strval, D, N_DIR_UNKNOWN);
+	A->length = H;
+}
+
+%type hops {AST_LinkLength}
+// Single hop
+hops(A) ::= . {
+	A.minHops = 1;
+	A.maxHops = 1;
+}
+
+// Any number of hops [*]
+hops(A) ::= STAR . {
+	A.minHops = 1;
+	A.maxHops = AST_LINK_UNBOUNDED;
+}
+
+// Exact number of hops [*2]
+hops(A) ::= STAR INTEGER(B) . {
+	A.minHops = B.intval;
+	A.maxHops = B.intval;
+}
+
+// Range of hops [*1..3]
+hops(A) ::= STAR INTEGER(B) DOTDOT INTEGER(C) . {
+	A.minHops = B.intval;
+	A.maxHops = C.intval;
+}
+
+// Up to max hops [*..3]
+hops(A) ::= STAR DOTDOT INTEGER(B) . {
+	A.minHops = 1;
+	A.maxHops = B.intval;
+}
+
+// At least min hops [*2..]
+hops(A) ::= STAR INTEGER(B) DOTDOT . {
+	A.minHops = B.intval;
+	A.maxHops = AST_LINK_UNBOUNDED;
 }
 
 %type properties {Vector*}
@@ -165,6 +224,7 @@ whereClause(A) ::= WHERE cond(B). {
 
 cond(A) ::= STRING(B) DOT STRING(C) op(D) STRING(E) DOT STRING(F). { A = New_AST_VaryingPredicateNode(B.strval, C.strval, D, E.strval, F.strval); }
 cond(A) ::= STRING(B) DOT STRING(C) op(D) value(E). { A = New_AST_ConstantPredicateNode(B.strval, C.strval, D, E); }
+cond(A) ::= STRING(B) DOT STRING(C) op(D) PARAMETER(E). { A = New_AST_ParameterPredicateNode(B.strval, C.strval, D, E.strval); }
 cond(A) ::= LEFT_PARENTHESIS cond(B) RIGHT_PARENTHESIS. { A = B; }
 cond(A) ::= cond(B) AND cond(C). { A = New_AST_ConditionNode(B, AND, C); }
 cond(A) ::= cond(B) OR cond(C). { A = New_AST_ConditionNode(B, OR, C); }
@@ -182,7 +242,7 @@ op(A) ::= NE. { A = NE; }
 %type value {SIValue}
 
 // raw value tokens - int / string / float
-value(A) ::= INTEGER(B). {  A = SI_DoubleVal(B.intval); }
+value(A) ::= INTEGER(B). {  A = SI_LongVal(B.intval); }
 value(A) ::= STRING(B). {  A = SI_StringValC(strdup(B.strval)); }
 value(A) ::= FLOAT(B). {  A = SI_DoubleVal(B.dval); }
 value(A) ::= TRUE. { A = SI_BoolVal(1); }
@@ -240,6 +300,22 @@ aggFunc(A) ::= STRING(B) LEFT_PARENTHESIS variable(C) RIGHT_PARENTHESIS AS STRIN
 	A = New_AST_ReturnElementNode(N_AGG_FUNC, C, B.strval, D.strval);
 }
 
+/* Aggregating entities rather than their properties, e.g. count(n). */
+aggFunc(A) ::= STRING(B) LEFT_PARENTHESIS STRING(C) RIGHT_PARENTHESIS. {
+	A = New_AST_ReturnElementNode(N_AGG_FUNC, New_AST_Variable(C.strval, NULL), B.strval, NULL);
+}
+aggFunc(A) ::= STRING(B) LEFT_PARENTHESIS STRING(C) RIGHT_PARENTHESIS AS STRING(D). {
+	A = New_AST_ReturnElementNode(N_AGG_FUNC, New_AST_Variable(C.strval, NULL), B.strval, D.strval);
+}
+
+/* Aggregating matched rows, e.g. count(*). */
+aggFunc(A) ::= STRING(B) LEFT_PARENTHESIS STAR RIGHT_PARENTHESIS. {
+	A = New_AST_ReturnElementNode(N_AGG_FUNC, NULL, B.strval, NULL);
+}
+aggFunc(A) ::= STRING(B) LEFT_PARENTHESIS STAR RIGHT_PARENTHESIS AS STRING(C). {
+	A = New_AST_ReturnElementNode(N_AGG_FUNC, NULL, B.strval, C.strval);
+}
+
 %type orderClause {AST_OrderNode*}
 
 orderClause(A) ::= . {
@@ -290,13 +366,15 @@ limitClause(A) ::= LIMIT INTEGER(B). {
 	int             yylex( void );
 	YY_BUFFER_STATE yy_scan_string( const char * );
   	YY_BUFFER_STATE yy_scan_bytes( const char *, size_t );
+	void            yy_delete_buffer( YY_BUFFER_STATE );
   	extern int yylineno;
   	extern char *yytext;
 	extern int yycolumn;
 
 	AST_QueryExpressionNode *Query_Parse(const char *q, size_t len, char **err) {
 		yycolumn = 1;	// Reset lexer's token tracking position
-		yy_scan_bytes(q, len);
+		tokenArena = NewArena(ARENA_DEFAULT_BLOCK_SIZE);
+		YY_BUFFER_STATE buf = yy_scan_bytes(q, len);
   		void* pParser = ParseAlloc(malloc);
   		int t = 0;
 
@@ -309,6 +387,10 @@ limitClause(A) ::= LIMIT INTEGER(B). {
 			Parse(pParser, 0, tok, &ctx);
   		}
 		ParseFree(pParser, free);
+		yy_delete_buffer(buf);
+		/* AST nodes hold copies of token strings. */
+		Arena_Free(tokenArena);
+		tokenArena = NULL;
 		if (err) {
 			*err = ctx.errorMsg;
 		}
@@ -1,6 +1,7 @@
 #ifndef __TOKEN_H__
 #define __TOKEN_H__
 #include <stdlib.h>
+#include "../util/arena.h"
 
 typedef struct {
   int64_t intval;
@@ -12,4 +13,8 @@ typedef struct {
 
 extern Token tok;
 
+/* Token strings are allocated from this arena,
+ * which is released once the query is parsed. */
+extern Arena *tokenArena;
+
 #endif
\ No newline at end of file
@@ -19,8 +19,20 @@ Graph* BuildGraph(const AST_MatchNode *matchNode) {
         Vector_Get(matchNode->graphEntities, i, &entity);
 
         if(entity->t == N_ENTITY) {
-            Node *n = NewNode(INVALID_ENTITY_ID, entity->label);
-            Graph_AddNode(g, n, entity->alias);
+            /* A node following a node starts a new pattern. */
+            if(Vector_Size(stack) == 1) {
+                Node *prev;
+                Vector_Pop(stack, &prev);
+            }
+
+            /* Patterns referring to the same alias share its node. */
+            Node *n = Graph_GetNodeByAlias(g, entity->alias);
+            if(n == NULL) {
+                n = NewNode(INVALID_ENTITY_ID, entity->label);
+                Graph_AddNode(g, n, entity->alias);
+            } else if(n->label == NULL && entity->label != NULL) {
+                n->label = strdup(entity->label);
+            }
             Vector_Push(stack, n);
         } else {
             Vector_Push(stack, entity);
@@ -52,8 +64,38 @@ Graph* BuildGraph(const AST_MatchNode *matchNode) {
     return g;
 }
 
+AST_GraphEntity* MatchClause_GetEntity(const AST_MatchNode *matchNode, const char *alias) {
+    if(alias == NULL) return NULL;
+
+    for(int i = 0; i < Vector_Size(matchNode->graphEntities); i++) {
+        AST_GraphEntity *entity;
+        Vector_Get(matchNode->graphEntities, i, &entity);
+        if(entity->alias && strcmp(entity->alias, alias) == 0) return entity;
+    }
+    return NULL;
+}
+
+int* ReturnClause_BindSlots(const AST_ReturnNode *returnNode, const Graph *g) {
+    int *slots = malloc(sizeof(int) * Vector_Size(returnNode->returnElements));
+
+    for(int i = 0; i < Vector_Size(returnNode->returnElements); i++) {
+        AST_ReturnElementNode *retElem;
+        Vector_Get(returnNode->returnElements, i, &retElem);
+        slots[i] = (retElem->variable) ? Graph_GetAliasSlot(g, retElem->variable->alias) : GRAPH_NO_SLOT;
+    }
+
+    return slots;
+}
+
+/* Value aggregated for rows and entities, e.g. count(*). */
+static SIValue _entity_value = {.intval = 1, .type = T_INT32};
+
+/* Value of a missing property, returned by nullable elements. */
+static SIValue _null_value = {.intval = 0, .type = T_NULL};
+
 /* Type specifies the type of return elements to Retrieve. */
-Vector* _ReturnClause_RetrieveValues(const AST_ReturnNode *returnNode, const Graph *g, AST_ReturnElementType type) {
+Vector* _ReturnClause_RetrieveValues(const AST_ReturnNode *returnNode, const Graph *g, const int *slots,
+                                     AST_ReturnElementType type) {
     Vector* returned_props = NewVector(SIValue*, Vector_Size(returnNode->returnElements));
 
     for(int i = 0; i < Vector_Size(returnNode->returnElements); i++) {
@@ -65,8 +107,16 @@ Vector* _ReturnClause_RetrieveValues(const AST_ReturnNode *returnNode, const Gra
             continue;
         }
 
-        GraphEntity *e = Graph_GetEntityByAlias(g, retElem->variable->alias);
-        SIValue *property = GraphEntity_Get_Property(e, retElem->variable->property);
+        SIValue *property = PROPERTY_NOTFOUND;
+        if(retElem->variable == NULL || retElem->variable->property == NULL) {
+            /* Aggregating rows or entities, e.g. count(*), count(n),
+             * any bound entity contributes a single value. */
+            if(retElem->variable == NULL || slots[i] != GRAPH_NO_SLOT) property = &_entity_value;
+        } else if(slots[i] != GRAPH_NO_SLOT) {
+            GraphEntity *e = Graph_GetEntityBySlot(g, slots[i]);
+            property = GraphEntity_Get_Property(e, retElem->variable->property);
+            if(property == PROPERTY_NOTFOUND && retElem->nullable) property = &_null_value;
+        }
         if(property == PROPERTY_NOTFOUND) {
             /* Couldn't find prop for id.
              * TODO: Free returned_props. */
@@ -81,21 +131,21 @@ Vector* _ReturnClause_RetrieveValues(const AST_ReturnNode *returnNode, const Gra
 
 /* Retrieves all request values specified in return clause
  * Returns a vector of SIValue* */
-Vector* ReturnClause_RetrievePropValues(const AST_ReturnNode *returnNode, const Graph *g) {
-    return _ReturnClause_RetrieveValues(returnNode, g, N_PROP);
+Vector* ReturnClause_RetrievePropValues(const AST_ReturnNode *returnNode, const Graph *g, const int *slots) {
+    return _ReturnClause_RetrieveValues(returnNode, g, slots, N_PROP);
 }
 
 /* Retrieves "GROUP BY" values.
  * Returns a vector of SIValue* */
-Vector* ReturnClause_RetrieveGroupKeys(const AST_ReturnNode *returnNode, const Graph *g) {
-    return _ReturnClause_RetrieveValues(returnNode, g, N_PROP);
+Vector* ReturnClause_RetrieveGroupKeys(const AST_ReturnNode *returnNode, const Graph *g, const int *slots) {
+    return _ReturnClause_RetrieveValues(returnNode, g, slots, N_PROP);
 }
 
 /* Retrieves all aggregated properties from graph.
  * e.g. SUM(Person.age)
  * Returns a vector of SIValue* */
-Vector* ReturnClause_RetrieveGroupAggVals(const AST_ReturnNode *returnNode, const Graph *g) {
-    return _ReturnClause_RetrieveValues(returnNode, g, N_AGG_FUNC);
+Vector* ReturnClause_RetrieveGroupAggVals(const AST_ReturnNode *returnNode, const Graph *g, const int *slots) {
+    return _ReturnClause_RetrieveValues(returnNode, g, slots, N_AGG_FUNC);
 }
 
 int ReturnClause_ContainsCollapsedNodes(const AST_ReturnNode *returnNode) {
@@ -147,10 +197,9 @@ Vector* ReturnClause_GetAggFuncs(RedisModuleCtx *ctx, const AST_ReturnNode *retu
     return aggFunctions;
 }
 
-void ReturnClause_ExpandCollapsedNodes(RedisModuleCtx *ctx, AST_QueryExpressionNode *ast, const char *graphName) {
-    /* Assumption, each collapsed node is tagged with a label
-     * TODO: maintain a label schema, this way we won't have
-     * to call HGETALL each time to discover label attributes */
+void ReturnClause_ExpandCollapsedNodes(RedisModuleCtx *ctx, AST_QueryExpressionNode *ast, GraphContext *gc) {
+    /* Collapsed entities expand to every attribute within their label's schema,
+     * entities lacking an attribute report it as NULL. */
     Vector *expandReturnElements = NewVector(AST_ReturnElementNode*, Vector_Size(ast->returnNode->returnElements));
 
     for(int i = 0; i < Vector_Size(ast->returnNode->returnElements); i++) {
@@ -183,21 +232,17 @@ void ReturnClause_ExpandCollapsedNodes(RedisModuleCtx *ctx, AST_QueryExpressionN
         /* Discard collapsed node. */
         Free_AST_ReturnElementNode(ret_elem);
         
-        /* Find an id, for entity. */
-        StoreType store_type = (collapsed_entity->t == N_ENTITY) ? STORE_NODE : STORE_EDGE;
-        Store *s = GetStore(ctx, store_type, graphName, collapsed_entity->label);
-        StoreIterator *it = Store_Search(s, "");
-        char *id;
-        tm_len_t id_len;
-        GraphEntity *entity;
-        StoreIterator_Next(it, &id, &id_len, (void**)&entity);
-        StoreIterator_Free(it);
+        StoreType type = (collapsed_entity->t == N_ENTITY) ? STORE_NODE : STORE_EDGE;
+        Schema *schema = GraphContext_GetSchema(gc, type, collapsed_entity->label);
+        /* No such label within graph, nothing to expand. */
+        if(schema == NULL) continue;
         
-        for(int j = 0; j < entity->prop_count; j++) {
+        for(int j = 0; j < Schema_AttributeCount(schema); j++) {
             /* Create a new return element. */
             AST_Variable *var = New_AST_Variable(collapsed_entity->alias,
-                                                 entity->properties[j].name);
+                                                 Schema_GetAttribute(schema, j));
             AST_ReturnElementNode *retElem = New_AST_ReturnElementNode(N_PROP, var, NULL, NULL);
+            retElem->nullable = 1;
             Vector_Push(expandReturnElements, retElem);
         }
     }
@@ -245,7 +290,11 @@ void inlineProperties(AST_QueryExpressionNode *ast) {
             const char *alias = entity->alias;
             const char *property = key->stringval.str;
 
-            AST_FilterNode *filterNode = New_AST_ConstantPredicateNode(alias, property, EQ, *val);
+            /* Predicate owns its value, property is freed along with entity. */
+            SIValue constVal = *val;
+            if(val->type == T_STRING) constVal = SI_StringVal(SIString_Copy(val->stringval));
+
+            AST_FilterNode *filterNode = New_AST_ConstantPredicateNode(alias, property, EQ, constVal);
             
             /* Create WHERE clause if missing. */
             if(ast->whereNode == NULL) {
@@ -6,20 +6,30 @@
 #include "parser/ast.h"
 #include "redismodule.h"
 #include "hexastore/triplet.h"
+#include "graph_context/graph_context.h"
 
 /* Given AST's MATCH node constructs a graph
  * representing queried entities and the relationships
  * between them. */
 Graph* BuildGraph(const AST_MatchNode *matchNode);
 
-/* Retrieves requested properties from the graph. */
-Vector* ReturnClause_RetrievePropValues(const AST_ReturnNode *returnNode, const Graph *g);
+/* Retrieves MATCH clause entity (node or link) with given alias,
+ * NULL if no such entity exists. */
+AST_GraphEntity* MatchClause_GetEntity(const AST_MatchNode *matchNode, const char *alias);
+
+/* Resolves the alias of each return element to its binding slot within g,
+ * returns an array parallel to the return elements, which the caller should free. */
+int* ReturnClause_BindSlots(const AST_ReturnNode *returnNode, const Graph *g);
+
+/* Retrieves requested properties from the graph,
+ * slots as bound by ReturnClause_BindSlots. */
+Vector* ReturnClause_RetrievePropValues(const AST_ReturnNode *returnNode, const Graph *g, const int *slots);
 
 /* Retrieves all properties which define the group key from given graph. */
-Vector* ReturnClause_RetrieveGroupKeys(const AST_ReturnNode *returnNode, const Graph *g);
+Vector* ReturnClause_RetrieveGroupKeys(const AST_ReturnNode *returnNode, const Graph *g, const int *slots);
 
 /* Retrieves all aggregated properties from graph. */
-Vector* ReturnClause_RetrieveGroupAggVals(const AST_ReturnNode *returnNode, const Graph *g);
+Vector* ReturnClause_RetrieveGroupAggVals(const AST_ReturnNode *returnNode, const Graph *g, const int *slots);
 
 int ReturnClause_ContainsAggregation(const AST_ReturnNode *returnNode);
 
@@ -30,7 +40,7 @@ Vector* ReturnClause_GetAggFuncs(RedisModuleCtx *ctx, const AST_ReturnNode *retu
 /* Checks to see if return clause contains a collapsed node. */
 int ReturnClause_ContainsCollapsedNodes(const AST_ReturnNode *returnNode);
 
-void ReturnClause_ExpandCollapsedNodes(RedisModuleCtx *ctx, AST_QueryExpressionNode *ast, const char *graphName);
+void ReturnClause_ExpandCollapsedNodes(RedisModuleCtx *ctx, AST_QueryExpressionNode *ast, GraphContext *gc);
 
 AST_QueryExpressionNode* ParseQuery(const char *query, size_t qLen, char **errMsg);
 
@@ -1,31 +1,50 @@
 #include "record.h"
 #include "../rmutil/strings.h"
 #include "../query_executor.h"
+#include "../value_cmp.h"
+#include "../aggregate/agg_ctx.h"
 
-Record* NewRecord(size_t len) {
-    Record *r = (Record*)malloc(sizeof(Record));
-    r->values = NewVector(SIValue*, len);
+/* Value of a missing property, returned by nullable elements. */
+static SIValue _null_value = {.intval = 0, .type = T_NULL};
+
+Record* NewRecord(Arena *arena, size_t len) {
+    Record *r = (Record*)Arena_Alloc(arena, sizeof(Record));
+    r->values = (SIValue**)Arena_Calloc(arena, sizeof(SIValue*) * len);
+    r->len = len;
     return r;
 }
 
-Record* Record_FromGraph(RedisModuleCtx *ctx, const AST_QueryExpressionNode *ast, const Graph *g) {
-    Vector* elements = ReturnClause_RetrievePropValues(ast->returnNode, g);
-    if(elements == NULL) {
-        return NULL;
-    }
+Record* Record_FromGraph(Arena *arena, const AST_QueryExpressionNode *ast, const Graph *g,
+                         const int *slots, int *propIdx) {
+    Vector *return_elements = ast->returnNode->returnElements;
+    Record *r = NewRecord(arena, Vector_Size(return_elements));
+    r->len = 0;
+
+    for(int i = 0; i < Vector_Size(return_elements); i++) {
+        AST_ReturnElementNode *ret_elem;
+        Vector_Get(return_elements, i, &ret_elem);
+        if(ret_elem->type != N_PROP) continue;
 
-    Record *r = (Record*)malloc(sizeof(Record));
-    r->values = elements;
+        /* Couldn't find prop for id, record's memory is reclaimed with the arena. */
+        if(slots[i] == GRAPH_NO_SLOT) return NULL;
+        GraphEntity *e = Graph_GetEntityBySlot(g, slots[i]);
+        SIValue *property = GraphEntity_Get_PropertyHint(e, ret_elem->variable->property, &propIdx[i]);
+        if(property == PROPERTY_NOTFOUND) {
+            if(!ret_elem->nullable) return NULL;
+            property = &_null_value;
+        }
+
+        r->values[r->len++] = property;
+    }
 
     return r;
 }
 
 /* Creates a new result-set record from an aggregated group. */
-Record* Record_FromGroup(RedisModuleCtx *ctx, const AST_QueryExpressionNode *ast, const Group *g) {
-    size_t elements_count = Vector_Size(ast->returnNode->returnElements);
-    Record *r = NewRecord(elements_count);
+Record* Record_FromGroup(Arena *arena, const AST_QueryExpressionNode *ast, const Group *g) {
     Vector *return_elements = ast->returnNode->returnElements;
-    
+    Record *r = NewRecord(arena, Vector_Size(return_elements));
+
     int key_idx = 0;
     int agg_idx = 0;
 
@@ -37,13 +56,13 @@ Record* Record_FromGroup(RedisModuleCtx *ctx, const AST_QueryExpressionNode *ast
         if(ret_elem->type == N_AGG_FUNC) {
             AggCtx *agg_ctx;
             Vector_Get(g->aggregationFunctions, agg_idx, &agg_ctx);
-            Vector_Push(r->values, &agg_ctx->result);
+            r->values[i] = &agg_ctx->result;
 
             agg_idx++;
         } else {
             SIValue *key;
             Vector_Get(g->keys, key_idx, &key);
-            Vector_Push(r->values, key);
+            r->values[i] = key;
 
             key_idx++;
         }
@@ -53,7 +72,7 @@ Record* Record_FromGroup(RedisModuleCtx *ctx, const AST_QueryExpressionNode *ast
 }
 
 size_t Record_ToString(const Record *record, char **record_str) {
-    return SIValue_StringConcat(record->values, record_str);
+    return SIValue_StringJoin(record->values, record->len, record_str);
 }
 
 int Records_Compare(const Record *A, const Record *B, int* compareIndices, size_t compareIndicesLen) {
@@ -63,23 +82,14 @@ int Records_Compare(const Record *A, const Record *B, int* compareIndices, size_
     for(int i = 0; i < compareIndicesLen; i++) {
         /* Get element index to comapre. */
         int index = compareIndices[i];
-        Vector_Get(A->values, index, &aValue);
-        Vector_Get(B->values, index, &bValue);
-        
-        /* Asuuming both values are of type double. */
-        if(aValue->doubleval > bValue->doubleval) {
-            return 1;
-        } else if(aValue->doubleval < bValue->doubleval) {
-            return -1;
-        }
+        aValue = A->values[index];
+        bValue = B->values[index];
+
+        /* Numbers of different types are compared as doubles. */
+        int cmp = (aValue->type == T_STRING && bValue->type == T_STRING) ?
+                  cmp_string(aValue, bValue) : cmp_numeric(aValue, bValue);
+        if(cmp != 0) return cmp;
     }
 
     return 0;
 }
-
-/* Frees given record. */
-void Record_Free(Record *r) {
-    if(r == NULL) return;
-    Vector_Free(r->values);
-    free(r);
-}
@@ -6,19 +6,28 @@
 #include "../rmutil/vector.h"
 #include "../grouping/group.h"
 #include "../graph/graph.h"
+#include "../util/arena.h"
 
+/* Records are allocated from the result-set's arena,
+ * and released along with it. */
 typedef struct {
-    Vector* values; // Vector of SIValue*
+    SIValue **values;   /* Record's values. */
+    size_t len;         /* Number of values. */
 } Record;
 
 /* Creates a new record which will hold len elements. */
-Record* NewRecord(size_t len);
+Record* NewRecord(Arena *arena, size_t len);
 
-/* Creates a new record from graph. */
-Record* Record_FromGraph(RedisModuleCtx *ctx, const AST_QueryExpressionNode *ast, const Graph *g);
+/* Creates a new record from graph, return elements are read from
+ * the entities bound to slots, see ReturnClause_BindSlots,
+ * propIdx holds per return element property index hints, updated as
+ * properties are found, returns NULL if graph is missing a requested property.
+ * Values point into entities' properties, nothing is copied. */
+Record* Record_FromGraph(Arena *arena, const AST_QueryExpressionNode *ast, const Graph *g,
+                         const int *slots, int *propIdx);
 
 /* Creates a new record from an aggregated group. */
-Record* Record_FromGroup(RedisModuleCtx *ctx, const AST_QueryExpressionNode *ast, const Group *g);
+Record* Record_FromGroup(Arena *arena, const AST_QueryExpressionNode *ast, const Group *g);
 
 /* Get a string representation of record. */
 size_t Record_ToString(const Record *record, char **record_str);
@@ -27,7 +36,4 @@ size_t Record_ToString(const Record *record, char **record_str);
  * Returns 1 if A >= B, -1 if A <= B, 0 if A = B */
 int Records_Compare(const Record *A, const Record *B, int *compareIndices, size_t compareIndicesLen);
 
-/* Frees given record. */
-void Record_Free(Record *r);
-
 #endif
\ No newline at end of file
@@ -77,6 +77,10 @@ ResultSetHeader* NewResultSetHeader(const AST_QueryExpressionNode *ast) {
 
         if(returnElementNode->type == N_PROP) {
             asprintf(&columnName, "%s.%s", returnElementNode->variable->alias, returnElementNode->variable->property);
+        } else if(returnElementNode->variable == NULL) {
+            asprintf(&columnName, "%s(*)", returnElementNode->func);
+        } else if(returnElementNode->variable->property == NULL) {
+            asprintf(&columnName, "%s(%s)", returnElementNode->func, returnElementNode->variable->alias);
         } else {
            //  returnElementNode->type == N_AGG_FUNC
             asprintf(&columnName, "%s(%s.%s)", returnElementNode->func, returnElementNode->variable->alias, returnElementNode->variable->property);
@@ -178,7 +182,7 @@ ResultSet* NewResultSet(AST_QueryExpressionNode* ast) {
     set->direction =  DIR_ASC;
     set->distinct = ast->returnNode->distinct;
     set->header = NewResultSetHeader(ast);
-    set->records = NewVector(Record*, 0);
+    set->arena = NewArena(ARENA_DEFAULT_BLOCK_SIZE);
 
     if(set->ordered && ast->orderNode->direction == ORDER_DIR_DESC) {
         set->direction = DIR_DESC;
@@ -254,14 +258,12 @@ void _aggregateResultSet(RedisModuleCtx* ctx, ResultSet* set) {
         }
 
         /* Construct response */
-        Record* record = Record_FromGroup(ctx, set->ast, group);
+        Record* record = Record_FromGroup(set->arena, set->ast, group);
         if(ResultSet_AddRecord(set, record) == RESULTSET_FULL) {
             break;
         }
     }
-    
-    FreeGroupCache();
-    InitGroupCache();
+    CacheGroupIterator_Free(iter);
 }
 
 /* TODO: Drop heap, use some sort algo. */
@@ -285,6 +287,7 @@ Record** _sortResultSet(const ResultSet *set, const Vector* records) {
         arrRecords[i] = record;
         i++;
     }
+    heap_free(heap);
     return arrRecords;
 }
 
@@ -324,9 +327,6 @@ void ResultSet_Replay(RedisModuleCtx* ctx, ResultSet* set) {
                 Record* record = heap_poll(set->heap);
                 str_record_len = Record_ToString(record, &str_record);
                 Vector_Push(reversedResultSet, str_record);
-
-                /* Free record here, as it was removed from set heap. */
-                Record_Free(record);
             }
             /* Replay elements in reversed order */
             for(int i = Vector_Size(reversedResultSet)-1; i >= 0; i--) {
@@ -361,28 +361,18 @@ void ResultSet_Replay(RedisModuleCtx* ctx, ResultSet* set) {
 
 void ResultSet_Free(RedisModuleCtx *ctx, ResultSet *set) {
     if(set != NULL) {
-        /* Free each record */
-        for(int i = 0; i < Vector_Size(set->records); i++) {
-            Record *record;
-            Vector_Get(set->records, i, &record);
-            Record_Free(record);
-            record = NULL;
-        }
+        /* Records are released along with the arena. */
         Vector_Free(set->records);
+        if(set->heap != NULL) heap_free(set->heap);
+        if(set->trie != NULL) TrieMap_Free(set->trie, NULL);
 
-        if(set->heap != NULL) {
-            while(heap_count(set->heap) > 0) {
-                Record* record = heap_poll(set->heap);
-                Record_Free(record);
-            }
-            heap_free(set->heap);
-        }
-
-        if(set->trie != NULL) {
-            /* TODO: free trie.
-             * TrieMapNode_Free(set->trie, NULL); */
+        /* Aggregated records point into the group cache. */
+        if(set->aggregated) {
+            FreeGroupCache();
+            InitGroupCache();
         }
 
+        Arena_Free(set->arena);
         ResultSetHeader_Free(set->header);
         free(set);
     }
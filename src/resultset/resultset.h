@@ -5,6 +5,7 @@
 #include "../redismodule.h"
 #include "../rmutil/vector.h"
 #include "../util/heap.h"
+#include "../util/arena.h"
 #include "../util/triemap/triemap.h"
 #include "record.h"
 
@@ -40,6 +41,7 @@ typedef struct {
     int direction;              /* Sort direction ASC/DESC */
     int limit;                  /* Max number of records in result-set */
     int distinct;               /* Rather or not each record is unique */
+    Arena *arena;               /* Holds records, released along with result set */
 } ResultSet;
 
 ResultSet* NewResultSet(AST_QueryExpressionNode* ast);
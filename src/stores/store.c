@@ -6,49 +6,6 @@ Store *_NewStore() {
 	return NewTrieMap();
 }
 
-int Store_ID(char **id, StoreType type, const char *graph, const char *label) {
-    if(label == NULL) {
-        label = "ALL";
-    }
-
-    const char* storeType = NULL;
-
-    switch(type) {
-        case STORE_NODE:
-            storeType = "NODE";
-            break;
-        case STORE_EDGE:
-            storeType = "EDGE";
-            break;
-        default:
-            // Unexpected store type.
-            break;
-    }
-    
-    return asprintf(id, "%s_%s_%s_%s", STORE_PREFIX, graph, storeType, label);
-}
-
-Store *GetStore(RedisModuleCtx *ctx, StoreType type, const char *graph, const char* label) {
-	Store *store = NULL;
-    char *strKey;
-    Store_ID(&strKey, type, graph, label);
-
-    RedisModuleString *rmStoreId = RedisModule_CreateString(ctx, strKey, strlen(strKey));
-    free(strKey);
-    
-	RedisModuleKey *key = RedisModule_OpenKey(ctx, rmStoreId, REDISMODULE_WRITE);
-    RedisModule_FreeString(ctx, rmStoreId);
-
-	if (RedisModule_KeyType(key) == REDISMODULE_KEYTYPE_EMPTY) {
-		store = _NewStore();
-		RedisModule_ModuleTypeSetValue(key, TrieRedisModuleType, store);
-	}
-
-	store = RedisModule_ModuleTypeGetValue(key);
-    RedisModule_CloseKey(key);
-	return store;
-}
-
 int Store_Cardinality(Store *store) {
     return store->cardinality;
 }
@@ -57,19 +14,20 @@ void Store_Insert(Store *store, char *id, void *value) {
     TrieMap_Add(store, id, strlen(id), value, NULL);
 }
 
+/* Stored values are owned by their callers. */
+static void _Store_KeepValue(void *value) {
+}
+
 void Store_Remove(Store *store, char *id) {
-    TrieMap_Delete(store, id, strlen(id), NULL);
+    TrieMap_Delete(store, id, strlen(id), _Store_KeepValue);
 }
 
 StoreIterator *Store_Search(Store *store, const char *prefix) {
-    char* prefix_dup = strdup(prefix);
-	StoreIterator *iter = TrieMap_Iterate(store, prefix_dup, strlen(prefix_dup));
-    return iter;
+	return TrieMap_Iterate(store, prefix, strlen(prefix));
 }
 
 void Store_Search_Iter(Store *store, const char *prefix, StoreIterator *it) {
-    char* prefix_dup = strdup(prefix);
-    TrieMapIterator_Reset(it, store, prefix_dup, strlen(prefix_dup));
+    TrieMapIterator_Reset(it, store, prefix, strlen(prefix));
 }
 
 void *Store_Get(Store *store, char *id) {
@@ -80,6 +38,10 @@ void *Store_Get(Store *store, char *id) {
     return val;
 }
 
+size_t Store_MemUsage(Store *store) {
+    return sizeof(Store) + TrieMap_MemUsage(store);
+}
+
 void Store_Free(Store *store, void (*freeCB)(void *)) {
     TrieMap_Free(store, freeCB);
 }
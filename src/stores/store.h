@@ -4,7 +4,6 @@
 #include "../redismodule.h"
 #include "../util/triemap/triemap.h"
 
-#define STORE_PREFIX "redis_graph_store"
 #define LABEL_DEFAULT_SCORE 0
 
 typedef enum {
@@ -15,21 +14,23 @@ typedef enum {
 typedef TrieMap Store;
 typedef TrieMapIterator StoreIterator;
 
-int Store_ID(char **id, StoreType type, const char *graph, const char *label);
-
-Store *GetStore(RedisModuleCtx *ctx, StoreType type, const char *graph, const char* label);
-
 // Returns the number of items within the store
 int Store_Cardinality(Store *store);
 
 void Store_Insert(Store *store, char *id, void *value);
 
+/* Removes id from store, its value is left intact. */
 void Store_Remove(Store *store, char *id);
 
+/* Iterates over items whose id starts with prefix,
+ * prefix must outlive the returned iterator. */
 StoreIterator *Store_Search(Store *store, const char *prefix);
 
 void *Store_Get(Store *store, char *id);
 
+/* Bytes used by the store's index, stored items are not accounted for. */
+size_t Store_MemUsage(Store *store);
+
 void Store_Free(Store *store, void (*freeCB)(void *));
 
 // Returns the next id from the cursor.
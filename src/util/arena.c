@@ -0,0 +1,76 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "arena.h"
+
+/* Allocations are aligned to the largest scalar type. */
+#define ARENA_ALIGNMENT sizeof(long double)
+#define ARENA_ALIGN(n) (((n) + ARENA_ALIGNMENT - 1) & ~(ARENA_ALIGNMENT - 1))
+
+ArenaBlock *_NewArenaBlock(size_t size) {
+    ArenaBlock *block = malloc(sizeof(ArenaBlock) + size);
+    block->next = NULL;
+    block->size = size;
+    block->used = 0;
+    return block;
+}
+
+Arena *NewArena(size_t blockSize) {
+    Arena *arena = malloc(sizeof(Arena));
+    arena->blockSize = (blockSize > 0) ? ARENA_ALIGN(blockSize) : ARENA_DEFAULT_BLOCK_SIZE;
+    arena->head = _NewArenaBlock(arena->blockSize);
+    return arena;
+}
+
+void *Arena_Alloc(Arena *arena, size_t size) {
+    size = ARENA_ALIGN(size);
+    ArenaBlock *block = arena->head;
+
+    if(block->used + size > block->size) {
+        /* Oversized allocations get a block of their own. */
+        size_t blockSize = (size > arena->blockSize) ? size : arena->blockSize;
+        block = _NewArenaBlock(blockSize);
+        block->next = arena->head;
+        arena->head = block;
+    }
+
+    void *ptr = (char*)block->data + block->used;
+    block->used += size;
+    return ptr;
+}
+
+void *Arena_Calloc(Arena *arena, size_t size) {
+    void *ptr = Arena_Alloc(arena, size);
+    memset(ptr, 0, size);
+    return ptr;
+}
+
+char *Arena_Strdup(Arena *arena, const char *s) {
+    size_t len = strlen(s) + 1;
+    char *dup = Arena_Alloc(arena, len);
+    memcpy(dup, s, len);
+    return dup;
+}
+
+void Arena_Reset(Arena *arena) {
+    /* Keep the last block, for reuse. */
+    ArenaBlock *block = arena->head;
+    while(block->next) {
+        ArenaBlock *next = block->next;
+        free(block);
+        block = next;
+    }
+
+    block->used = 0;
+    arena->head = block;
+}
+
+void Arena_Free(Arena *arena) {
+    ArenaBlock *block = arena->head;
+    while(block) {
+        ArenaBlock *next = block->next;
+        free(block);
+        block = next;
+    }
+    free(arena);
+}
@@ -0,0 +1,44 @@
+#ifndef __ARENA_H__
+#define __ARENA_H__
+
+#include <stddef.h>
+
+#define ARENA_DEFAULT_BLOCK_SIZE 4096
+
+/* ArenaBlock
+ * A single chunk of memory, allocations are carved out of it
+ * one after the other. */
+typedef struct ArenaBlock {
+    struct ArenaBlock *next;    /* Previously filled block. */
+    size_t size;                /* Usable bytes within block. */
+    size_t used;                /* Bytes handed out so far. */
+    long double data[];         /* Storage, aligned to the largest scalar type. */
+} ArenaBlock;
+
+/* Arena
+ * Bump allocator, memory handed out by the arena is never
+ * freed individually, it is released in one shot once the arena
+ * is reset or freed. */
+typedef struct {
+    ArenaBlock *head;       /* Block allocations are served from. */
+    size_t blockSize;       /* Default size of newly allocated blocks. */
+} Arena;
+
+/* Creates a new arena, allocating blocks of blockSize bytes. */
+Arena *NewArena(size_t blockSize);
+
+/* Allocates size bytes from arena. */
+void *Arena_Alloc(Arena *arena, size_t size);
+
+/* Allocates size zeroed bytes from arena. */
+void *Arena_Calloc(Arena *arena, size_t size);
+
+/* Copies s into arena. */
+char *Arena_Strdup(Arena *arena, const char *s);
+
+/* Releases every allocation made from arena, arena can be reused. */
+void Arena_Reset(Arena *arena);
+
+void Arena_Free(Arena *arena);
+
+#endif
@@ -0,0 +1,168 @@
+#include <stdlib.h>
+#include <string.h>
+#include "bitmap.h"
+
+Bitmap *NewBitmap() {
+    return calloc(1, sizeof(Bitmap));
+}
+
+/* Position of the container keyed key, or of where it belongs
+ * if there's no such container, found sets accordingly. */
+static int _Bitmap_FindContainer(const Bitmap *bitmap, uint16_t key, int *found) {
+    int lo = 0;
+    int hi = bitmap->count;
+    while(lo < hi) {
+        int mid = lo + (hi - lo) / 2;
+        if(bitmap->containers[mid].key < key) lo = mid + 1;
+        else hi = mid;
+    }
+    *found = (lo < bitmap->count && bitmap->containers[lo].key == key);
+    return lo;
+}
+
+/* Position of the first array value no smaller than low. */
+static int _Bitmap_ArraySearch(const BitmapContainer *c, uint16_t low) {
+    int lo = 0;
+    int hi = c->card;
+    while(lo < hi) {
+        int mid = lo + (hi - lo) / 2;
+        if(c->array[mid] < low) lo = mid + 1;
+        else hi = mid;
+    }
+    return lo;
+}
+
+/* Converts a full array container into a bitset. */
+static void _Bitmap_ToBitset(BitmapContainer *c) {
+    uint64_t *bitset = calloc(BITMAP_BITSET_WORDS, sizeof(uint64_t));
+    for(int i = 0; i < c->card; i++) {
+        bitset[c->array[i] >> 6] |= 1ULL << (c->array[i] & 63);
+    }
+    free(c->array);
+    c->array = NULL;
+    c->cap = 0;
+    c->bitset = bitset;
+}
+
+static int _BitmapContainer_Add(BitmapContainer *c, uint16_t low) {
+    if(c->bitset) {
+        uint64_t mask = 1ULL << (low & 63);
+        if(c->bitset[low >> 6] & mask) return 0;
+        c->bitset[low >> 6] |= mask;
+        c->card++;
+        return 1;
+    }
+
+    int pos = _Bitmap_ArraySearch(c, low);
+    if(pos < c->card && c->array[pos] == low) return 0;
+
+    if(c->card == BITMAP_ARRAY_MAX) {
+        _Bitmap_ToBitset(c);
+        return _BitmapContainer_Add(c, low);
+    }
+
+    if(c->card == c->cap) {
+        c->cap = (c->cap > 0) ? c->cap * 2 : 4;
+        if(c->cap > BITMAP_ARRAY_MAX) c->cap = BITMAP_ARRAY_MAX;
+        c->array = realloc(c->array, sizeof(uint16_t) * c->cap);
+    }
+    memmove(c->array + pos + 1, c->array + pos, sizeof(uint16_t) * (c->card - pos));
+    c->array[pos] = low;
+    c->card++;
+    return 1;
+}
+
+int Bitmap_Add(Bitmap *bitmap, uint32_t v) {
+    int found;
+    uint16_t key = v >> 16;
+    int pos = _Bitmap_FindContainer(bitmap, key, &found);
+
+    if(!found) {
+        if(bitmap->count == bitmap->cap) {
+            bitmap->cap = (bitmap->cap > 0) ? bitmap->cap * 2 : 4;
+            bitmap->containers = realloc(bitmap->containers, sizeof(BitmapContainer) * bitmap->cap);
+        }
+        memmove(bitmap->containers + pos + 1, bitmap->containers + pos,
+                sizeof(BitmapContainer) * (bitmap->count - pos));
+        memset(&bitmap->containers[pos], 0, sizeof(BitmapContainer));
+        bitmap->containers[pos].key = key;
+        bitmap->count++;
+    }
+
+    int added = _BitmapContainer_Add(&bitmap->containers[pos], v & 0xFFFF);
+    bitmap->card += added;
+    return added;
+}
+
+int Bitmap_Contains(const Bitmap *bitmap, uint32_t v) {
+    int found;
+    int pos = _Bitmap_FindContainer(bitmap, v >> 16, &found);
+    if(!found) return 0;
+
+    const BitmapContainer *c = &bitmap->containers[pos];
+    uint16_t low = v & 0xFFFF;
+    if(c->bitset) return (c->bitset[low >> 6] >> (low & 63)) & 1;
+
+    int i = _Bitmap_ArraySearch(c, low);
+    return i < c->card && c->array[i] == low;
+}
+
+uint64_t Bitmap_Cardinality(const Bitmap *bitmap) {
+    return bitmap->card;
+}
+
+size_t Bitmap_MemUsage(const Bitmap *bitmap) {
+    size_t size = sizeof(Bitmap) + sizeof(BitmapContainer) * bitmap->cap;
+    for(int i = 0; i < bitmap->count; i++) {
+        const BitmapContainer *c = &bitmap->containers[i];
+        if(c->bitset) size += sizeof(uint64_t) * BITMAP_BITSET_WORDS;
+        else size += sizeof(uint16_t) * c->cap;
+    }
+    return size;
+}
+
+void Bitmap_Free(Bitmap *bitmap) {
+    if(bitmap == NULL) return;
+    for(int i = 0; i < bitmap->count; i++) {
+        free(bitmap->containers[i].array);
+        free(bitmap->containers[i].bitset);
+    }
+    free(bitmap->containers);
+    free(bitmap);
+}
+
+void Bitmap_Iterate(const Bitmap *bitmap, BitmapIterator *it) {
+    it->bitmap = bitmap;
+    it->container = 0;
+    it->pos = 0;
+}
+
+int BitmapIterator_Next(BitmapIterator *it, uint32_t *v) {
+    while(it->container < it->bitmap->count) {
+        const BitmapContainer *c = &it->bitmap->containers[it->container];
+        uint32_t high = (uint32_t)c->key << 16;
+
+        if(c->array) {
+            if(it->pos < c->card) {
+                *v = high | c->array[it->pos++];
+                return 1;
+            }
+        } else if(c->bitset) {
+            /* Skip to the next set bit, a word at a time. */
+            while(it->pos < 65536) {
+                uint64_t word = c->bitset[it->pos >> 6] >> (it->pos & 63);
+                if(word == 0) {
+                    it->pos = ((it->pos >> 6) + 1) << 6;
+                    continue;
+                }
+                it->pos += __builtin_ctzll(word);
+                *v = high | it->pos++;
+                return 1;
+            }
+        }
+
+        it->container++;
+        it->pos = 0;
+    }
+    return 0;
+}
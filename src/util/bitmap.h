@@ -0,0 +1,58 @@
+#ifndef __BITMAP_H__
+#define __BITMAP_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* Containers holding more than this many values switch to a bitset. */
+#define BITMAP_ARRAY_MAX 4096
+#define BITMAP_BITSET_WORDS (65536 / 64)
+
+/* BitmapContainer
+ * Values sharing their upper 16 bits, stored either as a sorted
+ * array of their lower 16 bits while sparse, or as a bitset once dense. */
+typedef struct {
+    uint16_t key;           /* Upper 16 bits shared by container's values. */
+    int card;               /* Number of values within container. */
+    int cap;                /* Array capacity, 0 for bitsets. */
+    uint16_t *array;        /* Sorted lower bits, NULL for bitsets. */
+    uint64_t *bitset;       /* BITMAP_BITSET_WORDS words, NULL for arrays. */
+} BitmapContainer;
+
+/* Bitmap
+ * Compressed set of 32 bit values, containers are sorted by key. */
+typedef struct {
+    BitmapContainer *containers;
+    int count;
+    int cap;
+    uint64_t card;          /* Number of values within bitmap. */
+} Bitmap;
+
+/* Iterates over bitmap's values in ascending order. */
+typedef struct {
+    const Bitmap *bitmap;
+    int container;          /* Current container. */
+    int pos;                /* Array position or bit within current container. */
+} BitmapIterator;
+
+Bitmap *NewBitmap();
+
+/* Adds v to bitmap, returns 1 if v wasn't already within bitmap. */
+int Bitmap_Add(Bitmap *bitmap, uint32_t v);
+
+int Bitmap_Contains(const Bitmap *bitmap, uint32_t v);
+
+uint64_t Bitmap_Cardinality(const Bitmap *bitmap);
+
+/* Bytes used by bitmap. */
+size_t Bitmap_MemUsage(const Bitmap *bitmap);
+
+void Bitmap_Free(Bitmap *bitmap);
+
+/* Positions it at bitmap's smallest value. */
+void Bitmap_Iterate(const Bitmap *bitmap, BitmapIterator *it);
+
+/* Sets v to the next value, returns 0 once bitmap is depleted. */
+int BitmapIterator_Next(BitmapIterator *it, uint32_t *v);
+
+#endif
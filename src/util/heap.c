@@ -18,6 +18,8 @@ struct heap_s
     /**  user data */
     const void *udata;
     int (*cmp) (const void *, const void *, const void *);
+    /* notified whenever an item is placed at a new index */
+    void (*idx_cb) (void *, unsigned int);
     void * array[];
 };
 
@@ -53,6 +55,7 @@ void heap_init(heap_t* h,
     h->udata = udata;
     h->size = size;
     h->count = 0;
+    h->idx_cb = NULL;
 }
 
 heap_t *heap_new(int (*cmp) (const void *,
@@ -87,12 +90,19 @@ static heap_t* __ensurecapacity(heap_t * h)
     return realloc(h, heap_sizeof(h->size));
 }
 
+static void __set(heap_t * h, const unsigned int idx, void *item)
+{
+    h->array[idx] = item;
+    if (h->idx_cb)
+        h->idx_cb(item, idx);
+}
+
 static void __swap(heap_t * h, const int i1, const int i2)
 {
     void *tmp = h->array[i1];
 
-    h->array[i1] = h->array[i2];
-    h->array[i2] = tmp;
+    __set(h, i1, h->array[i2]);
+    __set(h, i2, tmp);
 }
 
 static int __pushup(heap_t * h, unsigned int idx)
@@ -151,7 +161,7 @@ static void __pushdown(heap_t * h, unsigned int idx)
 
 static void __heap_offerx(heap_t * h, void *item)
 {
-    h->array[h->count] = item;
+    __set(h, h->count, item);
 
     /* ensure heap properties */
     __pushup(h, h->count++);
@@ -181,8 +191,9 @@ void *heap_poll(heap_t * h)
 
     void *item = h->array[0];
 
-    h->array[0] = h->array[h->count - 1];
     h->count--;
+    if (h->count > 0)
+        __set(h, 0, h->array[h->count]);
 
     if (h->count > 1)
         __pushdown(h, 0);
@@ -225,7 +236,7 @@ void *heap_remove_item(heap_t * h, const void *item)
 
     /* swap the item we found with the last item on the heap */
     void *ret_item = h->array[idx];
-    h->array[idx] = h->array[h->count - 1];
+    __set(h, idx, h->array[h->count - 1]);
     h->array[h->count - 1] = NULL;
 
     h->count -= 1;
@@ -241,6 +252,22 @@ int heap_contains_item(const heap_t * h, const void *item)
     return __item_get_idx(h, item) != -1;
 }
 
+void heap_set_index_cb(heap_t * h, void (*idx_cb) (void *, unsigned int))
+{
+    h->idx_cb = idx_cb;
+}
+
+void heap_update_idx(heap_t * h, unsigned int idx)
+{
+    if (idx >= h->count)
+        return;
+
+    if (0 < idx && h->cmp(h->array[idx], h->array[__parent(idx)], h->udata) > 0)
+        __pushup(h, idx);
+    else
+        __pushdown(h, idx);
+}
+
 int heap_count(const heap_t * h)
 {
     return h->count;
@@ -104,4 +104,23 @@ void *heap_remove_item(heap_t * hp, const void *item);
  * @return 1 if the heap contains this item; otherwise 0 */
 int heap_contains_item(const heap_t * hp, const void *item);
 
+/**
+ * Track item positions
+ *
+ * idx_cb is called with an item and its new index whenever the item
+ * is placed on the heap's array, allowing callers to locate items
+ * in constant time, e.g. for heap_update_idx.
+ *
+ * @param[in] idx_cb Callback, NULL to stop tracking */
+void heap_set_index_cb(heap_t * hp,
+                       void (*idx_cb) (void *item, unsigned int idx));
+
+/**
+ * Restore heap order after the priority of the item at idx changed
+ *
+ * Used to implement decrease-key.
+ *
+ * @param[in] idx The index of the modified item */
+void heap_update_idx(heap_t * hp, unsigned int idx);
+
 #endif /* HEAP_H */
\ No newline at end of file
@@ -0,0 +1,69 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "slab.h"
+
+/* Objects are aligned to the largest scalar type,
+ * and are large enough to link released objects. */
+#define SLAB_ALIGNMENT sizeof(long double)
+#define SLAB_ALIGN(n) (((n) + SLAB_ALIGNMENT - 1) & ~(SLAB_ALIGNMENT - 1))
+
+Slab *NewSlab(size_t objSize, size_t chunkObjects) {
+    Slab *slab = malloc(sizeof(Slab));
+    if(objSize < sizeof(void*)) objSize = sizeof(void*);
+    slab->objSize = SLAB_ALIGN(objSize);
+    slab->chunkObjects = (chunkObjects > 0) ? chunkObjects : SLAB_DEFAULT_CHUNK_OBJECTS;
+    slab->head = NULL;
+    /* No chunk yet, first allocation adds one. */
+    slab->used = slab->chunkObjects;
+    slab->freeList = NULL;
+    slab->chunks = 0;
+    slab->live = 0;
+    return slab;
+}
+
+void *Slab_Alloc(Slab *slab) {
+    slab->live++;
+
+    if(slab->freeList) {
+        void *obj = slab->freeList;
+        slab->freeList = *(void**)obj;
+        return obj;
+    }
+
+    if(slab->used == slab->chunkObjects) {
+        SlabChunk *chunk = malloc(sizeof(SlabChunk) + slab->objSize * slab->chunkObjects);
+        chunk->next = slab->head;
+        slab->head = chunk;
+        slab->used = 0;
+        slab->chunks++;
+    }
+
+    return (char*)slab->head->data + slab->objSize * slab->used++;
+}
+
+void *Slab_Calloc(Slab *slab) {
+    void *obj = Slab_Alloc(slab);
+    memset(obj, 0, slab->objSize);
+    return obj;
+}
+
+void Slab_Release(Slab *slab, void *obj) {
+    *(void**)obj = slab->freeList;
+    slab->freeList = obj;
+    slab->live--;
+}
+
+size_t Slab_MemUsage(const Slab *slab) {
+    return sizeof(Slab) + slab->chunks * (sizeof(SlabChunk) + slab->objSize * slab->chunkObjects);
+}
+
+void Slab_Free(Slab *slab) {
+    SlabChunk *chunk = slab->head;
+    while(chunk) {
+        SlabChunk *next = chunk->next;
+        free(chunk);
+        chunk = next;
+    }
+    free(slab);
+}
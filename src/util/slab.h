@@ -0,0 +1,49 @@
+#ifndef __SLAB_H__
+#define __SLAB_H__
+
+#include <stddef.h>
+
+#define SLAB_DEFAULT_CHUNK_OBJECTS 1024
+
+/* SlabChunk
+ * Storage for a fixed number of objects, handed out in order. */
+typedef struct SlabChunk {
+    struct SlabChunk *next;     /* Previously filled chunk. */
+    long double data[];         /* Storage, aligned to the largest scalar type. */
+} SlabChunk;
+
+/* Slab
+ * Pool of equally sized objects, carved out of large chunks
+ * rather than allocated one by one. Released objects are kept
+ * on a free list and handed out again ahead of fresh ones,
+ * chunks are returned to the system once the slab is freed. */
+typedef struct {
+    size_t objSize;         /* Object size, aligned. */
+    size_t chunkObjects;    /* Number of objects per chunk. */
+    SlabChunk *head;        /* Chunk fresh objects are served from. */
+    size_t used;            /* Objects handed out of head chunk. */
+    void *freeList;         /* Released objects, linked through their first word. */
+    size_t chunks;          /* Number of chunks. */
+    size_t live;            /* Objects currently handed out. */
+} Slab;
+
+/* Creates a new slab of objSize bytes objects, allocating
+ * chunkObjects objects at a time. */
+Slab *NewSlab(size_t objSize, size_t chunkObjects);
+
+/* Allocates an object. */
+void *Slab_Alloc(Slab *slab);
+
+/* Allocates a zeroed object. */
+void *Slab_Calloc(Slab *slab);
+
+/* Returns obj to slab, obj must have been allocated from slab. */
+void Slab_Release(Slab *slab, void *obj);
+
+/* Bytes held by slab's chunks, including unused objects. */
+size_t Slab_MemUsage(const Slab *slab);
+
+/* Frees slab along with every object allocated from it. */
+void Slab_Free(Slab *slab);
+
+#endif
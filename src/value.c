@@ -369,6 +369,7 @@ int SIValue_ToDouble(SIValue *v, double *d) {
 
 void SIValue_FromString(SIValue *v, char *s, size_t s_len) {
   int numeric = 1;
+  int integral = 1;
   int i;
   char c;
 
@@ -381,25 +382,39 @@ void SIValue_FromString(SIValue *v, char *s, size_t s_len) {
       v->type = T_STRING;
       break;
     }
+    if(c == '.' || (c == '-' && i > 0)) integral = 0;
   }
 
   if(numeric) {
+    /* Integers are kept as such, parsing them as doubles loses precision. */
+    v->type = (integral && s_len > 0) ? T_INT64 : T_DOUBLE;
+  }
+
+  /* Integers are range checked here rather than through _parseInt,
+   * which reports failures on stderr; out of range integers fall back
+   * to doubles. */
+  if(v->type == T_INT64) {
+    errno = 0;
+    char *endptr = s + s_len;
+    long long int val = strtoll(s, &endptr, 10);
+    if(errno == 0 && endptr != s) {
+      v->longval = val;
+      return;
+    }
     v->type = T_DOUBLE;
   }
 
   SI_ParseValue(v, s, s_len);
 }
 
-size_t SIValue_StringConcat(const Vector* strings, char** concat) {
+size_t SIValue_StringJoin(SIValue **values, size_t count, char **concat) {
   int i;
   size_t length = 0;
   size_t offset = 0;
-  int elem_count = Vector_Size(strings);
 
   /* Compute length. */
-  for(i = 0; i < elem_count; i++) {
-    SIValue* element;
-    Vector_Get(strings, i, &element);
+  for(i = 0; i < count; i++) {
+    SIValue* element = values[i];
 
     /* Element string representation bytes size, strings are 
      * srounded by double quotes,
@@ -409,19 +424,20 @@ size_t SIValue_StringConcat(const Vector* strings, char** concat) {
   }
 
   /* Account for delimiters and NULL terminating byte. */
-  length += elem_count + 1;
+  length += count + 1;
   *concat = calloc(length, sizeof(char));
 
-  for(i = 0; i < elem_count; i++) {
-      SIValue* element;
-      Vector_Get(strings, i, &element);
-
-      offset += SIValue_ToString(*element, (*concat) + offset, length - offset);
+  for(i = 0; i < count; i++) {
+      offset += SIValue_ToString(*values[i], (*concat) + offset, length - offset);
       (*concat)[offset++] = ',';
   }
-  /* Backtrack once. */
-  offset--;
+  /* Backtrack once, no delimiter was written for an empty list. */
+  if(count > 0) offset--;
   /* Discard last delimiter. */
   (*concat)[offset] = 0;
   return offset;
 }
+
+size_t SIValue_StringConcat(const Vector* strings, char** concat) {
+  return SIValue_StringJoin((SIValue**)strings->data, Vector_Size(strings), concat);
+}
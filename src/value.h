@@ -2,6 +2,7 @@
 #define __SECONDARY_VALUE_H__
 #include <stdlib.h>
 #include <string.h>
+#include <stdint.h>
 #include "./rmutil/vector.h"
 
 typedef char *SIId;
@@ -24,17 +25,21 @@ typedef enum {
 
 } SIType;
 
-// binary safe strings
-typedef struct {
+// binary safe strings, packed such that a string value fits in 16 bytes
+typedef struct __attribute__((packed)) {
   char *str;
-  size_t len;
+  uint32_t len;
 } SIString;
 
 SIString SI_WrapString(const char *s);
 SIString SIString_Copy(SIString s);
 
-typedef struct {
-  union {
+/* SIValue
+ * 16 bytes, the type tag and dictionary code are kept within the 4 bytes
+ * following a string's length, rather than padded past the union.
+ * Numeric values are stored natively. */
+typedef struct __attribute__((aligned(8))) {
+  union __attribute__((packed)) {
     int32_t intval;
     int64_t longval;
     u_int64_t uintval;
@@ -43,7 +48,8 @@ typedef struct {
     int boolval;
     SIString stringval;
   };
-  SIType type;
+  SIType type : 16;
+  uint16_t code;  /* Dictionary code of a string, 0 if it has none. */
 } SIValue;
 
 typedef struct {
@@ -97,9 +103,13 @@ int SIValue_ToString(SIValue v, char *buf, size_t len);
 
 int SIValue_ToDouble(SIValue *v, double *d);
 
-/* Try to parse a value by string. */
+/* Try to parse a value by string,
+ * integers are parsed as T_INT64, other numbers as T_DOUBLE. */
 void SIValue_FromString(SIValue *v, char *s, size_t s_len);
 
+/* Concats count values as a comma seperated string. */
+size_t SIValue_StringJoin(SIValue **values, size_t count, char **concat);
+
 /* Concats strings as a comma seperated string. */
 size_t SIValue_StringConcat(const Vector* strings, char** concat);
 
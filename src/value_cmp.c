@@ -32,3 +32,18 @@ int cmp_string(void *p1, void *p2) {
   // if they are not equal, or equal and same length - return the original cmp
   return cmp;
 }
+
+int cmp_numeric(void *p1, void *p2) {
+  SIValue *v1 = p1, *v2 = p2;
+  if (SIValue_IsInf(v1) || SIValue_IsNegativeInf(v2))
+    return 1;
+  if (SIValue_IsInf(v2) || SIValue_IsNegativeInf(v1))
+    return -1;
+
+  double d1, d2;
+  int n1 = SIValue_ToDouble(v1, &d1);
+  int n2 = SIValue_ToDouble(v2, &d2);
+  if (!n1 || !n2)
+    return n1 - n2;
+  return (d1 < d2 ? -1 : (d1 > d2 ? 1 : 0));
+}
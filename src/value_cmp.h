@@ -26,4 +26,8 @@ GENERIC_CMP_FUNC_DECL(cmp_long);
 GENERIC_CMP_FUNC_DECL(cmp_double);
 GENERIC_CMP_FUNC_DECL(cmp_uint);
 
+/* Compares numbers of any type as doubles,
+ * values which aren't numbers order first. */
+GENERIC_CMP_FUNC_DECL(cmp_numeric);
+
 #endif
@@ -0,0 +1,52 @@
+#ifndef TEST_GRAPH_FIXTURE_H_
+#define TEST_GRAPH_FIXTURE_H_
+
+#include <stdarg.h>
+#include <string.h>
+#include "../src/value.h"
+#include "../src/graph/node.h"
+#include "../src/graph/edge.h"
+#include "../src/graph_context/graph_context.h"
+
+/* Builds test graphs through the graph context,
+ * the same way GRAPH.ADDNODE and GRAPH.ADDEDGE do. */
+
+static long int _next_id = 1;
+
+/* Adds a node labeled label (unlabeled if NULL) carrying prop_count properties,
+ * passed as key, SIValue pairs, e.g.
+ * _AddNode(gc, "person", 2, "name", SI_StringValC("a"), "rank", SI_DoubleVal(1));
+ * string values are copied. */
+static Node *_AddNode(GraphContext *gc, const char *label, int prop_count, ...) {
+    Node *n = NewNode(_next_id++, label);
+
+    if(prop_count > 0) {
+        char **keys = malloc(sizeof(char*) * prop_count);
+        SIValue *values = malloc(sizeof(SIValue) * prop_count);
+
+        va_list args;
+        va_start(args, prop_count);
+        for(int i = 0; i < prop_count; i++) {
+            keys[i] = strdup(va_arg(args, const char*));
+            values[i] = va_arg(args, SIValue);
+            if(values[i].type == T_STRING) values[i] = SI_StringValC(strdup(values[i].stringval.str));
+        }
+        va_end(args);
+
+        Node_Add_Properties(n, prop_count, keys, values);
+        free(keys);
+        free(values);
+    }
+
+    GraphContext_AddNode(gc, n);
+    return n;
+}
+
+/* Connects src to dest by a new edge of type relation. */
+static Edge *_AddEdge(GraphContext *gc, Node *src, Node *dest, const char *relation) {
+    Edge *e = NewEdge(_next_id++, src, dest, relation);
+    GraphContext_AddEdge(gc, e);
+    return e;
+}
+
+#endif
@@ -0,0 +1,57 @@
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include "assert.h"
+#include "../src/util/arena.h"
+
+void test_arena_alloc() {
+    Arena *arena = NewArena(64);
+
+    /* Allocations are aligned and do not overlap. */
+    char *a = Arena_Alloc(arena, 3);
+    char *b = Arena_Alloc(arena, 5);
+    assert(((uintptr_t)a % sizeof(long double)) == 0);
+    assert(((uintptr_t)b % sizeof(long double)) == 0);
+    assert(b >= a + 3);
+
+    memset(a, 'a', 3);
+    memset(b, 'b', 5);
+    assert(a[2] == 'a' && b[0] == 'b');
+
+    int *zeros = Arena_Calloc(arena, sizeof(int) * 8);
+    for(int i = 0; i < 8; i++) assert(zeros[i] == 0);
+
+    char *s = Arena_Strdup(arena, "Hello");
+    assert(strcmp(s, "Hello") == 0);
+
+    Arena_Free(arena);
+}
+
+void test_arena_grow() {
+    Arena *arena = NewArena(64);
+    ArenaBlock *first = arena->head;
+
+    /* Filling a block links a new one. */
+    for(int i = 0; i < 16; i++) Arena_Alloc(arena, 16);
+    assert(arena->head != first);
+
+    /* Oversized allocations get a block of their own. */
+    char *big = Arena_Alloc(arena, 1024);
+    assert(arena->head->size >= 1024);
+    memset(big, 0, 1024);
+
+    /* Reset keeps the first block only. */
+    Arena_Reset(arena);
+    assert(arena->head == first);
+    assert(arena->head->next == NULL);
+    assert(arena->head->used == 0);
+
+    Arena_Free(arena);
+}
+
+int main(int argc, char **argv) {
+    test_arena_alloc();
+    test_arena_grow();
+    printf("PASS!");
+    return 0;
+}
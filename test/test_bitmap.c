@@ -0,0 +1,68 @@
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include "assert.h"
+#include "../src/util/bitmap.h"
+
+void test_bitmap_add() {
+    Bitmap *bitmap = NewBitmap();
+    assert(Bitmap_Cardinality(bitmap) == 0);
+    assert(!Bitmap_Contains(bitmap, 7));
+
+    /* Values spread across containers, added out of order. */
+    uint32_t values[6] = {70000, 7, 3, 65536, 7, 4000000000u};
+    int added = 0;
+    for(int i = 0; i < 6; i++) added += Bitmap_Add(bitmap, values[i]);
+    assert(added == 5);
+    assert(Bitmap_Cardinality(bitmap) == 5);
+    assert(bitmap->count == 3);
+
+    for(int i = 0; i < 6; i++) assert(Bitmap_Contains(bitmap, values[i]));
+    assert(!Bitmap_Contains(bitmap, 8));
+    assert(!Bitmap_Contains(bitmap, 65537));
+
+    /* Values are iterated in ascending order. */
+    uint32_t expected[5] = {3, 7, 65536, 70000, 4000000000u};
+    uint32_t v;
+    int i = 0;
+    BitmapIterator it;
+    Bitmap_Iterate(bitmap, &it);
+    while(BitmapIterator_Next(&it, &v)) assert(v == expected[i++]);
+    assert(i == 5);
+
+    Bitmap_Free(bitmap);
+}
+
+void test_bitmap_dense() {
+    Bitmap *bitmap = NewBitmap();
+
+    /* Even values, container switches to a bitset once full. */
+    for(uint32_t v = 0; v < 2 * (BITMAP_ARRAY_MAX + 10); v += 2) Bitmap_Add(bitmap, v);
+    assert(Bitmap_Cardinality(bitmap) == BITMAP_ARRAY_MAX + 10);
+    assert(bitmap->containers[0].bitset != NULL);
+    assert(Bitmap_MemUsage(bitmap) >= BITMAP_BITSET_WORDS * sizeof(uint64_t));
+
+    assert(Bitmap_Contains(bitmap, 0));
+    assert(Bitmap_Contains(bitmap, 2 * BITMAP_ARRAY_MAX));
+    assert(!Bitmap_Contains(bitmap, 2 * BITMAP_ARRAY_MAX + 1));
+    assert(!Bitmap_Add(bitmap, 4));
+
+    uint32_t v;
+    uint32_t expected = 0;
+    BitmapIterator it;
+    Bitmap_Iterate(bitmap, &it);
+    while(BitmapIterator_Next(&it, &v)) {
+        assert(v == expected);
+        expected += 2;
+    }
+    assert(expected == 2 * (BITMAP_ARRAY_MAX + 10));
+
+    Bitmap_Free(bitmap);
+}
+
+int main(int argc, char **argv) {
+    test_bitmap_add();
+    test_bitmap_dense();
+    printf("PASS!\n");
+    return 0;
+}
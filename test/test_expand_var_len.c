@@ -0,0 +1,146 @@
+#include <stdio.h>
+#include <string.h>
+#include "assert.h"
+#include "../src/value.h"
+#include "../src/graph/node.h"
+#include "../src/graph/edge.h"
+#include "../src/query_executor.h"
+#include "../src/hexastore/triplet.h"
+#include "../src/grouping/group_cache.h"
+#include "../src/graph_context/graph_context.h"
+#include "../src/execution_plan/execution_plan.h"
+#include "graph_fixture.h"
+
+/* Runs query, concatenating the sorted first column of each record,
+ * e.g. "b,c,d". */
+void _RunQuery(GraphContext *gc, const char *query, char *out) {
+    char *errMsg = NULL;
+    AST_QueryExpressionNode *ast = ParseQuery(query, strlen(query), &errMsg);
+    assert(ast);
+
+    ExecutionPlan *plan = NewExecutionPlan(NULL, gc, ast);
+    ResultSet *set = ExecutionPlan_Execute(plan);
+
+    size_t count = Vector_Size(set->records);
+    char **names = malloc(sizeof(char*) * count);
+    for(int i = 0; i < count; i++) {
+        Record *r;
+        Vector_Get(set->records, i, &r);
+        names[i] = r->values[0]->stringval.str;
+    }
+
+    /* Sort names. */
+    for(int i = 0; i < count; i++) {
+        for(int j = i + 1; j < count; j++) {
+            if(strcmp(names[i], names[j]) > 0) {
+                char *tmp = names[i];
+                names[i] = names[j];
+                names[j] = tmp;
+            }
+        }
+    }
+
+    out[0] = '\0';
+    for(int i = 0; i < count; i++) {
+        if(i > 0) strcat(out, ",");
+        strcat(out, names[i]);
+    }
+
+    free(names);
+    ResultSet_Free(NULL, set);
+    ExecutionPlanFree(plan);
+}
+
+void test_parse_hops() {
+    char *errMsg = NULL;
+    const char *query = "MATCH (a)-[:friend*2..4]->(b)-[*]->(c)-[e*3]->(d)-[*..5]->(f)-[:x*2..]->(g) RETURN a.name";
+    AST_QueryExpressionNode *ast = ParseQuery(query, strlen(query), &errMsg);
+    assert(ast);
+
+    AST_LinkEntity *link;
+    Vector_Get(ast->matchNode->graphEntities, 1, &link);
+    assert(strcmp(link->ge.label, "friend") == 0);
+    assert(link->length.minHops == 2 && link->length.maxHops == 4);
+
+    Vector_Get(ast->matchNode->graphEntities, 3, &link);
+    assert(link->length.minHops == 1 && link->length.maxHops == AST_LINK_UNBOUNDED);
+
+    Vector_Get(ast->matchNode->graphEntities, 5, &link);
+    assert(strcmp(link->ge.alias, "e") == 0);
+    assert(link->length.minHops == 3 && link->length.maxHops == 3);
+
+    Vector_Get(ast->matchNode->graphEntities, 7, &link);
+    assert(link->length.minHops == 1 && link->length.maxHops == 5);
+
+    Vector_Get(ast->matchNode->graphEntities, 9, &link);
+    assert(link->length.minHops == 2 && link->length.maxHops == AST_LINK_UNBOUNDED);
+    Free_AST_QueryExpressionNode(ast);
+
+    /* Single hop links are unaffected. */
+    query = "MATCH (a)-[:friend]->(b) RETURN a.name";
+    ast = ParseQuery(query, strlen(query), &errMsg);
+    Vector_Get(ast->matchNode->graphEntities, 1, &link);
+    assert(AST_LinkEntity_FixedLength(link));
+    Free_AST_QueryExpressionNode(ast);
+}
+
+void test_var_len_expand() {
+    char result[256];
+    GraphContext *gc = NewGraphContext("social");
+
+    /* a -> b -> c -> d -> e, with a shortcut a -> c
+     * and a cycle e -> b. */
+    Node *a = _AddNode(gc, "person", 1, "name", SI_StringValC("a"));
+    Node *b = _AddNode(gc, "person", 1, "name", SI_StringValC("b"));
+    Node *c = _AddNode(gc, "person", 1, "name", SI_StringValC("c"));
+    Node *d = _AddNode(gc, "person", 1, "name", SI_StringValC("d"));
+    Node *e = _AddNode(gc, "person", 1, "name", SI_StringValC("e"));
+    Node *x = _AddNode(gc, "city", 1, "name", SI_StringValC("x"));
+    _AddEdge(gc, a, b, "friend");
+    _AddEdge(gc, b, c, "friend");
+    _AddEdge(gc, c, d, "friend");
+    _AddEdge(gc, d, e, "friend");
+    _AddEdge(gc, a, c, "friend");
+    _AddEdge(gc, e, b, "friend");
+    _AddEdge(gc, b, x, "lives");
+
+    _RunQuery(gc, "MATCH (s:person {name:'a'})-[:friend*1..1]->(f) RETURN f.name", result);
+    assert(strcmp(result, "b,c") == 0);
+
+    _RunQuery(gc, "MATCH (s:person {name:'a'})-[:friend*2]->(f) RETURN f.name", result);
+    assert(strcmp(result, "c,d") == 0);
+
+    /* Each reached node is reported once. */
+    _RunQuery(gc, "MATCH (s:person {name:'a'})-[:friend*1..3]->(f) RETURN f.name", result);
+    assert(strcmp(result, "b,c,d,e") == 0);
+
+    /* Unbounded links terminate on cycles. */
+    _RunQuery(gc, "MATCH (s:person {name:'c'})-[:friend*]->(f) RETURN f.name", result);
+    assert(strcmp(result, "b,c,d,e") == 0);
+
+    /* Nodes reached below the minimum can be reached again within bounds. */
+    _RunQuery(gc, "MATCH (s:person {name:'b'})-[:friend*4..]->(f) RETURN f.name", result);
+    assert(strcmp(result, "b,c,d,e") == 0);
+
+    /* Any relationship type, destination label is enforced. */
+    _RunQuery(gc, "MATCH (s:person {name:'a'})-[*1..2]->(f:city) RETURN f.name", result);
+    assert(strcmp(result, "x") == 0);
+
+    /* Right to left links. */
+    _RunQuery(gc, "MATCH (f:person)<-[:friend*2..2]-(s:person {name:'a'}) RETURN f.name", result);
+    assert(strcmp(result, "c,d") == 0);
+
+    /* Variable length link followed by a single hop. */
+    _RunQuery(gc, "MATCH (s:person {name:'a'})-[:friend*1..3]->(f)-[:lives]->(y) RETURN y.name", result);
+    assert(strcmp(result, "x") == 0);
+
+    GraphContext_Free(gc);
+}
+
+int main(int argc, char **argv) {
+    InitGroupCache();
+    test_parse_hops();
+    test_var_len_expand();
+    printf("PASS!");
+    return 0;
+}
@@ -3,7 +3,14 @@
 #include "assert.h"
 #include "../src/rmutil/vector.h"
 #include "../src/parser/grammar.h"
+#include "../src/query_executor.h"
 #include "../src/filter_tree/filter_tree.h"
+#include "../src/filter_tree/filter_program.h"
+#include "../src/filter_tree/filter_normalize.h"
+#include "../src/grouping/group_cache.h"
+#include "../src/hexastore/triplet.h"
+#include "../src/graph_context/graph_context.h"
+#include "../src/execution_plan/execution_plan.h"
 
 void compareFilterTreeVaryingNode(const FT_FilterNode *a, const FT_FilterNode *b) {
     assert(a->t == b->t);
@@ -42,7 +49,415 @@ void compareFilterTrees(const FT_FilterNode *a, const FT_FilterNode *b) {
     }
 }
 
+void test_param_filter_tree() {
+    char *errMsg = NULL;
+    const char *query = "MATCH (a)-[]->(b) WHERE a.age > $age AND (b.age < $age OR b.name = $name) RETURN a";
+    AST_QueryExpressionNode *ast = ParseQuery(query, strlen(query), &errMsg);
+    assert(ast);
+
+    TrieMap *params = NewTrieMap();
+    FT_FilterNode *tree = BuildFiltersTree(ast->whereNode->filters, params);
+    assert(params->cardinality == 2);
+
+    /* Both predicates refering to $age share the same slot. */
+    FT_FilterNode *aAge = tree->cond.left;
+    FT_FilterNode *bAge = tree->cond.right->cond.left;
+    FT_FilterNode *bName = tree->cond.right->cond.right;
+    assert(aAge->pred.t == FT_N_PARAM);
+    assert(strcmp(aAge->pred.param->name, "age") == 0);
+    assert(aAge->pred.param == bAge->pred.param);
+    assert(aAge->pred.param == FilterTree_GetParam(params, "age"));
+    assert(strcmp(bName->pred.param->name, "name") == 0);
+    assert(!bName->pred.param->bound);
+
+    /* Clones refer to the original slots. */
+    FT_FilterNode *clone;
+    FilterTree_Clone(tree, &clone);
+    assert(clone->cond.left->pred.param == aAge->pred.param);
+
+    FilterTree_Free(clone);
+    FilterTree_Free(tree);
+    TrieMap_Free(params, FilterTree_FreeParam);
+}
+
+Node *_NewPerson(long int id, const char *name, double age, int reversed) {
+    Node *n = NewNode(id, "person");
+    char **keys = malloc(sizeof(char*) * 2);
+    SIValue *values = malloc(sizeof(SIValue) * 2);
+    int nameIdx = reversed ? 1 : 0;
+    keys[nameIdx] = strdup("name");
+    values[nameIdx] = SI_StringValC(strdup(name));
+    keys[1 - nameIdx] = strdup("age");
+    values[1 - nameIdx] = SI_DoubleVal(age);
+    Node_Add_Properties(n, 2, keys, values);
+    free(keys);
+    free(values);
+    return n;
+}
+
+/* Compiles query's WHERE clause against g,
+ * checks both program and filter tree agree with expected. */
+void _checkFilter(const Graph *g, const char *where, int expected) {
+    char query[512];
+    char *errMsg = NULL;
+    snprintf(query, 512, "MATCH (a)-[]->(b) WHERE %s RETURN a", where);
+    AST_QueryExpressionNode *ast = ParseQuery(query, strlen(query), &errMsg);
+    assert(ast);
+
+    TrieMap *params = NewTrieMap();
+    FT_FilterNode *tree = BuildFiltersTree(ast->whereNode->filters, params);
+    FilterProgram *program = FilterProgram_Compile(tree, g);
+    assert(FilterProgram_Apply(program, g) == expected);
+    /* Property indices are cached by now. */
+    assert(FilterProgram_Apply(program, g) == expected);
+
+    /* Frees tree as well. */
+    FilterProgram_Free(program);
+    TrieMap_Free(params, FilterTree_FreeParam);
+    Free_AST_QueryExpressionNode(ast);
+}
+
+void test_filter_program() {
+    Graph *g = NewGraph();
+    Node *a = _NewPerson(1, "Alice", 30, 0);
+    Node *b = _NewPerson(2, "Bob", 20, 0);
+    Graph_AddNode(g, a, "a");
+    Graph_AddNode(g, b, "b");
+
+    _checkFilter(g, "a.age > 25", FILTER_PASS);
+    _checkFilter(g, "a.age <= 25", FILTER_FAIL);
+    _checkFilter(g, "a.name = 'alice'", FILTER_PASS);
+    _checkFilter(g, "a.name != 'Alice'", FILTER_FAIL);
+    _checkFilter(g, "b.name < 'Bobby'", FILTER_PASS);
+    _checkFilter(g, "a.age > b.age", FILTER_PASS);
+    _checkFilter(g, "a.age = b.age", FILTER_FAIL);
+
+    /* Short circuiting conditions. */
+    _checkFilter(g, "a.age < 25 AND b.age < 25", FILTER_FAIL);
+    _checkFilter(g, "a.age < 25 OR b.age < 25", FILTER_PASS);
+    _checkFilter(g, "(a.age < 25 OR b.age < 25) AND a.name = 'Alice'", FILTER_PASS);
+    _checkFilter(g, "a.age < 25 OR (b.age < 25 AND b.name = 'Alice')", FILTER_FAIL);
+    _checkFilter(g, "(a.age > 25 AND b.age > 25) OR (a.name = 'Bob' OR b.name = 'Bob')", FILTER_PASS);
+
+    /* Missing properties and entities fail. */
+    _checkFilter(g, "a.height > 1", FILTER_FAIL);
+    _checkFilter(g, "a.height > 1 OR a.age > 1", FILTER_PASS);
+    _checkFilter(g, "c.age > 1", FILTER_FAIL);
+
+    Graph_Free(g);
+}
+
+/* Creates a node whose properties x, y, z, w hold values. */
+Node *_NewValued(long int id, const SIValue *values) {
+    const char *names[4] = {"x", "y", "z", "w"};
+    Node *n = NewNode(id, "valued");
+    char **keys = malloc(sizeof(char*) * 4);
+    SIValue *props = malloc(sizeof(SIValue) * 4);
+    for(int i = 0; i < 4; i++) {
+        keys[i] = strdup(names[i]);
+        props[i] = values[i];
+    }
+    Node_Add_Properties(n, 4, keys, props);
+    free(keys);
+    free(props);
+    return n;
+}
+
+void test_filter_program_varying() {
+    Graph *g = NewGraph();
+    SIValue av[4] = {SI_LongVal(-1), SI_LongVal(-5), SI_LongVal(-2), SI_LongVal(-2)};
+    SIValue bv[4] = {SI_LongVal(-1), SI_LongVal(3), SI_DoubleVal(-2.5), SI_DoubleVal(-2)};
+    Graph_AddNode(g, _NewValued(1, av), "a");
+    Graph_AddNode(g, _NewValued(2, bv), "b");
+
+    /* Negative integers compare as integers. */
+    _checkFilter(g, "a.x = b.x", FILTER_PASS);
+    _checkFilter(g, "a.x < b.x", FILTER_FAIL);
+    _checkFilter(g, "a.x > b.x", FILTER_FAIL);
+    _checkFilter(g, "a.x >= b.x", FILTER_PASS);
+    _checkFilter(g, "a.y < b.y", FILTER_PASS);
+    _checkFilter(g, "a.y <= b.y", FILTER_PASS);
+    _checkFilter(g, "a.y > b.y", FILTER_FAIL);
+    _checkFilter(g, "a.y != b.y", FILTER_PASS);
+    _checkFilter(g, "b.y > a.y", FILTER_PASS);
+
+    /* Integers against doubles compare numerically. */
+    _checkFilter(g, "a.z > b.z", FILTER_PASS);
+    _checkFilter(g, "a.z = b.z", FILTER_FAIL);
+    _checkFilter(g, "b.z < a.z", FILTER_PASS);
+    _checkFilter(g, "a.w = b.w", FILTER_PASS);
+    _checkFilter(g, "b.w = a.w", FILTER_PASS);
+    _checkFilter(g, "a.y < b.z", FILTER_PASS);
+
+    /* A predicate respecializes as its right side changes type. */
+    char *errMsg = NULL;
+    const char *query = "MATCH (a)-[]->(b) WHERE a.x = b.x RETURN a";
+    AST_QueryExpressionNode *ast = ParseQuery(query, strlen(query), &errMsg);
+    TrieMap *params = NewTrieMap();
+    FilterProgram *program = FilterProgram_Compile(BuildFiltersTree(ast->whereNode->filters, params), g);
+    assert(FilterProgram_Apply(program, g) == FILTER_PASS);
+
+    SIValue cv[4] = {SI_DoubleVal(-1), SI_DoubleVal(0), SI_DoubleVal(0), SI_DoubleVal(0)};
+    Node *c = _NewValued(3, cv);
+    Node **slot = Graph_GetNodeRef(g, Graph_GetNodeByAlias(g, "b"));
+    Node *b = *slot;
+    *slot = c;
+    assert(FilterProgram_Apply(program, g) == FILTER_PASS);
+    c->properties[0].value = SI_DoubleVal(-0.5);
+    assert(FilterProgram_Apply(program, g) == FILTER_FAIL);
+    *slot = b;
+    assert(FilterProgram_Apply(program, g) == FILTER_PASS);
+
+    FilterProgram_Free(program);
+    TrieMap_Free(params, FilterTree_FreeParam);
+    Free_AST_QueryExpressionNode(ast);
+    Graph_Free(g);
+    FreeNode(c);
+}
+
+void test_filter_program_slots() {
+    char *errMsg = NULL;
+    const char *query = "MATCH (a)-[]->(b) WHERE a.name = $name AND a.age > $age RETURN a";
+    AST_QueryExpressionNode *ast = ParseQuery(query, strlen(query), &errMsg);
+    assert(ast);
+
+    Graph *g = NewGraph();
+    Node *a = _NewPerson(1, "Alice", 30, 0);
+    Node *b = _NewPerson(2, "Bob", 20, 1);
+    Graph_AddNode(g, a, "a");
+
+    TrieMap *params = NewTrieMap();
+    FT_FilterNode *tree = BuildFiltersTree(ast->whereNode->filters, params);
+    FilterProgram *program = FilterProgram_Compile(tree, g);
+
+    /* Unbound parameters fail. */
+    assert(FilterProgram_Apply(program, g) == FILTER_FAIL);
+
+    FT_Param *name = FilterTree_GetParam(params, "name");
+    FT_Param *age = FilterTree_GetParam(params, "age");
+    name->value = SI_StringValC("Bob");
+    name->bound = 1;
+    age->value = SI_DoubleVal(10);
+    age->bound = 1;
+    assert(FilterProgram_Apply(program, g) == FILTER_FAIL);
+
+    /* Program reads whatever entity is currently in a's slot,
+     * b's properties are laid out in reverse order. */
+    Node **slot = Graph_GetNodeRef(g, a);
+    *slot = b;
+    assert(FilterProgram_Apply(program, g) == FILTER_PASS);
+
+    /* Rebinding to a different type respecializes comparison. */
+    age->value = SI_NullVal();
+    assert(FilterProgram_Apply(program, g) == FILTER_FAIL);
+    age->value = SI_DoubleVal(10);
+    assert(FilterProgram_Apply(program, g) == FILTER_PASS);
+    age->value = SI_DoubleVal(25);
+    assert(FilterProgram_Apply(program, g) == FILTER_FAIL);
+    *slot = a;
+    name->value = SI_StringValC("Alice");
+    assert(FilterProgram_Apply(program, g) == FILTER_PASS);
+
+    /* Frees tree as well. */
+    FilterProgram_Free(program);
+    TrieMap_Free(params, FilterTree_FreeParam);
+    Free_AST_QueryExpressionNode(ast);
+    Graph_Free(g);
+    FreeNode(b);
+}
+
+/* Builds and normalizes WHERE clause filter tree,
+ * constant values are owned by the AST, which is freed
+ * the next time a tree is built. */
+int _normalize(const char *where, FT_FilterNode **tree, TrieMap *params) {
+    static AST_QueryExpressionNode *ast = NULL;
+    if(ast) Free_AST_QueryExpressionNode(ast);
+
+    char query[512];
+    char *errMsg = NULL;
+    snprintf(query, 512, "MATCH (a)-[]->(b) WHERE %s RETURN a", where);
+    ast = ParseQuery(query, strlen(query), &errMsg);
+    assert(ast);
+
+    *tree = BuildFiltersTree(ast->whereNode->filters, params);
+    return FilterTree_Normalize(tree);
+}
+
+void _assertPredicate(const FT_FilterNode *node, const char *alias, const char *property, int op) {
+    assert(node->t == FT_N_PRED);
+    assert(strcmp(node->pred.Lop.alias, alias) == 0);
+    assert(strcmp(node->pred.Lop.property, property) == 0);
+    assert(node->pred.op == op);
+}
+
+void test_normalize_contradictions() {
+    FT_FilterNode *tree;
+    TrieMap *params = NewTrieMap();
+
+    const char *unsatisfiable[] = {
+        "a.age = 1 AND a.age = 2",
+        "a.age > 5 AND a.age < 3",
+        "a.age >= 3 AND a.age < 3",
+        "a.age = 3 AND b.age > 1 AND a.age > 3",
+        "a.name = 'x' AND a.name != 'X'",
+        "(a.age = 1 AND a.age = 2) OR (b.age < 1 AND b.age > 1)",
+        "a.age < a.age",
+    };
+    for(int i = 0; i < sizeof(unsatisfiable) / sizeof(unsatisfiable[0]); i++) {
+        assert(_normalize(unsatisfiable[i], &tree, params) == FILTER_FAIL);
+        assert(tree == NULL);
+    }
+
+    const char *satisfiable[] = {
+        "a.age >= 3 AND a.age <= 3",
+        "a.age = 1 AND b.age = 2",
+        "a.age = 1 AND a.name = 'x'",
+        "a.age = 1 OR a.age = 2",
+        "a.age != 1 AND a.age = 2",
+        "a.age = $age AND a.age = 2",
+        "a.age <= a.age",
+    };
+    for(int i = 0; i < sizeof(satisfiable) / sizeof(satisfiable[0]); i++) {
+        assert(_normalize(satisfiable[i], &tree, params) == FILTER_PASS);
+        assert(tree != NULL);
+        FilterTree_Free(tree);
+    }
+
+    /* Folded disjuncts are dropped. */
+    assert(_normalize("(a.age = 1 AND a.age = 2) OR b.age = 3", &tree, params) == FILTER_PASS);
+    _assertPredicate(tree, "b", "age", EQ);
+    FilterTree_Free(tree);
+
+    /* Duplicates are dropped. */
+    assert(_normalize("a.age = 1 AND (a.age = 1 AND a.age = 1)", &tree, params) == FILTER_PASS);
+    _assertPredicate(tree, "a", "age", EQ);
+    FilterTree_Free(tree);
+
+    TrieMap_Free(params, FilterTree_FreeParam);
+}
+
+void test_normalize_order() {
+    FT_FilterNode *tree;
+    TrieMap *params = NewTrieMap();
+
+    /* Conjuncts: selective numeric, range numeric, then string comparison. */
+    assert(_normalize("a.name = 'x' AND (a.age > 3 AND a.age = 4)", &tree, params) == FILTER_PASS);
+    assert(tree->t == FT_N_COND && tree->cond.op == AND);
+    _assertPredicate(tree->cond.left, "a", "age", EQ);
+    assert(tree->cond.right->cond.op == AND);
+    _assertPredicate(tree->cond.right->cond.left, "a", "age", GT);
+    _assertPredicate(tree->cond.right->cond.right, "a", "name", EQ);
+    FilterTree_Free(tree);
+
+    /* Disjuncts: most likely to pass first. */
+    assert(_normalize("a.age = 1 OR a.age > 5", &tree, params) == FILTER_PASS);
+    assert(tree->cond.op == OR);
+    _assertPredicate(tree->cond.left, "a", "age", GT);
+    _assertPredicate(tree->cond.right, "a", "age", EQ);
+    FilterTree_Free(tree);
+
+    /* Nested conditions are ordered as a whole,
+     * equally ranked operands keep their order. */
+    assert(_normalize("(a.age > 1 OR b.age > 1) AND a.x = 1 AND b.x = 1", &tree, params) == FILTER_PASS);
+    _assertPredicate(tree->cond.left, "a", "x", EQ);
+    _assertPredicate(tree->cond.right->cond.left, "b", "x", EQ);
+    assert(tree->cond.right->cond.right->cond.op == OR);
+    FilterTree_Free(tree);
+
+    TrieMap_Free(params, FilterTree_FreeParam);
+}
+
+void test_unsatisfiable_plan() {
+    char *errMsg = NULL;
+    const char *query = "MATCH (a:person)-[:knows]->(b) WHERE a.age > 30 AND a.age < 20 RETURN a.name";
+    AST_QueryExpressionNode *ast = ParseQuery(query, strlen(query), &errMsg);
+    assert(ast);
+
+    GraphContext *gc = NewGraphContext("social");
+    ExecutionPlan *plan = NewExecutionPlan(NULL, gc, ast);
+    assert(plan->filter_tree == NULL);
+    assert(plan->root->childCount == 0);
+
+    ResultSet *set = ExecutionPlan_Execute(plan);
+    assert(Vector_Size(set->records) == 0);
+
+    ResultSet_Free(NULL, set);
+    ExecutionPlanFree(plan);
+    GraphContext_Free(gc);
+}
+
+void _AddPerson(GraphContext *gc, Node *n) {
+    GraphContext_AddNode(gc, n);
+}
+
+void _AddKnows(GraphContext *gc, long int id, Node *src, Node *dest) {
+    GraphContext_AddEdge(gc, NewEdge(id, src, dest, "knows"));
+}
+
+int _CountRecords(GraphContext *gc, const char *query, int *filterOps) {
+    char *errMsg = NULL;
+    AST_QueryExpressionNode *ast = ParseQuery(query, strlen(query), &errMsg);
+    assert(ast);
+
+    ExecutionPlan *plan = NewExecutionPlan(NULL, gc, ast);
+    char *strPlan = ExecutionPlanPrint(plan);
+    *filterOps = 0;
+    for(char *f = strstr(strPlan, "Filter"); f; f = strstr(f + 1, "Filter")) (*filterOps)++;
+    free(strPlan);
+
+    ResultSet *set = ExecutionPlan_Execute(plan);
+    int count = Vector_Size(set->records);
+    ResultSet_Free(NULL, set);
+    ExecutionPlanFree(plan);
+    return count;
+}
+
+void test_embedded_filters() {
+    int filterOps;
+    GraphContext *gc = NewGraphContext("social");
+
+    /* Everyone knows everyone older. */
+    Node *people[6];
+    for(int i = 0; i < 6; i++) {
+        char name[8];
+        snprintf(name, 8, "p%d", i);
+        people[i] = _NewPerson(i + 1, name, 20 + i * 5, i % 2);
+        _AddPerson(gc, people[i]);
+    }
+    long int edgeId = 100;
+    for(int i = 0; i < 6; i++) {
+        for(int j = i + 1; j < 6; j++) _AddKnows(gc, edgeId++, people[i], people[j]);
+    }
+
+    /* Scans and expansions filter the entities they bind. */
+    assert(_CountRecords(gc, "MATCH (a:person) WHERE a.age > 30 RETURN a.name", &filterOps) == 3);
+    assert(filterOps == 0);
+    assert(_CountRecords(gc, "MATCH (a) WHERE a.age <= 30 RETURN a.name", &filterOps) == 3);
+    assert(filterOps == 0);
+    assert(_CountRecords(gc, "MATCH (a:person)-[:knows]->(b:person) WHERE a.age >= 35 RETURN b.name", &filterOps) == 3);
+    assert(filterOps == 0);
+    assert(_CountRecords(gc, "MATCH (a:person)-[:knows]->(b:person) WHERE a.age = 20 AND b.age > 35 RETURN b.name", &filterOps) == 2);
+    assert(filterOps == 0);
+    assert(_CountRecords(gc, "MATCH (a:person)-[:knows]->(b:person) WHERE b.age < a.age RETURN b.name", &filterOps) == 0);
+    assert(_CountRecords(gc, "MATCH (a:person)-[:knows]->(b:person) WHERE a.age < b.age RETURN b.name", &filterOps) == 15);
+
+    /* Variable length expansions are filtered by a separate op. */
+    assert(_CountRecords(gc, "MATCH (a:person)-[:knows*2]->(b:person) WHERE a.age = 20 AND b.age = 40 RETURN b.name", &filterOps) == 1);
+    assert(filterOps == 1);
+
+    GraphContext_Free(gc);
+}
+
 int main(int argc, char **argv) {
+    InitGroupCache();
+    test_param_filter_tree();
+    test_normalize_contradictions();
+    test_normalize_order();
+    test_unsatisfiable_plan();
+    test_embedded_filters();
+    test_filter_program();
+    test_filter_program_slots();
+    test_filter_program_varying();
 	printf("PASS!\n");
     return 0;
 }
\ No newline at end of file
@@ -132,9 +132,40 @@ void test_graph_id_less_entities() {
     Graph_Free(graph);
 }
 
+void test_graph_slots() {
+    Graph *graph = NewGraph();
+    Node *person_node = NewNode(1l, "person");
+    Node *city_node = NewNode(2l, "city");
+    Edge *edge = NewEdge(3l, person_node, city_node, "lives");
+    Graph_AddNode(graph, person_node, "Joe");
+    Graph_AddNode(graph, city_node, "NYC");
+    Graph_ConnectNodes(graph, person_node, city_node, edge, "relation");
+
+    /* Nodes occupy the first slots, edges follow. */
+    assert(Graph_GetAliasSlot(graph, "Joe") == 0);
+    assert(Graph_GetAliasSlot(graph, "NYC") == 1);
+    assert(Graph_GetAliasSlot(graph, "relation") == 2);
+    assert(Graph_GetAliasSlot(graph, "Jane") == GRAPH_NO_SLOT);
+    assert(Graph_GetAliasSlot(graph, NULL) == GRAPH_NO_SLOT);
+
+    assert(Graph_GetEntityBySlot(graph, 0) == (GraphEntity*)person_node);
+    assert(Graph_GetEntityBySlot(graph, 2) == (GraphEntity*)edge);
+
+    /* Slots reflect entities bound at the time of access. */
+    Node *other_city = NewNode(4l, "city");
+    Node **ref = Graph_GetNodeRef(graph, city_node);
+    *ref = other_city;
+    assert(Graph_GetEntityBySlot(graph, 1) == (GraphEntity*)other_city);
+    *ref = city_node;
+
+    FreeNode(other_city);
+    Graph_Free(graph);
+}
+
 int main(int argc, char **argv) {
     test_graph_creation();
     test_graph_construction();
+    test_graph_slots();
 
 	printf("PASS!\n");
     return 0;
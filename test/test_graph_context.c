@@ -0,0 +1,370 @@
+#include <stdio.h>
+#include <string.h>
+#include "assert.h"
+#include "../src/util/prng.h"
+#include "../src/graph/node.h"
+#include "../src/graph/edge.h"
+#include "../src/query_executor.h"
+#include "../src/hexastore/triplet.h"
+#include "../src/resultset/record.h"
+#include "../src/graph_context/graph_context.h"
+#include "../src/execution_plan/execution_plan.h"
+
+void test_graph_context_stores() {
+    GraphContext *gc = NewGraphContext("social");
+    assert(strcmp(gc->name, "social") == 0);
+
+    /* Unlabeled lookups return the graph's main stores. */
+    assert(GraphContext_GetStore(gc, STORE_NODE, NULL) == gc->nodes);
+    assert(GraphContext_GetStore(gc, STORE_EDGE, NULL) == gc->edges);
+
+    /* Label bitmaps are created by node insertions only. */
+    assert(GraphContext_GetLabelBitmap(gc, "actor") == NULL);
+    GraphContext_AddNode(gc, NewNode(get_new_id(), "actor"));
+    GraphContext_AddNode(gc, NewNode(get_new_id(), "movie"));
+    Bitmap *actors = GraphContext_GetLabelBitmap(gc, "actor");
+    assert(actors);
+    assert(GraphContext_GetLabelBitmap(gc, "actor") == actors);
+    assert(GraphContext_GetLabelBitmap(gc, "movie") != actors);
+    assert(GraphContext_GetLabelBitmap(gc, "director") == NULL);
+
+    /* Nodes are grouped by label within bitmaps only. */
+    assert(GraphContext_GetStore(gc, STORE_NODE, "actor") == NULL);
+    Store *acts = GraphContext_GetStore(gc, STORE_EDGE, "act");
+    assert(acts && acts != gc->edges);
+    assert(GraphContext_GetStore(gc, STORE_EDGE, "act") == acts);
+
+    assert(GraphContext_GetHexaStore(gc) == gc->hexastore);
+
+    GraphContext_Free(gc);
+}
+
+void test_graph_context_labels() {
+    GraphContext *gc = NewGraphContext("movies");
+
+    /* Nodes are indexed densely, in order of insertion. */
+    Node *nodes[6];
+    for(int i = 0; i < 6; i++) {
+        nodes[i] = NewNode(get_new_id(), (i % 3 == 0) ? NULL : (i % 3 == 1) ? "actor" : "movie");
+        GraphContext_AddNode(gc, nodes[i]);
+        assert(GraphContext_GetNodeByIndex(gc, i) == nodes[i]);
+    }
+
+    assert(GraphContext_LabelCardinality(gc, NULL) == 6);
+    assert(GraphContext_LabelCardinality(gc, "actor") == 2);
+    assert(GraphContext_LabelCardinality(gc, "director") == 0);
+    assert(GraphContext_GetLabelBitmap(gc, "director") == NULL);
+    assert(Store_Cardinality(gc->nodes) == 6);
+
+    Bitmap *actors = GraphContext_GetLabelBitmap(gc, "actor");
+    assert(Bitmap_Contains(actors, 1) && Bitmap_Contains(actors, 4));
+    assert(!Bitmap_Contains(actors, 0) && !Bitmap_Contains(actors, 2));
+
+    GraphContext_Free(gc);
+}
+
+void test_graph_context_free() {
+    GraphContext *gc = NewGraphContext("movies");
+
+    Node *actor = NewNode(get_new_id(), "actor");
+    Node *movie = NewNode(get_new_id(), "movie");
+    Edge *act = NewEdge(get_new_id(), actor, movie, "act");
+
+    GraphContext_AddNode(gc, actor);
+    GraphContext_AddNode(gc, movie);
+    GraphContext_AddEdge(gc, act);
+
+    assert(Store_Cardinality(gc->nodes) == 2);
+    assert(Store_Cardinality(gc->edges) == 1);
+    assert(gc->hexastore->cardinality == 6);
+
+    /* Releases every node, edge and triplet exactly once. */
+    GraphContext_Free(gc);
+}
+
+void test_graph_context_mem_usage() {
+    GraphMemoryUsage empty;
+    GraphMemoryUsage usage;
+    GraphContext *gc = NewGraphContext("movies");
+    GraphContext_MemUsage(gc, &empty);
+    assert(empty.nodes == 0 && empty.edges == 0 && empty.properties == 0);
+    assert(empty.total > 0);
+
+    Node *actor = NewNode(get_new_id(), "actor");
+    Node *movie = NewNode(get_new_id(), "movie");
+    Edge *act = NewEdge(get_new_id(), actor, movie, "act");
+
+    char **keys = malloc(sizeof(char*));
+    SIValue *values = malloc(sizeof(SIValue));
+    keys[0] = strdup("name");
+    values[0] = SI_StringValC(strdup("Tom"));
+    Node_Add_Properties(actor, 1, keys, values);
+    free(keys);
+    free(values);
+
+    GraphContext_AddNode(gc, actor);
+    GraphContext_AddNode(gc, movie);
+    GraphContext_AddEdge(gc, act);
+
+    GraphContext_MemUsage(gc, &usage);
+    assert(usage.nodes >= 2 * sizeof(Node) + strlen("actor") + strlen("movie") + 2);
+    assert(usage.edges == sizeof(Edge) + strlen("act") + 1);
+    /* Tom is interned, held by name's dictionary. */
+    assert(usage.properties == sizeof(EntityProperty) + strlen("name") + 1);
+    assert(usage.dictionaries > empty.dictionaries + strlen("Tom"));
+    assert(usage.dictionary_savings == 0);
+    assert(usage.node_store > empty.node_store);
+    assert(usage.edge_store > empty.edge_store);
+    assert(usage.label_bitmaps > empty.label_bitmaps);
+    assert(usage.type_stores > empty.type_stores);
+    assert(usage.hexastore > empty.hexastore);
+    assert(usage.indexes == 0);
+    assert(usage.schemas > empty.schemas);
+
+    /* Total accounts for every component. */
+    size_t sum = usage.nodes + usage.edges + usage.properties +
+                 usage.node_store + usage.label_bitmaps +
+                 usage.edge_store + usage.type_stores +
+                 usage.hexastore + usage.indexes + usage.schemas +
+                 usage.dictionaries;
+    assert(usage.total > sum);
+    assert(GraphContextType_MemUsage(gc) == usage.total);
+
+    GraphContext_Free(gc);
+}
+
+/* Creates a node carrying attributes keys, each valued by its own name. */
+Node *_NewNode(const char *label, int count, const char **attributes) {
+    Node *n = NewNode(get_new_id(), label);
+    char **keys = malloc(sizeof(char*) * count);
+    SIValue *values = malloc(sizeof(SIValue) * count);
+    for(int i = 0; i < count; i++) {
+        keys[i] = strdup(attributes[i]);
+        values[i] = SI_StringValC(strdup(attributes[i]));
+    }
+    Node_Add_Properties(n, count, keys, values);
+    free(keys);
+    free(values);
+    return n;
+}
+
+void test_graph_context_schemas() {
+    GraphContext *gc = NewGraphContext("movies");
+    assert(GraphContext_GetSchema(gc, STORE_NODE, "actor") == NULL);
+    assert(Schema_AttributeCount(GraphContext_GetSchema(gc, STORE_NODE, NULL)) == 0);
+
+    /* Attributes are ordered by first appearance, per label. */
+    const char *tom[2] = {"name", "age"};
+    const char *meg[2] = {"name", "born"};
+    const char *heat[1] = {"title"};
+    GraphContext_AddNode(gc, _NewNode("actor", 2, tom));
+    GraphContext_AddNode(gc, _NewNode("actor", 2, meg));
+    GraphContext_AddNode(gc, _NewNode("movie", 1, heat));
+    GraphContext_AddNode(gc, _NewNode(NULL, 0, NULL));
+
+    Schema *actor = GraphContext_GetSchema(gc, STORE_NODE, "actor");
+    assert(Schema_AttributeCount(actor) == 3);
+    assert(Schema_GetAttributeID(actor, "name") == 0);
+    assert(Schema_GetAttributeID(actor, "age") == 1);
+    assert(Schema_GetAttributeID(actor, "born") == 2);
+    assert(Schema_GetAttributeID(actor, "title") == SCHEMA_NO_ATTRIBUTE);
+    assert(strcmp(Schema_GetAttribute(actor, 2), "born") == 0);
+
+    Schema *all = GraphContext_GetSchema(gc, STORE_NODE, NULL);
+    assert(Schema_AttributeCount(all) == 4);
+    assert(Schema_GetAttributeID(all, "title") == 3);
+
+    /* Edges are described per relationship type. */
+    Node *a = GraphContext_GetNodeByIndex(gc, 0);
+    Node *m = GraphContext_GetNodeByIndex(gc, 2);
+    Edge *act = NewEdge(get_new_id(), a, m, "act");
+    char **keys = malloc(sizeof(char*));
+    SIValue *values = malloc(sizeof(SIValue));
+    keys[0] = strdup("role");
+    values[0] = SI_StringValC(strdup("Neil"));
+    Edge_Add_Properties(act, 1, keys, values);
+    free(keys);
+    free(values);
+    Store_Insert(GraphContext_GetStore(gc, STORE_EDGE, NULL), "5", act);
+    GraphContext_UpdateSchema(gc, STORE_EDGE, "act", (GraphEntity*)act);
+
+    Schema *acts = GraphContext_GetSchema(gc, STORE_EDGE, "act");
+    assert(Schema_GetAttributeID(acts, "role") == 0);
+    assert(Schema_GetAttributeID(GraphContext_GetSchema(gc, STORE_EDGE, NULL), "role") == 0);
+    assert(GraphContext_GetSchema(gc, STORE_NODE, "act") == NULL);
+
+    GraphContext_Free(gc);
+}
+
+void test_graph_context_expand_collapsed() {
+    GraphContext *gc = NewGraphContext("movies");
+    const char *tom[2] = {"name", "age"};
+    const char *meg[2] = {"name", "born"};
+    GraphContext_AddNode(gc, _NewNode("actor", 2, tom));
+    GraphContext_AddNode(gc, _NewNode("actor", 2, meg));
+
+    const char *query = "MATCH (a:actor) RETURN a";
+    char *errMsg = NULL;
+    AST_QueryExpressionNode *ast = ParseQuery(query, strlen(query), &errMsg);
+    assert(ast);
+
+    /* Collapsed node expands to every attribute of its label. */
+    ReturnClause_ExpandCollapsedNodes(NULL, ast, gc);
+    assert(Vector_Size(ast->returnNode->returnElements) == 3);
+
+    ExecutionPlan *plan = NewExecutionPlan(NULL, gc, ast);
+    ResultSet *set = ExecutionPlan_Execute(plan);
+
+    /* Neither actor is dropped, missing attributes are NULL. */
+    assert(Vector_Size(set->records) == 2);
+    int nulls = 0;
+    for(int i = 0; i < 2; i++) {
+        Record *r;
+        Vector_Get(set->records, i, &r);
+        assert(r->len == 3);
+        assert(r->values[0]->type == T_STRING);
+        for(int j = 1; j < 3; j++) {
+            if(r->values[j]->type == T_NULL) nulls++;
+        }
+    }
+    assert(nulls == 2);
+
+    ResultSet_Free(NULL, set);
+    ExecutionPlanFree(plan);
+    GraphContext_Free(gc);
+}
+
+/* In memory stand-in for redis' RDB, values are read back in the order they were saved. */
+typedef struct {
+    uint64_t u;
+    int64_t s;
+    double d;
+    char *str;
+    size_t len;
+} _RdbItem;
+
+_RdbItem _rdb[1024];
+int _rdb_saved = 0;
+int _rdb_loaded = 0;
+
+void _RdbSaveUnsigned(RedisModuleIO *io, uint64_t v) { _rdb[_rdb_saved++].u = v; }
+void _RdbSaveSigned(RedisModuleIO *io, int64_t v) { _rdb[_rdb_saved++].s = v; }
+void _RdbSaveDouble(RedisModuleIO *io, double v) { _rdb[_rdb_saved++].d = v; }
+void _RdbSaveFloat(RedisModuleIO *io, float v) { _rdb[_rdb_saved++].d = v; }
+void _RdbSaveStringBuffer(RedisModuleIO *io, const char *str, size_t len) {
+    _rdb[_rdb_saved].str = malloc(len + 1);
+    memcpy(_rdb[_rdb_saved].str, str, len);
+    _rdb[_rdb_saved].str[len] = '\0';
+    _rdb[_rdb_saved++].len = len;
+}
+uint64_t _RdbLoadUnsigned(RedisModuleIO *io) { return _rdb[_rdb_loaded++].u; }
+int64_t _RdbLoadSigned(RedisModuleIO *io) { return _rdb[_rdb_loaded++].s; }
+double _RdbLoadDouble(RedisModuleIO *io) { return _rdb[_rdb_loaded++].d; }
+float _RdbLoadFloat(RedisModuleIO *io) { return _rdb[_rdb_loaded++].d; }
+char *_RdbLoadStringBuffer(RedisModuleIO *io, size_t *len) {
+    /* Ownership passes to the loader. */
+    if(len) *len = _rdb[_rdb_loaded].len;
+    return _rdb[_rdb_loaded++].str;
+}
+
+/* Saves gc and loads it back into a new graph context. */
+GraphContext *_GraphContext_Reload(GraphContext *gc) {
+    RedisModule_SaveUnsigned = _RdbSaveUnsigned;
+    RedisModule_SaveSigned = _RdbSaveSigned;
+    RedisModule_SaveDouble = _RdbSaveDouble;
+    RedisModule_SaveFloat = _RdbSaveFloat;
+    RedisModule_SaveStringBuffer = _RdbSaveStringBuffer;
+    RedisModule_LoadUnsigned = _RdbLoadUnsigned;
+    RedisModule_LoadSigned = _RdbLoadSigned;
+    RedisModule_LoadDouble = _RdbLoadDouble;
+    RedisModule_LoadFloat = _RdbLoadFloat;
+    RedisModule_LoadStringBuffer = _RdbLoadStringBuffer;
+    RedisModule_Free = free;
+
+    _rdb_saved = 0;
+    _rdb_loaded = 0;
+    GraphContextType_RdbSave(NULL, gc);
+    GraphContext *loaded = GraphContextType_RdbLoad(NULL, GRAPHCONTEXT_TYPE_ENCODING_VERSION);
+    assert(_rdb_loaded == _rdb_saved);
+    return loaded;
+}
+
+void test_graph_context_rdb_removed_edges() {
+    GraphContext *gc = NewGraphContext("movies");
+    Node *actor = NewNode(get_new_id(), "actor");
+    Node *movie = NewNode(get_new_id(), "movie");
+    GraphContext_AddNode(gc, actor);
+    GraphContext_AddNode(gc, movie);
+
+    Edge *edges[2];
+    for(int i = 0; i < 2; i++) {
+        edges[i] = NewEdge(get_new_id(), actor, movie, "act");
+        GraphContext_AddEdge(gc, edges[i]);
+    }
+    long int removed = edges[0]->id;
+    GraphContext_RemoveEdge(gc, edges[0]);
+
+    /* Removed edges don't come back once reloaded. */
+    GraphContext *loaded = _GraphContext_Reload(gc);
+    assert(Store_Cardinality(loaded->nodes) == 2);
+    assert(Store_Cardinality(loaded->edges) == 1);
+    assert(loaded->hexastore->cardinality == 6);
+    assert(GraphContext_EdgeCount(loaded, NULL, "act", NULL) == 1);
+
+    char id[32];
+    snprintf(id, 32, "%ld", removed);
+    assert(Store_Get(loaded->edges, id) == NULL);
+    snprintf(id, 32, "%ld", edges[1]->id);
+    assert(Store_Get(loaded->edges, id) != NULL);
+
+    GraphContext_Free(gc);
+    GraphContext_Free(loaded);
+}
+
+void test_graph_context_rdb_dictionaries() {
+    GraphContext *gc = NewGraphContext("movies");
+    const char *countries[4] = {"Israel", "France", "Israel", "Israel"};
+    for(int i = 0; i < 4; i++) {
+        Node *n = NewNode(get_new_id(), "actor");
+        char **keys = malloc(sizeof(char*));
+        SIValue *values = malloc(sizeof(SIValue));
+        keys[0] = strdup("country");
+        values[0] = SI_StringValC(strdup(countries[i]));
+        Node_Add_Properties(n, 1, keys, values);
+        free(keys);
+        free(values);
+        GraphContext_AddNode(gc, n);
+    }
+
+    GraphMemoryUsage usage;
+    GraphContext_MemUsage(gc, &usage);
+    assert(usage.dictionary_savings == 2 * (strlen("Israel") + 1));
+
+    /* Values loaded by code are accounted for as well. */
+    GraphContext *loaded = _GraphContext_Reload(gc);
+    GraphMemoryUsage reloaded;
+    GraphContext_MemUsage(loaded, &reloaded);
+    assert(reloaded.dictionary_savings == usage.dictionary_savings);
+    assert(reloaded.dictionaries == usage.dictionaries);
+
+    StringDict *d = GraphContext_GetStringDict(loaded, "country");
+    assert(StringDict_Count(d) == 2);
+    SIValue *country = Node_Get_Property(GraphContext_GetNodeByIndex(loaded, 0), "country");
+    assert(country->code == StringDict_Lookup(d, "israel", 6));
+
+    GraphContext_Free(gc);
+    GraphContext_Free(loaded);
+}
+
+int main(int argc, char **argv) {
+    test_graph_context_stores();
+    test_graph_context_labels();
+    test_graph_context_free();
+    test_graph_context_mem_usage();
+    test_graph_context_schemas();
+    test_graph_context_expand_collapsed();
+    test_graph_context_rdb_removed_edges();
+    test_graph_context_rdb_dictionaries();
+    printf("PASS!");
+    return 0;
+}
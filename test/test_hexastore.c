@@ -6,7 +6,7 @@
 #include "../src/hexastore/triplet.h"
 
 void test_hexastore() {
-    Triplet *t;
+    Edge *t;
     TripletIterator *it;
     long int id;
 
@@ -16,30 +16,26 @@ void test_hexastore() {
     Node *object_node = NewNode(id, "movie");
 	id = get_new_id();
     Edge *predicate_edge = NewEdge(id, subject_node, object_node, "act");
-    Triplet *triplet = NewTriplet(subject_node, predicate_edge, object_node);
 
 	HexaStore *hexastore = _NewHexaStore();
     assert(hexastore);
     
-    HexaStore_InsertAllPerm(hexastore,  triplet);
+    HexaStore_InsertAllPerm(hexastore, predicate_edge);
     assert(hexastore->cardinality == 6);
 
-    /* Note re-introducing the same triplet will seg-fault
-     * this is because the same triplet is used six times.
-     * i.e. freed six times */
-
     /* Search hexastore.
      * Scan entire hexastore. */
     it = HexaStore_Search(hexastore, "");
     for(int i = 0; i < 6; i++) {        
         assert(TripletIterator_Next(it, &t));
-        assert(t == triplet);
+        assert(t == predicate_edge);
     }
     assert(!TripletIterator_Next(it, &t));
 
     /* Searching all possible permutations. */
     it = HexaStore_Search(hexastore, "SPO");
     assert(TripletIterator_Next(it, &t));
+    assert(t->src == subject_node && t->dest == object_node);
     assert(!TripletIterator_Next(it, &t));
 
     it = HexaStore_Search(hexastore, "SOP");
@@ -62,8 +58,10 @@ void test_hexastore() {
     assert(TripletIterator_Next(it, &t));
     assert(!TripletIterator_Next(it, &t));
 
-    HexaStore_RemoveAllPerm(hexastore, triplet);
+    /* Removal leaves the edge intact. */
+    HexaStore_RemoveAllPerm(hexastore, predicate_edge);
     assert(hexastore->cardinality == 0);
+    assert(predicate_edge->src == subject_node && predicate_edge->dest == object_node);
 
     /* Searching an empty hexastore */
     it = HexaStore_Search(hexastore, "");
@@ -0,0 +1,391 @@
+#include <stdio.h>
+#include <string.h>
+#include "assert.h"
+#include "../src/value.h"
+#include "../src/graph/node.h"
+#include "../src/graph/edge.h"
+#include "../src/query_executor.h"
+#include "../src/hexastore/triplet.h"
+#include "../src/grouping/group_cache.h"
+#include "../src/graph_context/graph_context.h"
+#include "../src/execution_plan/execution_plan.h"
+#include "../src/execution_plan/ops/op_node_by_label_scan.h"
+#include "../src/execution_plan/ops/op_hash_join.h"
+#include "../src/execution_plan/ops/op_cartesian_product.h"
+#include "graph_fixture.h"
+
+int _ComparePairs(const void *a, const void *b) {
+    return strcmp(*(char**)a, *(char**)b);
+}
+
+/* Collects plan's records, each record's first two columns
+ * joined by '-', sorted and comma separated, e.g. "a-x,b-x". */
+void _CollectPairs(ExecutionPlan *plan, char *out) {
+    ResultSet *set = ExecutionPlan_Execute(plan);
+
+    size_t count = Vector_Size(set->records);
+    char **pairs = malloc(sizeof(char*) * count);
+    for(int i = 0; i < count; i++) {
+        Record *r;
+        Vector_Get(set->records, i, &r);
+        pairs[i] = malloc(64);
+        snprintf(pairs[i], 64, "%s-%s", r->values[0]->stringval.str, r->values[1]->stringval.str);
+    }
+    qsort(pairs, count, sizeof(char*), _ComparePairs);
+
+    out[0] = '\0';
+    for(int i = 0; i < count; i++) {
+        if(i > 0) strcat(out, ",");
+        strcat(out, pairs[i]);
+        free(pairs[i]);
+    }
+
+    free(pairs);
+    ResultSet_Free(NULL, set);
+}
+
+ExecutionPlan *_BuildPlan(GraphContext *gc, const char *query) {
+    char *errMsg = NULL;
+    AST_QueryExpressionNode *ast = ParseQuery(query, strlen(query), &errMsg);
+    assert(ast);
+    return NewExecutionPlan(NULL, gc, ast);
+}
+
+/* Runs query, returns the number of times op appears within its plan. */
+int _RunQuery(GraphContext *gc, const char *query, const char *op, char *out) {
+    ExecutionPlan *plan = _BuildPlan(gc, query);
+
+    int ops = 0;
+    char *strPlan = ExecutionPlanPrint(plan);
+    for(char *f = strstr(strPlan, op); f; f = strstr(f + 1, op)) ops++;
+    free(strPlan);
+
+    _CollectPairs(plan, out);
+    ExecutionPlanFree(plan);
+    return ops;
+}
+
+GraphContext *_BuildGraph() {
+    GraphContext *gc = NewGraphContext("social");
+
+    /* Ranked by name, a, b live in x, c lives in y, z is empty,
+     * a knows b, b knows c. */
+    Node *a = _AddNode(gc, "person", 2, "name", SI_StringValC("a"), "rank", SI_DoubleVal(1));
+    Node *b = _AddNode(gc, "person", 2, "name", SI_StringValC("b"), "rank", SI_DoubleVal(2));
+    Node *c = _AddNode(gc, "person", 2, "name", SI_StringValC("c"), "rank", SI_DoubleVal(3));
+    Node *x = _AddNode(gc, "city", 2, "name", SI_StringValC("x"), "rank", SI_DoubleVal(1));
+    Node *y = _AddNode(gc, "city", 2, "name", SI_StringValC("y"), "rank", SI_DoubleVal(2));
+    _AddNode(gc, "city", 2, "name", SI_StringValC("z"), "rank", SI_DoubleVal(3));
+    _AddEdge(gc, a, x, "lives");
+    _AddEdge(gc, b, x, "lives");
+    _AddEdge(gc, c, y, "lives");
+    _AddEdge(gc, a, b, "knows");
+    _AddEdge(gc, b, c, "knows");
+    return gc;
+}
+
+void test_parse_patterns() {
+    char *errMsg = NULL;
+    const char *query = "MATCH (a)-[:lives]->(c), (b)-[:lives]->(c), (d) RETURN a.name";
+    AST_QueryExpressionNode *ast = ParseQuery(query, strlen(query), &errMsg);
+    assert(ast);
+    assert(Vector_Size(ast->matchNode->graphEntities) == 7);
+
+    /* Patterns share node c. */
+    Graph *g = BuildGraph(ast->matchNode);
+    assert(g->node_count == 4);
+    assert(g->edge_count == 2);
+    assert(Node_IncomeDegree(Graph_GetNodeByAlias(g, "c")) == 2);
+    assert(Vector_Size(Graph_GetNodeByAlias(g, "d")->outgoingEdges) == 0);
+
+    Graph_Free(g);
+    Free_AST_QueryExpressionNode(ast);
+}
+
+void test_cartesian_product() {
+    char result[512];
+    GraphContext *gc = _BuildGraph();
+
+    assert(_RunQuery(gc, "MATCH (p:person), (c:city) RETURN p.name, c.name", "Cartesian Product", result) == 1);
+    assert(strcmp(result, "a-x,a-y,a-z,b-x,b-y,b-z,c-x,c-y,c-z") == 0);
+
+    /* Each stream is filtered ahead of the product. */
+    assert(_RunQuery(gc, "MATCH (p:person), (c:city) WHERE c.name = 'y' AND p.name != 'b' RETURN p.name, c.name", "Filter", result) == 0);
+    assert(strcmp(result, "a-y,c-y") == 0);
+
+    /* Filters spanning both streams apply to the product. */
+    assert(_RunQuery(gc, "MATCH (p:person), (q:person) WHERE p.rank < q.rank RETURN p.name, q.name", "Filter", result) == 1);
+    assert(strcmp(result, "a-b,a-c,b-c") == 0);
+
+    /* Empty right stream. */
+    assert(_RunQuery(gc, "MATCH (p:person), (c:city) WHERE c.name = 'w' RETURN p.name, c.name", "Cartesian Product", result) == 1);
+    assert(strcmp(result, "") == 0);
+
+    GraphContext_Free(gc);
+}
+
+GraphContext *_BuildDenseGraph() {
+    GraphContext *gc = NewGraphContext("dense");
+
+    /* 20 persons ranked by their index, everyone knows everyone else. */
+    Node *persons[20];
+    for(int i = 0; i < 20; i++) {
+        char name[8];
+        snprintf(name, 8, "p%d", i);
+        persons[i] = _AddNode(gc, "person", 2, "name", SI_StringValC(name), "rank", SI_DoubleVal(i));
+    }
+    for(int i = 0; i < 20; i++) {
+        for(int j = 0; j < 20; j++) {
+            if(i != j) _AddEdge(gc, persons[i], persons[j], "knows");
+        }
+    }
+    return gc;
+}
+
+void test_traversal_order() {
+    char result[512];
+    GraphContext *gc = _BuildGraph();
+
+    /* Single stream, lives edges are fewer than persons and cities
+     * combined, scanned and expanded through c. */
+    assert(_RunQuery(gc, "MATCH (p:person)-[:lives]->(c:city)<-[:lives]-(q:person) RETURN p.name, q.name", "Edge By Type Scan", result) == 1);
+    assert(strcmp(result, "a-a,a-b,b-a,b-b,c-c") == 0);
+
+    assert(_RunQuery(gc, "MATCH (p:person)-[:lives]->(c:city), (q:person)-[:lives]->(c) WHERE p.rank != q.rank RETURN p.name, q.name", "Expand All", result) == 1);
+    assert(strcmp(result, "a-b,b-a") == 0);
+
+    assert(_RunQuery(gc, "MATCH (p:person)-[:knows]->(c:person)-[:lives]->(x:city), (q:person)-[:lives]->(x) RETURN p.name, q.name", "Expand All", result) == 2);
+    assert(strcmp(result, "a-a,a-b,b-c") == 0);
+
+    assert(_RunQuery(gc, "MATCH (p:person)-[:lives]->(c:city), (q:person)-[:lives]->(c), (d:city) WHERE d.name = 'z' RETURN p.name, d.name", "Cartesian Product", result) == 1);
+    assert(strcmp(result, "a-z,a-z,b-z,b-z,c-z") == 0);
+
+    /* Scanned edges' end points are required to carry their labels. */
+    assert(_RunQuery(gc, "MATCH (p:person)-[:knows]->(q:city) RETURN p.name, q.name", "Edge By Type Scan", result) == 1);
+    assert(strcmp(result, "") == 0);
+
+    assert(_RunQuery(gc, "MATCH (p:person)-[:knows]->(q:person) WHERE q.rank > 2 RETURN p.name, q.name", "Edge By Type Scan", result) == 1);
+    assert(strcmp(result, "b-c") == 0);
+
+    /* Estimates are reported per op. */
+    ExecutionPlan *plan = _BuildPlan(gc, "MATCH (p:person)-[:lives]->(c:city) RETURN p.name, c.name");
+    char *strPlan = ExecutionPlanPrint(plan);
+    assert(strcmp(strPlan, "Produce Results (estimated rows: 3.0)\n"
+                           "    Edge By Type Scan (estimated rows: 3.0)\n") == 0);
+    free(strPlan);
+    ExecutionPlanFree(plan);
+
+    GraphContext_Free(gc);
+
+    /* Edges outnumber persons, filtered q is scanned
+     * and p is reached against edge direction. */
+    gc = _BuildDenseGraph();
+    plan = _BuildPlan(gc, "MATCH (p:person)-[:knows]->(q:person) WHERE q.name = 'p2' AND p.rank < 2 RETURN p.name, q.name");
+    OpNode *scan = plan->root->children[0]->children[0];
+    assert(scan->operation->type == OPType_NODE_BY_LABEL_SCAN);
+    assert(((NodeByLabelScan*)scan->operation)->_node == Graph_GetNodeByAlias(plan->graph, "q"));
+    _CollectPairs(plan, result);
+    assert(strcmp(result, "p0-p2,p1-p2") == 0);
+    ExecutionPlanFree(plan);
+
+    GraphContext_Free(gc);
+}
+
+void test_hash_join() {
+    char result[512];
+    GraphContext *gc = _BuildDenseGraph();
+
+    /* Expanding from either end fans out, both ends are expanded
+     * towards m and joined. */
+    assert(_RunQuery(gc, "MATCH (p:person)-[:knows]->(m:person)-[:knows]->(q:person) WHERE p.name = 'p1' AND q.name = 'p2' AND m.rank < 4 RETURN m.name, q.name", "Hash Join", result) == 1);
+    assert(strcmp(result, "p0-p2,p3-p2") == 0);
+
+    /* Filters spanning both sides apply to the join. */
+    assert(_RunQuery(gc, "MATCH (p:person)-[:knows]->(m:person)-[:knows]->(q:person) WHERE p.rank = 1 AND q.rank = 2 AND m.rank < p.rank RETURN m.name, q.name", "Hash Join", result) == 1);
+    assert(strcmp(result, "p0-p2") == 0);
+
+    GraphContext_Free(gc);
+}
+
+void test_join_aggregation() {
+    GraphContext *gc = _BuildGraph();
+
+    /* Aggregation covers every stream. */
+    ExecutionPlan *plan = _BuildPlan(gc, "MATCH (p:person), (c:city) RETURN count(p.name)");
+    char *strPlan = ExecutionPlanPrint(plan);
+    assert(strcmp(strPlan, "Produce Results\n"
+                           "    Aggregate\n"
+                           "        Cartesian Product (estimated rows: 9.0)\n"
+                           "            Node By Label Scan (estimated rows: 3.0)\n"
+                           "            Node By Label Scan (estimated rows: 3.0)\n") == 0);
+
+    free(strPlan);
+    ExecutionPlanFree(plan);
+    GraphContext_Free(gc);
+}
+
+/* Returns the first op of type t within plan, depth first. */
+OpNode *_FindOp(OpNode *root, OPType t) {
+    if(root->operation->type == t) return root;
+    for(int i = 0; i < root->childCount; i++) {
+        OpNode *op = _FindOp(root->children[i], t);
+        if(op) return op;
+    }
+    return NULL;
+}
+
+void test_join_projection() {
+    char result[512];
+    GraphContext *gc = _BuildGraph();
+
+    /* q is neither returned nor filtered past its own scan,
+     * materialized records carry no entity. */
+    ExecutionPlan *plan = _BuildPlan(gc, "MATCH (p:person)-[:lives]->(c:city), (q:person) WHERE q.name = 'c' RETURN p.name, c.name");
+    OpNode *product = _FindOp(plan->root, OPType_CARTESIAN_PRODUCT);
+    assert(product);
+    assert(((CartesianProduct*)product->operation)->right.width == 0);
+    _CollectPairs(plan, result);
+    assert(strcmp(result, "a-x,b-x,c-y") == 0);
+    ExecutionPlanFree(plan);
+
+    /* Filtered across streams, q is captured. */
+    plan = _BuildPlan(gc, "MATCH (p:person)-[:lives]->(c:city), (q:person) WHERE q.rank > p.rank RETURN p.name, c.name");
+    product = _FindOp(plan->root, OPType_CARTESIAN_PRODUCT);
+    assert(((CartesianProduct*)product->operation)->right.width == 1);
+    _CollectPairs(plan, result);
+    assert(strcmp(result, "a-x,a-x,b-x") == 0);
+    ExecutionPlanFree(plan);
+
+    GraphContext_Free(gc);
+
+    /* Joined streams' edges are captured by neither. */
+    gc = _BuildDenseGraph();
+    plan = _BuildPlan(gc, "MATCH (p:person)-[:knows]->(m:person)-[:knows]->(q:person) WHERE p.name = 'p1' AND q.name = 'p2' AND m.rank < 4 RETURN m.name, q.name");
+    OpNode *join = _FindOp(plan->root, OPType_HASH_JOIN);
+    assert(join);
+    MaterializedStream *build = &((HashJoin*)join->operation)->build;
+    for(int i = 0; i < build->width; i++) assert(build->slots[i] < plan->graph->node_count);
+    _CollectPairs(plan, result);
+    assert(strcmp(result, "p0-p2,p3-p2") == 0);
+    ExecutionPlanFree(plan);
+
+    /* Searching stops once LIMIT is reached. */
+    assert(_RunQuery(gc, "MATCH (p:person) RETURN p.name, p.name LIMIT 3", "Node By Label Scan", result) == 1);
+    assert(strcmp(result, "p0-p0,p1-p1,p2-p2") == 0);
+
+    GraphContext_Free(gc);
+}
+
+void test_join_reuse() {
+    char first[512];
+    char second[512];
+    GraphContext *gc = _BuildDenseGraph();
+
+    /* Build side is materialized again by each execution. */
+    ExecutionPlan *plan = _BuildPlan(gc, "MATCH (p:person)-[:knows]->(m:person)-[:knows]->(q:person) WHERE p.name = 'p1' AND q.name = 'p2' AND m.rank < 4 RETURN m.name, q.name");
+    _CollectPairs(plan, first);
+    ExecutionPlan_Reset(plan, NULL);
+    _CollectPairs(plan, second);
+    assert(strcmp(first, "p0-p2,p3-p2") == 0);
+    assert(strcmp(first, second) == 0);
+
+    ExecutionPlanFree(plan);
+    GraphContext_Free(gc);
+}
+
+GraphContext *_BuildCyclicGraph() {
+    GraphContext *gc = NewGraphContext("cyclic");
+
+    /* Triangles a-b-c, b-c-d and a-b-x, cycle b-d-b,
+     * a likes b once and c twice, d likes itself. */
+    Node *a = _AddNode(gc, "person", 2, "name", SI_StringValC("a"), "rank", SI_DoubleVal(1));
+    Node *b = _AddNode(gc, "person", 2, "name", SI_StringValC("b"), "rank", SI_DoubleVal(2));
+    Node *c = _AddNode(gc, "person", 2, "name", SI_StringValC("c"), "rank", SI_DoubleVal(3));
+    Node *d = _AddNode(gc, "person", 2, "name", SI_StringValC("d"), "rank", SI_DoubleVal(4));
+    Node *x = _AddNode(gc, "city", 2, "name", SI_StringValC("x"), "rank", SI_DoubleVal(1));
+    _AddEdge(gc, a, b, "knows");
+    _AddEdge(gc, b, c, "knows");
+    _AddEdge(gc, a, c, "knows");
+    _AddEdge(gc, c, d, "knows");
+    _AddEdge(gc, b, d, "knows");
+    _AddEdge(gc, d, b, "knows");
+    _AddEdge(gc, a, x, "knows");
+    _AddEdge(gc, b, x, "knows");
+    _AddEdge(gc, a, b, "likes");
+    _AddEdge(gc, a, c, "likes");
+    _AddEdge(gc, a, c, "likes");
+    _AddEdge(gc, d, d, "likes");
+    return gc;
+}
+
+void test_multiway_join() {
+    char result[512];
+    GraphContext *gc = _BuildCyclicGraph();
+
+    /* Triangle, closing edge is no longer dropped. */
+    assert(_RunQuery(gc, "MATCH (x)-[:knows]->(y)-[:knows]->(z), (x)-[:knows]->(z) RETURN x.name, z.name", "Multiway Join", result) == 1);
+    assert(strcmp(result, "a-c,a-x,b-d") == 0);
+
+    assert(_RunQuery(gc, "MATCH (x:person)-[:knows]->(y:person)-[:knows]->(z:person), (x)-[:knows]->(z) RETURN x.name, z.name", "Expand All", result) == 0);
+    assert(strcmp(result, "a-c,b-d") == 0);
+
+    /* Cycle without an entry node. */
+    assert(_RunQuery(gc, "MATCH (x)-[:knows]->(y)-[:knows]->(x) RETURN x.name, y.name", "Multiway Join", result) == 1);
+    assert(strcmp(result, "b-d,d-b") == 0);
+
+    /* Parallel edges, each matched separately. */
+    assert(_RunQuery(gc, "MATCH (x)-[:knows]->(y), (x)-[:likes]->(y) RETURN x.name, y.name", "Multiway Join", result) == 1);
+    assert(strcmp(result, "a-b,a-c,a-c") == 0);
+
+    /* Filter is embedded within join. */
+    assert(_RunQuery(gc, "MATCH (x:person)-[:knows]->(y:person)-[:knows]->(z:person), (x)-[:knows]->(z) WHERE x.rank = 2 RETURN x.name, z.name", "Filter", result) == 0);
+    assert(strcmp(result, "b-d") == 0);
+
+    /* Cyclic and acyclic patterns combined. */
+    assert(_RunQuery(gc, "MATCH (x:person)-[:knows]->(y:person)-[:knows]->(x), (c:city) RETURN x.name, c.name", "Cartesian Product", result) == 1);
+    assert(strcmp(result, "b-x,d-x") == 0);
+
+    /* Edges hanging off a cycle are matched by the join as well. */
+    assert(_RunQuery(gc, "MATCH (x)-[:knows]->(y)-[:knows]->(x), (x)-[:knows]->(c:city) RETURN x.name, y.name", "Multiway Join", result) == 1);
+    assert(strcmp(result, "b-d") == 0);
+
+    /* Self loops are probed once their node is bound. */
+    assert(_RunQuery(gc, "MATCH (x)-[:likes]->(x) RETURN x.name, x.name", "Expand Into", result) == 1);
+    assert(strcmp(result, "d-d") == 0);
+
+    assert(_RunQuery(gc, "MATCH (x)-[:likes]->(x), (x)-[:knows]->(y) RETURN x.name, y.name", "Expand Into", result) == 1);
+    assert(strcmp(result, "d-b") == 0);
+
+    GraphContext_Free(gc);
+}
+
+void test_multiway_join_reuse() {
+    char first[512];
+    char second[512];
+    GraphContext *gc = _BuildCyclicGraph();
+
+    ExecutionPlan *plan = _BuildPlan(gc, "MATCH (x)-[:knows]->(y)-[:knows]->(z), (x)-[:knows]->(z) RETURN x.name, z.name");
+    _CollectPairs(plan, first);
+    ExecutionPlan_Reset(plan, NULL);
+    _CollectPairs(plan, second);
+    assert(strcmp(first, "a-c,a-x,b-d") == 0);
+    assert(strcmp(first, second) == 0);
+
+    ExecutionPlanFree(plan);
+    GraphContext_Free(gc);
+}
+
+int main(int argc, char **argv) {
+    InitGroupCache();
+    test_parse_patterns();
+    test_cartesian_product();
+    test_traversal_order();
+    test_hash_join();
+    test_join_aggregation();
+    test_join_projection();
+    test_join_reuse();
+    test_multiway_join();
+    test_multiway_join_reuse();
+    printf("PASS!\n");
+    return 0;
+}
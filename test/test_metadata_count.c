@@ -0,0 +1,218 @@
+#include <stdio.h>
+#include <string.h>
+#include "assert.h"
+#include "../src/value.h"
+#include "../src/graph/node.h"
+#include "../src/graph/edge.h"
+#include "../src/query_executor.h"
+#include "../src/hexastore/triplet.h"
+#include "../src/aggregate/aggregate.h"
+#include "../src/aggregate/agg_funcs.h"
+#include "../src/grouping/group_cache.h"
+#include "../src/algorithms/shortest_path.h"
+#include "../src/graph_context/graph_context.h"
+#include "../src/execution_plan/execution_plan.h"
+#include "graph_fixture.h"
+
+GraphContext *_BuildGraph() {
+    GraphContext *gc = NewGraphContext("social");
+
+    /* a, b live in x, c lives in y, z is empty,
+     * a knows b and c, b knows c, a follows b twice. */
+    Node *a = _AddNode(gc, "person", 1, "name", SI_StringValC("a"));
+    Node *b = _AddNode(gc, "person", 1, "name", SI_StringValC("b"));
+    Node *c = _AddNode(gc, "person", 1, "name", SI_StringValC("c"));
+    Node *x = _AddNode(gc, "city", 1, "name", SI_StringValC("x"));
+    Node *y = _AddNode(gc, "city", 1, "name", SI_StringValC("y"));
+    _AddNode(gc, "city", 1, "name", SI_StringValC("z"));
+    _AddEdge(gc, a, x, "lives");
+    _AddEdge(gc, b, x, "lives");
+    _AddEdge(gc, c, y, "lives");
+    _AddEdge(gc, a, b, "knows");
+    _AddEdge(gc, a, c, "knows");
+    _AddEdge(gc, b, c, "knows");
+    _AddEdge(gc, a, b, "follows");
+    _AddEdge(gc, a, b, "follows");
+    return gc;
+}
+
+/* Runs query, returns its single count, -1 if it produced no group,
+ * counted is set if the count was answered from metadata. */
+int _Count(GraphContext *gc, const char *query, int *counted) {
+    char *errMsg = NULL;
+    AST_QueryExpressionNode *ast = ParseQuery(query, strlen(query), &errMsg);
+    assert(ast);
+    ExecutionPlan *plan = NewExecutionPlan(NULL, gc, ast);
+
+    char *strPlan = ExecutionPlanPrint(plan);
+    *counted = (strstr(strPlan, "Metadata Count") != NULL);
+    if(*counted) assert(strstr(strPlan, "Aggregate") == NULL);
+    free(strPlan);
+
+    ResultSet *set = ExecutionPlan_Execute(plan);
+
+    int count = -1;
+    char *key;
+    Group *group;
+    CacheGroupIterator *iter = CacheGroupIter();
+    while(CacheGroupIterNext(iter, &key, &group) != 0) {
+        assert(count == -1);
+        AggCtx *ctx;
+        Vector_Get(group->aggregationFunctions, 0, &ctx);
+        Agg_Finalize(ctx);
+        count = ctx->result.doubleval;
+    }
+    CacheGroupIterator_Free(iter);
+
+    FreeGroupCache();
+    InitGroupCache();
+    ResultSet_Free(NULL, set);
+    ExecutionPlanFree(plan);
+    return count;
+}
+
+void test_step_repeat() {
+    AggCtx *ctx = Agg_CountFunc();
+    SIValue item = SI_IntVal(1);
+    Agg_Step(ctx, &item, 1);
+    Agg_StepRepeat(ctx, &item, 1, 41);
+    Agg_Finalize(ctx);
+    assert(ctx->result.doubleval == 42);
+    AggCtx_Free(ctx);
+
+    /* Functions without a repeated step, step repeatedly. */
+    ctx = Agg_SumFunc();
+    item = SI_IntVal(2);
+    Agg_StepRepeat(ctx, &item, 1, 3);
+    Agg_Finalize(ctx);
+    assert(ctx->result.doubleval == 6);
+    AggCtx_Free(ctx);
+}
+
+void test_count_nodes() {
+    int counted;
+    GraphContext *gc = _BuildGraph();
+
+    assert(_Count(gc, "MATCH (n:person) RETURN count(n)", &counted) == 3 && counted);
+    assert(_Count(gc, "MATCH (n:city) RETURN count(*)", &counted) == 3 && counted);
+    assert(_Count(gc, "MATCH (n) RETURN count(n) AS nodes", &counted) == 6 && counted);
+    assert(_Count(gc, "MATCH (n:country) RETURN count(n)", &counted) == -1 && counted);
+
+    /* Filtered nodes and properties are counted by enumeration. */
+    assert(_Count(gc, "MATCH (n:person) WHERE n.name != 'a' RETURN count(n)", &counted) == 2 && !counted);
+    assert(_Count(gc, "MATCH (n:person) RETURN count(n.name)", &counted) == 3 && !counted);
+
+    GraphContext_Free(gc);
+}
+
+void test_count_edges() {
+    int counted;
+    GraphContext *gc = _BuildGraph();
+
+    assert(_Count(gc, "MATCH (a)-[:knows]->(b) RETURN count(*)", &counted) == 3 && counted);
+    assert(_Count(gc, "MATCH (a:person)-[e:lives]->(c:city) RETURN count(e)", &counted) == 3 && counted);
+    assert(_Count(gc, "MATCH (a:city)-[:lives]->(c) RETURN count(*)", &counted) == -1 && counted);
+    assert(_Count(gc, "MATCH (a)-[]->(b) RETURN count(*)", &counted) == 8 && counted);
+
+    /* Variable length edges are enumerated. */
+    assert(_Count(gc, "MATCH (a)-[:knows*1..2]->(b) RETURN count(*)", &counted) == 3 && !counted);
+
+    GraphContext_Free(gc);
+}
+
+void test_count_degree() {
+    int counted;
+    GraphContext *gc = _BuildGraph();
+
+    /* Edges at each match of the filtered end. */
+    assert(_Count(gc, "MATCH (a {name: 'a'})-[:follows]->() RETURN count(*)", &counted) == 2 && counted);
+    assert(_Count(gc, "MATCH (a:person {name: 'a'})-[:knows]->(b) RETURN count(b)", &counted) == 2 && counted);
+    assert(_Count(gc, "MATCH (a)-[:knows]->(c:person) WHERE c.name = 'c' RETURN count(*)", &counted) == 2 && counted);
+    assert(_Count(gc, "MATCH (a:person)-[]->(b) WHERE a.name != 'c' RETURN count(*)", &counted) == 7 && counted);
+    assert(_Count(gc, "MATCH (a {name: 'c'})-[:knows]->() RETURN count(*)", &counted) == -1 && counted);
+
+    /* Counts agree with enumeration. */
+    assert(_Count(gc, "MATCH (a:person {name: 'a'})-[:knows]->(b) RETURN count(b.name)", &counted) == 2 && !counted);
+
+    /* Labeled or filtered far ends are enumerated. */
+    assert(_Count(gc, "MATCH (a {name: 'a'})-[:knows]->(b:person) RETURN count(*)", &counted) == 2 && !counted);
+    assert(_Count(gc, "MATCH (a {name: 'a'})-[:knows]->(b) WHERE b.name = 'b' RETURN count(*)", &counted) == 1 && !counted);
+
+    GraphContext_Free(gc);
+}
+
+/* Runs query, returns the number of records it produced,
+ * op, if given, must take part in the query's plan. */
+int _Rows(GraphContext *gc, const char *query, const char *op) {
+    char *errMsg = NULL;
+    AST_QueryExpressionNode *ast = ParseQuery(query, strlen(query), &errMsg);
+    assert(ast);
+    ExecutionPlan *plan = NewExecutionPlan(NULL, gc, ast);
+
+    char *strPlan = ExecutionPlanPrint(plan);
+    if(op) assert(strstr(strPlan, op) != NULL);
+    free(strPlan);
+
+    ResultSet *set = ExecutionPlan_Execute(plan);
+    int rows = Vector_Size(set->records);
+    ResultSet_Free(NULL, set);
+    ExecutionPlanFree(plan);
+    return rows;
+}
+
+void test_remove_edge() {
+    int counted;
+    GraphContext *gc = NewGraphContext("social");
+    Node *a = _AddNode(gc, "person", 1, "name", SI_StringValC("a"));
+    Node *b = _AddNode(gc, "person", 1, "name", SI_StringValC("b"));
+    Node *c = _AddNode(gc, "person", 1, "name", SI_StringValC("c"));
+    _AddEdge(gc, a, b, "knows");
+    Edge *bc = _AddEdge(gc, b, c, "knows");
+    Edge *ac = _AddEdge(gc, a, c, "knows");
+    _AddEdge(gc, a, c, "follows");
+
+    Edge **path;
+    assert(ShortestPath(a, c, "knows", SHORTEST_PATH_UNBOUNDED, &path) == 1);
+    free(path);
+
+    GraphContext_RemoveEdge(gc, ac);
+
+    /* a reaches c through b only. */
+    assert(ShortestPath(a, c, "knows", SHORTEST_PATH_UNBOUNDED, &path) == 2);
+    assert(path[0]->dest == b && path[1] == bc);
+    free(path);
+    double cost;
+    assert(WeightedShortestPath(a, c, "knows", "weight", SHORTEST_PATH_UNBOUNDED, &cost, &path) == -1);
+
+    /* Stores and adjacency lists no longer hold the edge. */
+    char id[32];
+    snprintf(id, 32, "%ld", ac->id);
+    assert(Store_Get(GraphContext_GetStore(gc, STORE_EDGE, NULL), id) == NULL);
+    assert(Store_Get(GraphContext_GetStore(gc, STORE_EDGE, "knows"), id) == NULL);
+    assert(Vector_Size(a->outgoingEdges) == 2);
+    assert(Vector_Size(c->incomingEdges) == 2);
+    assert(GraphContext_EdgeCount(gc, NULL, "knows", NULL) == 2);
+
+    /* Neither counts nor traversals see it. */
+    assert(_Count(gc, "MATCH (x)-[:knows]->(y) RETURN count(*)", &counted) == 2 && counted);
+    assert(_Count(gc, "MATCH (x {name: 'a'})-[:knows]->() RETURN count(*)", &counted) == 1 && counted);
+    assert(_Rows(gc, "MATCH (x)-[:knows]->(y) RETURN x.name, y.name", "Edge By Type Scan") == 2);
+    assert(_Rows(gc, "MATCH (x:person {name: 'a'})-[:knows]->(y) RETURN y.name", NULL) == 1);
+    assert(_Rows(gc, "MATCH (x {name: 'a'})-[:knows]->(y {name: 'c'}) RETURN y.name", NULL) == 0);
+    assert(_Rows(gc, "MATCH (x {name: 'a'})-[]->(y {name: 'c'}) RETURN y.name", NULL) == 1);
+    assert(_Rows(gc, "MATCH (x {name: 'a'})-[:knows*1..2]->(y) RETURN y.name", NULL) == 2);
+
+    GraphContext_Free(gc);
+}
+
+int main(int argc, char **argv) {
+    InitGroupCache();
+    Agg_RegisterFuncs();
+    test_step_repeat();
+    test_count_nodes();
+    test_count_edges();
+    test_count_degree();
+    test_remove_edge();
+    printf("PASS!\n");
+    return 0;
+}
@@ -34,6 +34,15 @@ void test_node_props() {
 	val = GraphEntity_Get_Property((GraphEntity*)node, "fake");
 	assert(val == PROPERTY_NOTFOUND);
 
+	/* Hinted lookups update their hint. */
+	int hint = 0;
+	val = GraphEntity_Get_PropertyHint((GraphEntity*)node, "block", &hint);
+	assert(val->intval == 10 && hint == 1);
+	val = GraphEntity_Get_PropertyHint((GraphEntity*)node, "block", &hint);
+	assert(val->intval == 10 && hint == 1);
+	val = GraphEntity_Get_PropertyHint((GraphEntity*)node, "fake", &hint);
+	assert(val == PROPERTY_NOTFOUND && hint == 1);
+
 	FreeNode(node);
 }
 
@@ -52,10 +61,83 @@ void test_node_edges() {
 	FreeEdge(edge);
 }
 
+void test_node_sorted_edges() {
+	Node *a = NewNode(1l, "person");
+	Node *b = NewNode(2l, "person");
+	Node *c = NewNode(3l, "person");
+	Edge *edges[5] = {NewEdge(4l, a, c, "knows"),
+					  NewEdge(5l, a, b, "likes"),
+					  NewEdge(6l, a, b, "knows"),
+					  NewEdge(7l, a, c, "likes"),
+					  NewEdge(8l, a, c, "knows")};
+	for(int i = 0; i < 5; i++) Node_ConnectNode(a, edges[i]->dest, edges[i]);
+
+	/* Edges are appended, then sorted by type then destination ID,
+	 * parallel edges by insertion. */
+	assert(a->outgoingSorted == 0);
+	Node_SortEdges(a);
+	assert(a->outgoingSorted == 5);
+	long int expected[5] = {6l, 4l, 8l, 5l, 7l};
+	for(int i = 0; i < 5; i++) {
+		Edge *e;
+		Vector_Get(a->outgoingEdges, i, &e);
+		assert(e->id == expected[i]);
+	}
+
+	int first;
+	assert(Node_EdgeRun(a, 1, "likes", &first) == 2 && first == 3);
+	assert(Node_EdgeRun(a, 1, "hates", &first) == 0);
+	assert(Node_EdgeRun(c, 0, "knows", &first) == 2 && first == 0);
+
+	Vector *found = NewVector(Edge*, 0);
+	assert(Node_GetEdges(a, c, "knows", found) == 2);
+	assert(Node_GetEdges(a, b, NULL, found) == 2);
+	assert(Node_GetEdges(b, a, NULL, found) == 0);
+	assert(Node_GetEdges(a, c, "hates", found) == 0);
+	assert(Vector_Size(found) == 4);
+
+	/* Edges connected past the sorted prefix are merged in on the next probe. */
+	Edge *later[3] = {NewEdge(9l, a, b, "likes"),
+					  NewEdge(10l, a, b, "knows"),
+					  NewEdge(11l, a, c, "hates")};
+	for(int i = 0; i < 3; i++) Node_ConnectNode(a, later[i]->dest, later[i]);
+	assert(a->outgoingSorted == 5);
+	assert(Node_EdgeRun(a, 1, "hates", &first) == 1 && first == 0);
+	assert(Node_EdgeRun(a, 1, "likes", &first) == 3 && first == 5);
+	assert(a->outgoingSorted == 8);
+
+	long int merged[8] = {11l, 6l, 10l, 4l, 8l, 5l, 9l, 7l};
+	for(int i = 0; i < 8; i++) {
+		Edge *e;
+		Vector_Get(a->outgoingEdges, i, &e);
+		assert(e->id == merged[i]);
+	}
+
+	found->top = 0;
+	assert(Node_GetEdges(a, b, "knows", found) == 2);
+
+	/* Disconnecting merges pending edges as well. */
+	Edge *e = NewEdge(12l, a, b, "knows");
+	Node_ConnectNode(a, b, e);
+	Node_DisconnectNode(a, b, later[1]);
+	assert(a->outgoingSorted == 8 && Vector_Size(a->outgoingEdges) == 8);
+	found->top = 0;
+	assert(Node_GetEdges(a, b, "knows", found) == 2);
+	Vector_Free(found);
+
+	for(int i = 0; i < 5; i++) FreeEdge(edges[i]);
+	for(int i = 0; i < 3; i++) FreeEdge(later[i]);
+	FreeEdge(e);
+	FreeNode(a);
+	FreeNode(b);
+	FreeNode(c);
+}
+
 int main(int argc, char **argv) {
 	test_node_creation();
 	test_node_props();
 	test_node_edges();
+	test_node_sorted_edges();
 	printf("PASS!");
     return 0;
 }
\ No newline at end of file
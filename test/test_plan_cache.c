@@ -0,0 +1,243 @@
+#include <stdio.h>
+#include <string.h>
+#include "assert.h"
+#include "../src/value.h"
+#include "../src/util/prng.h"
+#include "../src/graph/node.h"
+#include "../src/graph/edge.h"
+#include "../src/query_executor.h"
+#include "../src/hexastore/triplet.h"
+#include "../src/grouping/group_cache.h"
+#include "../src/graph_context/graph_context.h"
+#include "../src/execution_plan/plan_cache.h"
+#include "../src/execution_plan/ops/op_produce_results.h"
+#include "graph_fixture.h"
+
+/* Creates a minimal plan, consisting of a single operation. */
+ExecutionPlan *_NewDummyPlan() {
+    ExecutionPlan *plan = calloc(1, sizeof(ExecutionPlan));
+    plan->root = NewOpNode((OpBase*)NewProduceResults(NULL, NULL, NULL));
+    return plan;
+}
+
+int _RecordCount(ExecutionPlan *plan) {
+    ResultSet *set = ExecutionPlan_Execute(plan);
+    int count = Vector_Size(set->records);
+    ResultSet_Free(NULL, set);
+    return count;
+}
+
+void test_normalize_query() {
+    char *q = PlanCache_NormalizeQuery("  MATCH   (a:actor)\n\tRETURN  a.name  ");
+    assert(strcmp(q, "MATCH (a:actor) RETURN a.name") == 0);
+    free(q);
+
+    /* Whitespace within string literals is kept. */
+    q = PlanCache_NormalizeQuery("MATCH (a) WHERE a.name = 'Tom  Hanks'   RETURN a");
+    assert(strcmp(q, "MATCH (a) WHERE a.name = 'Tom  Hanks' RETURN a") == 0);
+    free(q);
+
+    q = PlanCache_NormalizeQuery("WHERE a.name = \"x \\\"  y\"  RETURN a");
+    assert(strcmp(q, "WHERE a.name = \"x \\\"  y\" RETURN a") == 0);
+    free(q);
+}
+
+void test_lru_eviction() {
+    PlanCache *cache = NewPlanCache(2);
+    ExecutionPlan *a = _NewDummyPlan();
+    ExecutionPlan *b = _NewDummyPlan();
+    ExecutionPlan *c = _NewDummyPlan();
+
+    assert(PlanCache_Get(cache, "a") == NULL);
+    assert(PlanCache_Add(cache, "a", a));
+    assert(PlanCache_Add(cache, "b", b));
+    assert(PlanCache_Get(cache, "a") == a);
+    assert(PlanCache_Get(cache, "b") == b);
+
+    /* a is least recently used, evicted first. */
+    assert(PlanCache_Add(cache, "c", c));
+    assert(cache->size == 2);
+    assert(PlanCache_Get(cache, "a") == NULL);
+    assert(PlanCache_Get(cache, "b") == b);
+    assert(PlanCache_Get(cache, "c") == c);
+
+    PlanCache_Clear(cache);
+    assert(cache->size == 0);
+    assert(PlanCache_Get(cache, "b") == NULL);
+    assert(PlanCache_Get(cache, "c") == NULL);
+
+    PlanCache_Free(cache);
+}
+
+void test_plan_reuse() {
+    GraphContext *gc = NewGraphContext("imdb");
+    _AddNode(gc, "actor", 1, "name", SI_StringValC("Tom"));
+    _AddNode(gc, "actor", 1, "name", SI_StringValC("Meg"));
+    _AddNode(gc, "movie", 1, "title", SI_StringValC("Big"));
+
+    char *errMsg = NULL;
+    const char *query = "MATCH (a:actor) RETURN a.name";
+    AST_QueryExpressionNode *ast = ParseQuery(query, strlen(query), &errMsg);
+    assert(ast);
+
+    ExecutionPlan *plan = NewExecutionPlan(NULL, gc, ast);
+    assert(PlanCache_Add(gc->plan_cache, query, plan));
+    assert(_RecordCount(plan) == 2);
+
+    /* Reset plan produces the same result. */
+    assert(PlanCache_Get(gc->plan_cache, query) == plan);
+    ExecutionPlan_Reset(plan, NULL);
+    assert(_RecordCount(plan) == 2);
+
+    /* Data added to an existing label is picked up by cached plans. */
+    _AddNode(gc, "actor", 1, "name", SI_StringValC("Tim"));
+    assert(PlanCache_Get(gc->plan_cache, query) == plan);
+    ExecutionPlan_Reset(plan, NULL);
+    assert(_RecordCount(plan) == 3);
+
+    /* Planning against an unknown label neither introduces it nor invalidates cached plans. */
+    GraphMemoryUsage before, after;
+    GraphContext_MemUsage(gc, &before);
+    const char *unknown = "MATCH (w:writer) RETURN w.name";
+    ExecutionPlan *writers = NewExecutionPlan(NULL, gc, ParseQuery(unknown, strlen(unknown), &errMsg));
+    assert(PlanCache_Add(gc->plan_cache, unknown, writers));
+    assert(_RecordCount(writers) == 0);
+    assert(GraphContext_GetLabelBitmap(gc, "writer") == NULL);
+    assert(GraphContext_LabelCardinality(gc, "writer") == 0);
+    assert(PlanCache_Get(gc->plan_cache, query) == plan);
+    GraphContext_MemUsage(gc, &after);
+    assert(after.label_bitmaps == before.label_bitmaps);
+
+    /* Same goes for unknown relationship types, scanned as empty. */
+    const char *untyped = "MATCH (a)-[:wrote]->(b) RETURN a.name";
+    ExecutionPlan *wrote = NewExecutionPlan(NULL, gc, ParseQuery(untyped, strlen(untyped), &errMsg));
+    char *strPlan = ExecutionPlanPrint(wrote);
+    assert(strstr(strPlan, "Edge By Type Scan"));
+    free(strPlan);
+    assert(_RecordCount(wrote) == 0);
+    ExecutionPlan_Reset(wrote, NULL);
+    assert(_RecordCount(wrote) == 0);
+    ExecutionPlanFree(wrote);
+    assert(GraphContext_GetTypeStore(gc, "wrote") == NULL);
+    assert(GraphContext_TypeCardinality(gc, "wrote") == 0);
+    assert(PlanCache_Get(gc->plan_cache, query) == plan);
+    assert(PlanCache_Get(gc->plan_cache, unknown) == writers);
+    GraphContext_MemUsage(gc, &after);
+    assert(after.type_stores == before.type_stores);
+
+    /* Introducing a new label invalidates cached plans. */
+    _AddNode(gc, "director", 1, "name", SI_StringValC("Penny"));
+    assert(PlanCache_Get(gc->plan_cache, query) == NULL);
+    assert(PlanCache_Get(gc->plan_cache, unknown) == NULL);
+
+    GraphContext_Free(gc);
+}
+
+void test_expand_plan_reuse() {
+    GraphContext *gc = NewGraphContext("imdb");
+    Node *tom = _AddNode(gc, "actor", 1, "name", SI_StringValC("Tom"));
+    Node *meg = _AddNode(gc, "actor", 1, "name", SI_StringValC("Meg"));
+    Node *big = _AddNode(gc, "movie", 1, "title", SI_StringValC("Big"));
+    Node *mail = _AddNode(gc, "movie", 1, "title", SI_StringValC("Mail"));
+    _AddEdge(gc, tom, big, "act");
+    _AddEdge(gc, tom, mail, "act");
+    _AddEdge(gc, meg, mail, "act");
+
+    char *errMsg = NULL;
+    const char *query = "MATCH (a:actor)-[:act]->(m:movie) WHERE m.title = 'Mail' RETURN a.name";
+    AST_QueryExpressionNode *ast = ParseQuery(query, strlen(query), &errMsg);
+    assert(ast);
+
+    ExecutionPlan *plan = NewExecutionPlan(NULL, gc, ast);
+    assert(PlanCache_Add(gc->plan_cache, query, plan));
+    assert(_RecordCount(plan) == 2);
+
+    for(int i = 0; i < 3; i++) {
+        ExecutionPlan_Reset(plan, NULL);
+        assert(_RecordCount(plan) == 2);
+    }
+
+    GraphContext_Free(gc);
+}
+
+void test_parameterized_plan_reuse() {
+    GraphContext *gc = NewGraphContext("imdb");
+    _AddNode(gc, "actor", 1, "name", SI_StringValC("Tom"));
+    _AddNode(gc, "actor", 1, "name", SI_StringValC("Meg"));
+
+    char *errMsg = NULL;
+    const char *query = "MATCH (a:actor) WHERE a.name = $name RETURN a.name";
+    AST_QueryExpressionNode *ast = ParseQuery(query, strlen(query), &errMsg);
+    assert(ast);
+
+    ExecutionPlan *plan = NewExecutionPlan(NULL, gc, ast);
+    assert(PlanCache_Add(gc->plan_cache, query, plan));
+    assert(strcmp(ExecutionPlan_UnboundParam(plan), "name") == 0);
+    assert(!ExecutionPlan_BindParam(plan, "age", SI_DoubleVal(30)));
+
+    assert(ExecutionPlan_BindParam(plan, "name", SI_StringValC("Tom")));
+    assert(ExecutionPlan_UnboundParam(plan) == NULL);
+    assert(_RecordCount(plan) == 1);
+
+    /* Same plan, different value. */
+    ExecutionPlan_Reset(plan, NULL);
+    assert(ExecutionPlan_UnboundParam(plan) != NULL);
+    ExecutionPlan_BindParam(plan, "name", SI_StringValC("Meg"));
+    assert(_RecordCount(plan) == 1);
+
+    ExecutionPlan_Reset(plan, NULL);
+    ExecutionPlan_BindParam(plan, "name", SI_StringValC("Tim"));
+    assert(_RecordCount(plan) == 0);
+
+    GraphContext_Free(gc);
+}
+
+void test_outdated_plan() {
+    GraphContext *gc = NewGraphContext("imdb");
+    Node *tom = _AddNode(gc, "actor", 1, "name", SI_StringValC("Tom"));
+    Node *meg = _AddNode(gc, "actor", 1, "name", SI_StringValC("Meg"));
+    Node *big = _AddNode(gc, "movie", 1, "title", SI_StringValC("Big"));
+    _AddEdge(gc, tom, big, "act");
+    _AddEdge(gc, meg, big, "act");
+
+    char *errMsg = NULL;
+    const char *query = "MATCH (a:actor)-[:act]->(m:movie) RETURN a.name";
+    ExecutionPlan *plan = NewExecutionPlan(NULL, gc, ParseQuery(query, strlen(query), &errMsg));
+    assert(PlanCache_Add(gc->plan_cache, query, plan));
+    assert(!ExecutionPlan_Outdated(plan, gc));
+
+    /* Plans hold on while cardinalities remain within a factor of those planned with. */
+    Node *tim = _AddNode(gc, "actor", 1, "name", SI_StringValC("Tim"));
+    _AddEdge(gc, tim, big, "act");
+    _AddEdge(gc, tim, big, "act");
+    assert(!ExecutionPlan_Outdated(plan, gc));
+
+    /* Past it, e.g. following bulk ingestion, plans are rebuilt. */
+    for(int i = 0; i < 4; i++) _AddNode(gc, "actor", 1, "name", SI_StringValC("Extra"));
+    assert(ExecutionPlan_Outdated(plan, gc));
+    PlanCache_Remove(gc->plan_cache, query);
+    assert(PlanCache_Get(gc->plan_cache, query) == NULL);
+    assert(gc->plan_cache->size == 0);
+
+    plan = NewExecutionPlan(NULL, gc, ParseQuery(query, strlen(query), &errMsg));
+    assert(!ExecutionPlan_Outdated(plan, gc));
+
+    /* Relationship types are tracked as well. */
+    for(int i = 0; i < 5; i++) _AddEdge(gc, meg, big, "act");
+    assert(ExecutionPlan_Outdated(plan, gc));
+    ExecutionPlanFree(plan);
+
+    GraphContext_Free(gc);
+}
+
+int main(int argc, char **argv) {
+    InitGroupCache();
+    test_normalize_query();
+    test_lru_eviction();
+    test_plan_reuse();
+    test_expand_plan_reuse();
+    test_parameterized_plan_reuse();
+    test_outdated_plan();
+    printf("PASS!");
+    return 0;
+}
@@ -6,7 +6,8 @@
 size_t Record_ToString(const Record *record, char **record_str);
 
 void test_record_to_string () {
-    Record *record = NewRecord(6);    
+    Arena *arena = NewArena(ARENA_DEFAULT_BLOCK_SIZE);
+    Record *record = NewRecord(arena, 5);
     SIValue v_string = SI_StringValC("Hello");
     SIValue v_int = SI_IntVal(-24);
     SIValue v_uint = SI_UintVal(24);
@@ -14,12 +15,12 @@ void test_record_to_string () {
     SIValue v_null = SI_NullVal();
     SIValue v_bool = SI_BoolVal(1);
 
-    Vector_Push(record->values, &v_string);
-    Vector_Push(record->values, &v_int);
-    Vector_Push(record->values, &v_uint);
-    // Vector_Push(record->values, &v_float);
-    Vector_Push(record->values, &v_null);
-    Vector_Push(record->values, &v_bool);
+    record->values[0] = &v_string;
+    record->values[1] = &v_int;
+    record->values[2] = &v_uint;
+    // record->values[3] = &v_float;
+    record->values[3] = &v_null;
+    record->values[4] = &v_bool;
 
     char *record_str;
     size_t record_str_len = Record_ToString(record, &record_str);
@@ -28,7 +29,7 @@ void test_record_to_string () {
     assert(record_str_len == 24);
     
     free(record_str);
-    Record_Free(record);
+    Arena_Free(arena);
 }
 
 int main(int argc, char **argv) {
@@ -0,0 +1,333 @@
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include "assert.h"
+#include "../src/graph/node.h"
+#include "../src/graph/edge.h"
+#include "../src/algorithms/shortest_path.h"
+
+#define EPSILON 1e-9
+
+/* Snowflake ids are rate limited, use a plain counter. */
+long int _next_id = 1;
+long int _NextId() {
+    return _next_id++;
+}
+
+Edge *_Connect(Node *src, Node *dest, const char *relation) {
+    Edge *e = NewEdge(_NextId(), src, dest, relation);
+    Node_ConnectNode(src, dest, e);
+    return e;
+}
+
+void _SetWeight(Edge *e, SIValue weight) {
+    char **keys = malloc(sizeof(char*));
+    SIValue *values = malloc(sizeof(SIValue));
+    keys[0] = strdup("w");
+    values[0] = weight;
+    Edge_Add_Properties(e, 1, keys, values);
+    free(keys);
+    free(values);
+}
+
+Edge *_ConnectWeighted(Node *src, Node *dest, double weight) {
+    Edge *e = _Connect(src, dest, "road");
+    _SetWeight(e, SI_DoubleVal(weight));
+    return e;
+}
+
+/* Least cost from src to every node, computed by Bellman-Ford. */
+void _BellmanFord(Node **nodes, int nodeCount, Edge **edges, int edgeCount, Node *src, double *dist) {
+    int *srcIdx = malloc(sizeof(int) * edgeCount);
+    int *destIdx = malloc(sizeof(int) * edgeCount);
+    for(int i = 0; i < edgeCount; i++) {
+        for(int j = 0; j < nodeCount; j++) {
+            if(nodes[j] == edges[i]->src) srcIdx[i] = j;
+            if(nodes[j] == edges[i]->dest) destIdx[i] = j;
+        }
+    }
+
+    for(int i = 0; i < nodeCount; i++) dist[i] = (nodes[i] == src) ? 0 : -1;
+
+    int updated = 1;
+    while(updated) {
+        updated = 0;
+        for(int i = 0; i < edgeCount; i++) {
+            int s = srcIdx[i];
+            int d = destIdx[i];
+            if(dist[s] < 0) continue;
+            double w = Edge_Get_Property(edges[i], "w")->doubleval;
+            if(dist[d] < 0 || dist[s] + w < dist[d]) {
+                dist[d] = dist[s] + w;
+                updated = 1;
+            }
+        }
+    }
+
+    free(srcIdx);
+    free(destIdx);
+}
+
+/* Sums path's weights. */
+double _PathCost(Edge **path, int len) {
+    double cost = 0;
+    for(int i = 0; i < len; i++) cost += Edge_Get_Property(path[i], "w")->doubleval;
+    return cost;
+}
+
+/* Checks path leads from src to dest, edge after edge. */
+void _ValidatePath(Edge **path, int len, Node *src, Node *dest) {
+    Node *n = src;
+    for(int i = 0; i < len; i++) {
+        assert(path[i]->src == n);
+        n = path[i]->dest;
+    }
+    assert(n == dest);
+}
+
+void test_shortest_path() {
+    /* a -> b -> c -> d -> e
+     * a -> x -> e (via "other")
+     * f is isolated. */
+    Node *nodes[7];
+    for(int i = 0; i < 7; i++) nodes[i] = NewNode(_NextId(), "person");
+    Node *a = nodes[0], *b = nodes[1], *c = nodes[2], *d = nodes[3];
+    Node *e = nodes[4], *x = nodes[5], *f = nodes[6];
+
+    Edge *edges[7];
+    edges[0] = _Connect(a, b, "knows");
+    edges[1] = _Connect(b, c, "knows");
+    edges[2] = _Connect(c, d, "knows");
+    edges[3] = _Connect(d, e, "knows");
+    edges[4] = _Connect(a, x, "other");
+    edges[5] = _Connect(x, e, "other");
+    edges[6] = _Connect(e, a, "knows");
+
+    Edge **path;
+    int len = ShortestPath(a, e, NULL, SHORTEST_PATH_UNBOUNDED, &path);
+    assert(len == 2);
+    _ValidatePath(path, len, a, e);
+    assert(path[0] == edges[4] && path[1] == edges[5]);
+    free(path);
+
+    /* Restricted to a single relationship type. */
+    len = ShortestPath(a, e, "knows", SHORTEST_PATH_UNBOUNDED, &path);
+    assert(len == 4);
+    _ValidatePath(path, len, a, e);
+    free(path);
+
+    /* Edges are directed. */
+    len = ShortestPath(e, d, "knows", SHORTEST_PATH_UNBOUNDED, &path);
+    assert(len == 4);
+    _ValidatePath(path, len, e, d);
+    free(path);
+
+    /* Hop limit. */
+    len = ShortestPath(a, e, "knows", 3, &path);
+    assert(len == -1 && path == NULL);
+    len = ShortestPath(a, e, "knows", 4, &path);
+    assert(len == 4);
+    free(path);
+
+    /* Unreachable and trivial paths. */
+    len = ShortestPath(a, f, NULL, SHORTEST_PATH_UNBOUNDED, &path);
+    assert(len == -1 && path == NULL);
+    len = ShortestPath(a, a, NULL, SHORTEST_PATH_UNBOUNDED, &path);
+    assert(len == 0 && path == NULL);
+
+    for(int i = 0; i < 7; i++) FreeEdge(edges[i]);
+    for(int i = 0; i < 7; i++) FreeNode(nodes[i]);
+}
+
+void test_shortest_path_grid() {
+    /* 10x10 grid, edges pointing right and down,
+     * shortest path from corner to corner spans 18 hops. */
+    int dim = 10;
+    Node *grid[10][10];
+    Vector *edges = NewVector(Edge*, 0);
+    for(int i = 0; i < dim; i++) {
+        for(int j = 0; j < dim; j++) grid[i][j] = NewNode(_NextId(), NULL);
+    }
+    for(int i = 0; i < dim; i++) {
+        for(int j = 0; j < dim; j++) {
+            Edge *e;
+            if(j + 1 < dim) {
+                e = _Connect(grid[i][j], grid[i][j+1], "r");
+                Vector_Push(edges, e);
+            }
+            if(i + 1 < dim) {
+                e = _Connect(grid[i][j], grid[i+1][j], "d");
+                Vector_Push(edges, e);
+            }
+        }
+    }
+
+    Edge **path;
+    int len = ShortestPath(grid[0][0], grid[dim-1][dim-1], NULL, SHORTEST_PATH_UNBOUNDED, &path);
+    assert(len == 2 * (dim - 1));
+    _ValidatePath(path, len, grid[0][0], grid[dim-1][dim-1]);
+    free(path);
+
+    len = ShortestPath(grid[0][3], grid[5][3], NULL, SHORTEST_PATH_UNBOUNDED, &path);
+    assert(len == 5);
+    _ValidatePath(path, len, grid[0][3], grid[5][3]);
+    free(path);
+
+    /* Moving left is impossible. */
+    len = ShortestPath(grid[0][3], grid[0][2], NULL, SHORTEST_PATH_UNBOUNDED, &path);
+    assert(len == -1);
+
+    for(int i = 0; i < Vector_Size(edges); i++) {
+        Edge *e;
+        Vector_Get(edges, i, &e);
+        FreeEdge(e);
+    }
+    Vector_Free(edges);
+    for(int i = 0; i < dim; i++) {
+        for(int j = 0; j < dim; j++) FreeNode(grid[i][j]);
+    }
+}
+
+void test_weighted_shortest_path() {
+    /* a -1-> b -1-> c -1-> d
+     * a -5-> d
+     * a -1-> c via "rail"
+     * b -> d without a weight, b -> d with a string weight. */
+    Node *nodes[5];
+    for(int i = 0; i < 5; i++) nodes[i] = NewNode(_NextId(), NULL);
+    Node *a = nodes[0], *b = nodes[1], *c = nodes[2], *d = nodes[3], *f = nodes[4];
+
+    Edge *edges[7];
+    edges[0] = _ConnectWeighted(a, b, 1);
+    edges[1] = _ConnectWeighted(b, c, 1);
+    edges[2] = _ConnectWeighted(c, d, 1);
+    edges[3] = _ConnectWeighted(a, d, 5);
+    edges[4] = _Connect(a, c, "rail");
+    _SetWeight(edges[4], SI_DoubleVal(1));
+    edges[5] = _Connect(b, d, "road");
+    edges[6] = _Connect(b, d, "road");
+    _SetWeight(edges[6], SI_StringValC(strdup("1.5")));
+
+    double cost;
+    Edge **path;
+    int len = WeightedShortestPath(a, d, NULL, "w", SHORTEST_PATH_UNBOUNDED, &cost, &path);
+    assert(len == 2 && cost == 2);
+    assert(path[0] == edges[4] && path[1] == edges[2]);
+    free(path);
+
+    /* String weights are parsed, edges without weight are skipped. */
+    len = WeightedShortestPath(a, d, "road", "w", SHORTEST_PATH_UNBOUNDED, &cost, &path);
+    assert(len == 2 && cost == 2.5);
+    assert(path[0] == edges[0] && path[1] == edges[6]);
+    free(path);
+
+    /* Cost pruning. */
+    len = WeightedShortestPath(a, d, "road", "w", 2, &cost, &path);
+    assert(len == -1 && path == NULL);
+    len = WeightedShortestPath(a, d, "road", "w", 2.5, &cost, &path);
+    assert(len == 2);
+    free(path);
+
+    len = WeightedShortestPath(a, f, NULL, "w", SHORTEST_PATH_UNBOUNDED, &cost, &path);
+    assert(len == -1 && path == NULL);
+    len = WeightedShortestPath(a, a, NULL, "w", SHORTEST_PATH_UNBOUNDED, &cost, &path);
+    assert(len == 0 && cost == 0 && path == NULL);
+
+    for(int i = 0; i < 7; i++) FreeEdge(edges[i]);
+    for(int i = 0; i < 5; i++) FreeNode(nodes[i]);
+}
+
+/* Validates Dijkstra against Bellman-Ford, from src to every node. */
+void _ValidateLeastCost(Node **nodes, int nodeCount, Edge **edges, int edgeCount, Node *src) {
+    double *dist = malloc(sizeof(double) * nodeCount);
+    _BellmanFord(nodes, nodeCount, edges, edgeCount, src, dist);
+
+    for(int i = 0; i < nodeCount; i++) {
+        double cost;
+        Edge **path;
+        int len = WeightedShortestPath(src, nodes[i], NULL, "w", SHORTEST_PATH_UNBOUNDED, &cost, &path);
+        if(dist[i] < 0) {
+            assert(len == -1);
+            continue;
+        }
+        assert(len >= 0);
+        assert(fabs(cost - dist[i]) < EPSILON);
+        _ValidatePath(path, len, src, nodes[i]);
+        assert(fabs(_PathCost(path, len) - cost) < EPSILON);
+        free(path);
+    }
+    free(dist);
+}
+
+void test_weighted_shortest_path_grid() {
+    /* 8x8 grid, edges in all 4 directions with random weights. */
+    int dim = 8;
+    int nodeCount = dim * dim;
+    Node **nodes = malloc(sizeof(Node*) * nodeCount);
+    Edge **edges = malloc(sizeof(Edge*) * nodeCount * 4);
+    int edgeCount = 0;
+
+    srand(7);
+    for(int i = 0; i < nodeCount; i++) nodes[i] = NewNode(_NextId(), NULL);
+    for(int i = 0; i < dim; i++) {
+        for(int j = 0; j < dim; j++) {
+            Node *n = nodes[i * dim + j];
+            if(j + 1 < dim) edges[edgeCount++] = _ConnectWeighted(n, nodes[i * dim + j + 1], rand() % 10);
+            if(j > 0) edges[edgeCount++] = _ConnectWeighted(n, nodes[i * dim + j - 1], rand() % 10);
+            if(i + 1 < dim) edges[edgeCount++] = _ConnectWeighted(n, nodes[(i + 1) * dim + j], rand() % 10);
+            if(i > 0) edges[edgeCount++] = _ConnectWeighted(n, nodes[(i - 1) * dim + j], rand() % 10);
+        }
+    }
+
+    _ValidateLeastCost(nodes, nodeCount, edges, edgeCount, nodes[0]);
+    _ValidateLeastCost(nodes, nodeCount, edges, edgeCount, nodes[nodeCount / 2 + 3]);
+
+    for(int i = 0; i < edgeCount; i++) FreeEdge(edges[i]);
+    for(int i = 0; i < nodeCount; i++) FreeNode(nodes[i]);
+    free(edges);
+    free(nodes);
+}
+
+void test_weighted_shortest_path_power_law() {
+    /* Preferential attachment, new nodes link to existing nodes
+     * with probability proportional to their degree. */
+    int nodeCount = 200;
+    int linksPerNode = 3;
+    Node **nodes = malloc(sizeof(Node*) * nodeCount);
+    Edge **edges = malloc(sizeof(Edge*) * nodeCount * linksPerNode * 2);
+    int *endpoints = malloc(sizeof(int) * nodeCount * linksPerNode * 4);
+    int edgeCount = 0;
+    int endpointCount = 0;
+
+    srand(11);
+    for(int i = 0; i < nodeCount; i++) {
+        nodes[i] = NewNode(_NextId(), NULL);
+        for(int j = 0; j < linksPerNode && i > 0; j++) {
+            int target = (endpointCount > 0) ? endpoints[rand() % endpointCount] : 0;
+            /* Both directions, different weights. */
+            edges[edgeCount++] = _ConnectWeighted(nodes[i], nodes[target], 1 + rand() % 20);
+            edges[edgeCount++] = _ConnectWeighted(nodes[target], nodes[i], 1 + rand() % 20);
+            endpoints[endpointCount++] = i;
+            endpoints[endpointCount++] = target;
+        }
+    }
+
+    _ValidateLeastCost(nodes, nodeCount, edges, edgeCount, nodes[0]);
+    _ValidateLeastCost(nodes, nodeCount, edges, edgeCount, nodes[nodeCount - 1]);
+
+    for(int i = 0; i < edgeCount; i++) FreeEdge(edges[i]);
+    for(int i = 0; i < nodeCount; i++) FreeNode(nodes[i]);
+    free(endpoints);
+    free(edges);
+    free(nodes);
+}
+
+int main(int argc, char **argv) {
+    test_shortest_path();
+    test_shortest_path_grid();
+    test_weighted_shortest_path();
+    test_weighted_shortest_path_grid();
+    test_weighted_shortest_path_power_law();
+    printf("PASS!");
+    return 0;
+}
@@ -0,0 +1,74 @@
+#include <stdio.h>
+#include <stdint.h>
+#include "assert.h"
+#include "../src/util/slab.h"
+#include "../src/graph/node.h"
+#include "../src/graph/edge.h"
+
+void test_slab_alloc() {
+    Slab *slab = NewSlab(3, 4);
+
+    /* Objects are aligned and large enough to link released ones. */
+    assert(slab->objSize >= sizeof(void*));
+    assert(slab->objSize % sizeof(long double) == 0);
+    assert(Slab_MemUsage(slab) == sizeof(Slab));
+
+    void *objs[6];
+    for(int i = 0; i < 6; i++) {
+        objs[i] = Slab_Calloc(slab);
+        assert((uintptr_t)objs[i] % sizeof(long double) == 0);
+        for(int j = 0; j < i; j++) assert(objs[i] != objs[j]);
+    }
+
+    /* Six objects fit in two chunks of four. */
+    assert(slab->live == 6);
+    assert(slab->chunks == 2);
+    assert(Slab_MemUsage(slab) == sizeof(Slab) + 2 * (sizeof(SlabChunk) + 4 * slab->objSize));
+
+    /* Released objects are handed out again ahead of fresh ones. */
+    Slab_Release(slab, objs[1]);
+    Slab_Release(slab, objs[4]);
+    assert(slab->live == 4);
+    assert(Slab_Alloc(slab) == objs[4]);
+    assert(Slab_Calloc(slab) == objs[1]);
+    assert(*(char*)objs[1] == 0);
+    assert(slab->live == 6);
+    assert(slab->chunks == 2);
+
+    Slab_Free(slab);
+}
+
+void test_slab_entities() {
+    /* Nodes released to the pool are reused with empty edge lists. */
+    Node *a = NewNode(1, "person");
+    Node *b = NewNode(2, "person");
+    Edge *e = NewEdge(3, a, b, "knows");
+    Node_ConnectNode(a, b, e);
+    assert(Vector_Size(a->outgoingEdges) == 1);
+    assert(Vector_Size(b->incomingEdges) == 1);
+
+    FreeEdge(e);
+    FreeNode(a);
+    Node *c = NewNode(4, NULL);
+    assert(c == a);
+    assert(c->id == 4 && c->label == NULL);
+    assert(Vector_Size(c->outgoingEdges) == 0);
+    assert(Vector_Size(c->incomingEdges) == 0);
+
+    Edge *f = NewEdge(5, c, b, "knows");
+    assert(f == e);
+    Node_ConnectNode(c, b, f);
+    assert(Vector_Size(c->outgoingEdges) == 1);
+    assert(Vector_Size(b->incomingEdges) == 2);
+
+    FreeEdge(f);
+    FreeNode(b);
+    FreeNode(c);
+}
+
+int main(int argc, char **argv) {
+    test_slab_alloc();
+    test_slab_entities();
+    printf("PASS!\n");
+    return 0;
+}
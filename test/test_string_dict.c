@@ -0,0 +1,153 @@
+#include <stdio.h>
+#include <string.h>
+#include "assert.h"
+#include "../src/value.h"
+#include "../src/graph/node.h"
+#include "../src/query_executor.h"
+#include "../src/resultset/record.h"
+#include "../src/aggregate/aggregate.h"
+#include "../src/aggregate/agg_funcs.h"
+#include "../src/grouping/group_cache.h"
+#include "../src/graph_context/string_dict.h"
+#include "../src/graph_context/graph_context.h"
+#include "../src/execution_plan/execution_plan.h"
+
+long int _next_id = 1;
+
+void test_string_dict_intern() {
+    StringDict *d = NewStringDict("country");
+
+    /* Each distinct value is stored once. */
+    SIValue a = SI_StringValC(strdup("Israel"));
+    SIValue b = SI_StringValC(strdup("Israel"));
+    SIValue c = SI_StringValC(strdup("France"));
+    assert(StringDict_Intern(d, &a) == 1);
+    assert(StringDict_Intern(d, &b) == 1);
+    assert(StringDict_Intern(d, &c) == 2);
+    assert(a.stringval.str == b.stringval.str);
+    assert(b.code == 1 && c.code == 2);
+    assert(StringDict_Count(d) == 2);
+    assert(StringDict_Savings(d) == strlen("Israel") + 1);
+
+    /* Interning twice changes nothing. */
+    assert(StringDict_Intern(d, &a) == 1);
+    assert(StringDict_Count(d) == 2);
+
+    /* Values differing by case only are left as is,
+     * lookups ignore case. */
+    SIValue upper = SI_StringValC(strdup("ISRAEL"));
+    assert(StringDict_Intern(d, &upper) == 0);
+    assert(upper.code == 0 && strcmp(upper.stringval.str, "ISRAEL") == 0);
+    assert(StringDict_Lookup(d, "israel", 6) == 1);
+    assert(StringDict_Lookup(d, "Spain", 5) == 0);
+    free(upper.stringval.str);
+
+    /* Values resolved by code count towards savings. */
+    SIValue shared = StringDict_Share(d, 2);
+    assert(shared.code == 2 && shared.stringval.str == c.stringval.str);
+    assert(StringDict_Savings(d) == strlen("Israel") + strlen("France") + 2);
+
+    /* Other types, long strings and overflowing values aren't interned. */
+    SIValue num = SI_DoubleVal(1);
+    assert(StringDict_Intern(d, &num) == 0);
+    char long_str[STRING_DICT_MAX_LEN + 2];
+    memset(long_str, 'x', sizeof(long_str) - 1);
+    long_str[sizeof(long_str) - 1] = '\0';
+    SIValue l = SI_StringValC(strdup(long_str));
+    assert(StringDict_Intern(d, &l) == 0);
+    free(l.stringval.str);
+
+    for(int i = StringDict_Count(d); i < STRING_DICT_MAX_ENTRIES; i++) {
+        char buf[16];
+        snprintf(buf, 16, "c%d", i);
+        SIValue v = SI_StringValC(strdup(buf));
+        assert(StringDict_Intern(d, &v) == i + 1);
+    }
+    SIValue overflow = SI_StringValC(strdup("Spain"));
+    assert(StringDict_Intern(d, &overflow) == 0);
+    free(overflow.stringval.str);
+    SIValue known = SI_StringValC(strdup("France"));
+    assert(StringDict_Intern(d, &known) == 2);
+
+    StringDict_Free(d);
+}
+
+Node *_AddPerson(GraphContext *gc, const char *name, const char *country) {
+    Node *n = NewNode(_next_id++, "person");
+    char **keys = malloc(sizeof(char*) * 2);
+    SIValue *values = malloc(sizeof(SIValue) * 2);
+    keys[0] = strdup("name");
+    values[0] = SI_StringValC(strdup(name));
+    keys[1] = strdup("country");
+    values[1] = SI_StringValC(strdup(country));
+    Node_Add_Properties(n, 2, keys, values);
+    free(keys);
+    free(values);
+
+    GraphContext_AddNode(gc, n);
+    return n;
+}
+
+/* Runs query, returns the number of records it produced,
+ * groups for aggregating queries. */
+int _Run(GraphContext *gc, const char *query) {
+    char *errMsg = NULL;
+    AST_QueryExpressionNode *ast = ParseQuery(query, strlen(query), &errMsg);
+    assert(ast);
+    ExecutionPlan *plan = NewExecutionPlan(NULL, gc, ast);
+    ResultSet *set = ExecutionPlan_Execute(plan);
+    int count = Vector_Size(set->records);
+
+    char *key;
+    Group *group;
+    CacheGroupIterator *iter = CacheGroupIter();
+    while(CacheGroupIterNext(iter, &key, &group) != 0) count++;
+    CacheGroupIterator_Free(iter);
+    FreeGroupCache();
+    InitGroupCache();
+
+    ResultSet_Free(NULL, set);
+    ExecutionPlanFree(plan);
+    return count;
+}
+
+void test_string_dict_graph() {
+    GraphContext *gc = NewGraphContext("social");
+    Node *a = _AddPerson(gc, "a", "Israel");
+    Node *b = _AddPerson(gc, "b", "Israel");
+    Node *c = _AddPerson(gc, "c", "ISRAEL");
+    _AddPerson(gc, "d", "France");
+
+    /* Node properties are interned within their property's dictionary. */
+    StringDict *d = GraphContext_GetStringDict(gc, "country");
+    assert(d && StringDict_Count(d) == 2);
+    SIValue *ca = Node_Get_Property(a, "country");
+    SIValue *cb = Node_Get_Property(b, "country");
+    assert(ca->code && ca->code == cb->code && ca->stringval.str == cb->stringval.str);
+    assert(Node_Get_Property(c, "country")->code == 0);
+    assert(GraphContext_GetStringDict(gc, "age") == NULL);
+
+    /* Equality ignores case whether values are interned or not. */
+    assert(_Run(gc, "MATCH (p:person) WHERE p.country = 'israel' RETURN p.name") == 3);
+    assert(_Run(gc, "MATCH (p:person) WHERE p.country = 'France' RETURN p.name") == 1);
+    assert(_Run(gc, "MATCH (p:person) WHERE p.country != 'France' RETURN p.name") == 3);
+    assert(_Run(gc, "MATCH (p:person) WHERE p.country = 'Spain' RETURN p.name") == 0);
+
+    /* Groups are keyed by code, different cases remain different groups. */
+    assert(_Run(gc, "MATCH (p:person) RETURN p.country, count(p)") == 3);
+
+    GraphMemoryUsage usage;
+    GraphContext_MemUsage(gc, &usage);
+    assert(usage.dictionary_savings == strlen("Israel") + 1);
+
+    GraphContext_Free(gc);
+}
+
+int main(int argc, char **argv) {
+    InitGroupCache();
+    Agg_RegisterFuncs();
+    test_string_dict_intern();
+    test_string_dict_graph();
+    printf("PASS!\n");
+    return 0;
+}
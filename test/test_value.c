@@ -1,26 +1,47 @@
 #include <stdio.h>
 #include <string.h>
+#include <unistd.h>
 #include "assert.h"
 #include "../src/value.h"
+#include "../src/value_cmp.h"
 
 void test_value_parse() {
     SIValue v;
     char *str = "12345";
     SIValue_FromString(&v, str, strlen(str));
-    assert(v.type == T_DOUBLE);
-    assert(v.doubleval == 12345);
+    assert(v.type == T_INT64);
+    assert(v.longval == 12345);
 
     str = "3.14";
     SIValue_FromString(&v, str, strlen(str));
-    assert(v.type == T_FLOAT);
+    assert(v.type == T_DOUBLE);
     
     /* Almost equals. */
-    assert((v.floatval - 3.14) < 0.0001);
+    assert((v.doubleval - 3.14) < 0.0001);
 
     str = "-9876";
     SIValue_FromString(&v, str, strlen(str));
+    assert(v.type == T_INT64);
+    assert(v.longval == -9876);
+
+    /* Integers out of range are parsed as doubles, quietly. */
+    FILE *err = tmpfile();
+    int stderr_fd = dup(STDERR_FILENO);
+    dup2(fileno(err), STDERR_FILENO);
+    str = "123456789012345678901234567890";
+    SIValue_FromString(&v, str, strlen(str));
+    fflush(stderr);
+    dup2(stderr_fd, STDERR_FILENO);
+    close(stderr_fd);
+    assert(v.type == T_DOUBLE);
+    assert(v.doubleval > 1e29);
+    assert(ftell(err) == 0);
+    fclose(err);
+
+    str = "-123456789012345678901234567890";
+    SIValue_FromString(&v, str, strlen(str));
     assert(v.type == T_DOUBLE);
-    assert(v.doubleval == -9876);
+    assert(v.doubleval < -1e29);
 
     str = "Test!";
     SIValue_FromString(&v, str, strlen(str));
@@ -28,8 +49,37 @@ void test_value_parse() {
     assert(strcmp(v.stringval.str, "Test!") == 0);
 }
 
+void test_value_layout() {
+    /* Type tag shares the second word with a string's length. */
+    assert(sizeof(SIValue) == 16);
+    assert(sizeof(SIString) == 12);
+
+    SIValue v = SI_StringValC("Test!");
+    assert(v.type == T_STRING && v.stringval.len == 5);
+    v = SI_LongVal(INT64_MIN);
+    assert(v.type == T_INT64 && v.longval == INT64_MIN);
+    v = SI_DoubleVal(-0.5);
+    assert(v.type == T_DOUBLE && v.doubleval == -0.5);
+}
+
+void test_value_cmp_numeric() {
+    /* Numbers of different types are compared by value. */
+    SIValue l = SI_LongVal(3);
+    SIValue d = SI_DoubleVal(2.5);
+    SIValue s = SI_StringValC("3");
+    SIValue inf = SI_InfVal();
+    assert(cmp_numeric(&l, &d) > 0);
+    assert(cmp_numeric(&d, &l) < 0);
+    d = SI_DoubleVal(3);
+    assert(cmp_numeric(&l, &d) == 0);
+    assert(cmp_numeric(&s, &l) < 0);
+    assert(cmp_numeric(&inf, &l) > 0);
+}
+
 int main(int argc, char **argv) {
     test_value_parse();
+    test_value_layout();
+    test_value_cmp_numeric();
     printf("PASS!");
     return 0;
 }
\ No newline at end of file